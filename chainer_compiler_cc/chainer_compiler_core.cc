@@ -29,6 +29,7 @@
 #include <runtime/chxvm_state.h>
 #include <runtime/chxvm_var.h>
 #include <runtime/meminfo.h>
+#include <tools/program_cache.h>
 #include <tools/util.h>
 
 namespace py = pybind11;
@@ -69,6 +70,10 @@ std::shared_ptr<runtime::ChxVM> Compile(const std::shared_ptr<Graph>& graph, boo
     return std::make_shared<runtime::ChxVM>(chxvm_prog);
 }
 
+std::shared_ptr<runtime::ProgramCache> CreateProgramCache(const std::shared_ptr<Graph>& graph, int capacity, bool background) {
+    return std::make_shared<runtime::ProgramCache>(*graph, capacity, background);
+}
+
 bool IsParam(Value* value) {
     const std::string& name = value->name();
     // the second condition is for ch2o
@@ -161,6 +166,11 @@ void InitGraph(py::module& m) {
     c.def("all_memory_usage", &GetAllMemoryUsage, "Get estimated all memory usage");
     c.def("param_memory_usage", &GetParamMemoryUsage, "Get estimated param memory usage");
     c.def("dump", &Dump, "Dump a model to a string");
+    c.def("program_cache",
+          &CreateProgramCache,
+          "Create a cache of programs specialized for input shapes",
+          "capacity"_a = 8,
+          "background"_a = true);
 }
 
 runtime::ChxVMOptions CreateOptions(
@@ -332,6 +342,65 @@ void InitChxVM(py::module& m) {
     c.def("run", &RunState, "Run the model", "state"_a);
 }
 
+std::map<std::string, VarPtr> RunProgramCache(
+        const std::shared_ptr<runtime::ProgramCache>& cache,
+        const std::map<std::string, VarPtr>& inputs,
+        bool trace,
+        bool verbose,
+        bool training,
+        bool check_types,
+        bool check_nans,
+        bool check_infs,
+        int dump_memory_usage,
+        int64_t base_memory_usage,
+        const std::string& chrome_tracing,
+        const std::string& dump_outputs_dir,
+        const std::map<std::string, py::function>& custom_funcs) {
+    return Run(cache->GetProgram(inputs),
+               inputs,
+               trace,
+               verbose,
+               training,
+               check_types,
+               check_nans,
+               check_infs,
+               dump_memory_usage,
+               base_memory_usage,
+               chrome_tracing,
+               dump_outputs_dir,
+               custom_funcs);
+}
+
+std::map<std::string, double> GetProgramCacheStats(const std::shared_ptr<runtime::ProgramCache>& cache) {
+    const runtime::ProgramCacheStats stats = cache->stats();
+    return {{"hits", stats.hits},
+            {"misses", stats.misses},
+            {"evictions", stats.evictions},
+            {"num_compiled", stats.num_compiled},
+            {"compile_seconds", stats.compile_seconds}};
+}
+
+void InitProgramCache(py::module& m) {
+    py::class_<runtime::ProgramCache, std::shared_ptr<runtime::ProgramCache>> c{m, "ProgramCache"};
+    c.def("run",
+          &RunProgramCache,
+          "Run the program specialized for the shapes of inputs",
+          "inputs"_a,
+          "trace"_a = false,
+          "verbose"_a = false,
+          "training"_a = false,
+          "check_types"_a = true,
+          "check_nans"_a = false,
+          "check_infs"_a = false,
+          "dump_memory_usage"_a = 0,
+          "base_memory_usage"_a = -1,
+          "chrome_tracing"_a = "",
+          "dump_outputs_dir"_a = "",
+          "custom_funcs"_a = py::dict());
+    c.def("wait", &runtime::ProgramCache::Wait, "Wait for background compilations");
+    c.def("stats", &GetProgramCacheStats, "Get hit/miss counts and compile time");
+}
+
 void InitChxVMState(py::module& m) {
     py::class_<runtime::ChxVMState, std::shared_ptr<runtime::ChxVMState>> c{m, "ChxVMState"};
 }
@@ -394,6 +463,8 @@ PYBIND11_MODULE(_chainer_compiler_core, m) {  // NOLINT
 
     InitChxVM(m);
 
+    InitProgramCache(m);
+
     InitChxVMState(m);
 
     m.def("load", &LoadGraph, "Load an ONNX model");
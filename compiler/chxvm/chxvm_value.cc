@@ -22,11 +22,13 @@ ChxVMValue ChxVMValue::GetOutputValue(const Node& node, int i, const ValueIdMana
 void ChxVMValue::AddOutput(runtime::ChxVMInstructionProto* inst) const {
     inst->add_outputs(id_);
     runtime::ChxVMTypeProto* type = inst->add_output_types();
-    if (value_ && value_->type().kind() == Type::Kind::kTensor && value_->type().HasKnownShape() &&
+    if (value_ && value_->type().kind() == Type::Kind::kTensor && value_->type().HasSymbolicShape() &&
         value_->type().dtype() != Dtype::kString) {
-        type->set_dtype(value_->type().dtype());
-        for (int d : value_->type().dims()) {
-            type->add_shape(d);
+        const Type& vtype = value_->type();
+        type->set_dtype(vtype.dtype());
+        for (size_t i = 0; i < vtype.ndim(); ++i) {
+            type->add_shape(vtype.dims()[i]);
+            type->add_dim_params(vtype.dims()[i] < 0 ? vtype.dim_param(i) : "");
         }
     }
     inst->add_output_names(value_ ? CleanseIdent(value_->name()) : "");
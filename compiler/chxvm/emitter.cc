@@ -192,6 +192,19 @@ private:
         CHECK_EQ(5UL, node.inputs().size());
         CHECK_EQ(1, node.spatial()) << "`spatial` for BatchNormalization was removed from ONNX";
         size_t num_onnx_outputs = node.outputs().size();
+        if (node.chainer_channels_last()) {
+            CHECK_EQ(1UL, num_onnx_outputs);
+            CHECK(!node.chainer_fuse_relu());
+            EMIT(FixedBatchNormalizationNHWC,
+                 GetOutputValue(node, 0),
+                 GetValueId(node.input(0)),
+                 GetValueId(node.input(1)),
+                 GetValueId(node.input(2)),
+                 GetValueId(node.input(3)),
+                 GetValueId(node.input(4)),
+                 node.epsilon());
+            return;
+        }
         if (num_onnx_outputs == 1 && !node.chainer_in_recomputing()) {
             EMIT(FixedBatchNormalization,
                  GetOutputValue(node, 0),
@@ -200,7 +213,8 @@ private:
                  GetValueId(node.input(2)),
                  GetValueId(node.input(3)),
                  GetValueId(node.input(4)),
-                 node.epsilon());
+                 node.epsilon(),
+                 node.chainer_fuse_relu());
             return;
         }
 
@@ -232,7 +246,8 @@ private:
              GetValueId(node.input(4)),
              node.epsilon(),
              node.momentum(),
-             node.chainer_in_recomputing());
+             node.chainer_in_recomputing(),
+             node.chainer_fuse_relu());
     }
 
 #undef EMIT
@@ -673,50 +688,56 @@ private:
             EMIT(Identity, ChxVMValue(GetValueId(body_in)), GetValueId(loop_in));
         }
 
-        // Prepare temporary sequences for scan outputs.
+        // Prepare buffers for scan outputs. When the number of
+        // iterations is known at the loop entry and the shape of an
+        // output is static, the stacked output is allocated at once
+        // and each iteration writes its slice. Otherwise, outputs are
+        // collected in a sequence and stacked after the loop.
         std::vector<int> scan_out_ids;
+        std::vector<bool> scan_preallocated;
         for (int i = 0; i < num_scans; ++i) {
+            CHECK_LT(i + num_states + 1, body_output_values.size());
+            const Type& type = body_output_values[i + num_states + 1]->type();
+            const bool preallocated = !max_trip_count->IsNull() && terminal_condition->IsNull() && loop.chainer_stack_axis() == 0 &&
+                                      type.kind() == Type::Kind::kTensor && type.dtype() != Dtype::kUnknown && type.HasKnownShape();
             int id = value_ids_.AssignNextId();
-            EMIT(SequenceCreate, ChxVMValue(id), {});
+            if (preallocated) {
+                EMIT(ScanOutputCreate, ChxVMValue(id), GetValueId(max_trip_count), type.dims(), type.dtype());
+            } else {
+                EMIT(SequenceCreate, ChxVMValue(id), {});
+            }
             scan_out_ids.push_back(id);
+            scan_preallocated.push_back(preallocated);
         }
 
+        // The loop counter and the condition are kept in scalar
+        // registers and updated by scalar ops.
         int skip_loop_jmp = -1;
         int skip_loop_cond_id = -1;
         if (!max_trip_count->IsNull()) {
             int zero_id = value_ids_.AssignNextId();
             skip_loop_cond_id = value_ids_.AssignNextId();
             EMIT(IntScalarConstant, ChxVMValue(zero_id), 0, Dtype::kInt64, true);
-            EMIT(Greater, ChxVMValue(skip_loop_cond_id), GetValueId(max_trip_count), zero_id);
+            EMIT(ScalarGreater, ChxVMValue(skip_loop_cond_id), GetValueId(max_trip_count), zero_id);
             FREE(zero_id);
-        }
-        if (!terminal_condition->IsNull()) {
-            int tmp_id = value_ids_.AssignNextId();
-            if (skip_loop_cond_id >= 0) {
-                EMIT(Mul, ChxVMValue(tmp_id), skip_loop_cond_id, GetValueId(terminal_condition));
-                FREE(skip_loop_cond_id);
-            } else {
-                EMIT(Identity, ChxVMValue(tmp_id), GetValueId(terminal_condition));
+            if (!terminal_condition->IsNull()) {
+                EMIT(ScalarAnd, skip_loop_cond_id, GetValueId(terminal_condition));
             }
-            skip_loop_cond_id = tmp_id;
-        }
-        if (skip_loop_cond_id >= 0) {
             skip_loop_jmp = prog->instructions_size();
             EMIT(JmpFalse, skip_loop_cond_id, -1);
+        } else {
+            skip_loop_jmp = prog->instructions_size();
+            EMIT(JmpFalse, GetValueId(terminal_condition), -1);
         }
 
         int loop_begin = prog->instructions_size();
 
         EmitGraph(*body, prog, true /* in_loop */, body_output_values);
-        int one_id = value_ids_.AssignNextId();
-        EMIT(IntScalarConstant, ChxVMValue(one_id), 1, Dtype::kInt64, true);
-        int tmp_id = value_ids_.AssignNextId();
-        EMIT(Add, ChxVMValue(tmp_id), iter_id, one_id);
-        FREE(one_id);
         for (const Value* value : body_input_values) {
-            FREE(GetValueId(value));
+            if (value != body_input_values[0]) {
+                FREE(GetValueId(value));
+            }
         }
-        MOVE(ChxVMValue(iter_id), tmp_id);
         MOVE(ChxVMValue(cond_id), GetValueId(body_output_values[0]));
 
         // Propagate the loop state.
@@ -737,28 +758,32 @@ private:
         for (int i = 0; i < num_scans; ++i) {
             CHECK_LT(i + num_states + 1, body_output_values.size());
             const Value* body_out = body_output_values[i + num_states + 1];
-            EMIT(SequenceAppend, scan_out_ids[i], GetValueId(body_out));
+            if (scan_preallocated[i]) {
+                EMIT(ScanOutputSet, scan_out_ids[i], iter_id, GetValueId(body_out));
+            } else {
+                EMIT(SequenceAppend, scan_out_ids[i], GetValueId(body_out));
+            }
             FREE(GetValueId(body_out));
         }
 
+        EMIT(ScalarIncrement, iter_id);
+
         // Check if the loop finishes.
         if (terminal_condition->IsNull()) {
             CHECK(!max_trip_count->IsNull());
             FREE(cond_id);
-            EMIT(Greater, ChxVMValue(cond_id), GetValueId(loop.input(0)), iter_id);
+            EMIT(ScalarGreater, ChxVMValue(cond_id), GetValueId(max_trip_count), iter_id);
         } else if (!max_trip_count->IsNull()) {
-            EMIT(Greater, ChxVMValue(tmp_id), GetValueId(loop.input(0)), iter_id);
-            int tmp2_id = value_ids_.AssignNextId();
-            EMIT(Mul, ChxVMValue(tmp2_id), cond_id, tmp_id);
-            FREE(cond_id);
-            MOVE(ChxVMValue(cond_id), tmp2_id);
+            int tmp_id = value_ids_.AssignNextId();
+            EMIT(ScalarGreater, ChxVMValue(tmp_id), GetValueId(max_trip_count), iter_id);
+            EMIT(ScalarAnd, cond_id, tmp_id);
             FREE(tmp_id);
         }
         EMIT(JmpTrue, cond_id, loop_begin);
 
-        if (skip_loop_jmp >= 0) {
-            runtime::ChxVMInstructionProto* jmp = prog->mutable_instructions(skip_loop_jmp);
-            jmp->mutable_inputs(1)->set_i(prog->instructions_size());
+        runtime::ChxVMInstructionProto* jmp = prog->mutable_instructions(skip_loop_jmp);
+        jmp->mutable_inputs(1)->set_i(prog->instructions_size());
+        if (skip_loop_cond_id >= 0) {
             FREE(skip_loop_cond_id);
         }
 
@@ -775,12 +800,16 @@ private:
             }
         }
 
-        // Stack and output scan outputs.
+        // Stack (if necessary) and output scan outputs.
         for (int i = 0; i < num_scans; ++i) {
             CHECK_LT(i + num_states, loop.outputs().size());
             const Value* loop_out = loop.output(i + num_states);
-            EMIT(SequenceStack, ChxVMValue(GetValueId(loop_out)), scan_out_ids[i], loop.chainer_stack_axis());
-            FREE(scan_out_ids[i]);
+            if (scan_preallocated[i]) {
+                MOVE(ChxVMValue(GetValueId(loop_out)), scan_out_ids[i]);
+            } else {
+                EMIT(SequenceStack, ChxVMValue(GetValueId(loop_out)), scan_out_ids[i], loop.chainer_stack_axis());
+                FREE(scan_out_ids[i]);
+            }
         }
 
         FREE(iter_id);
@@ -810,10 +839,12 @@ private:
             }
             program->add_input_names(value->name());
             runtime::ChxVMTypeProto* type = program->add_input_types();
-            if (value->type().kind() == Type::Kind::kTensor && value->type().HasKnownShape()) {
-                type->set_dtype(value->type().dtype());
-                for (int d : value->type().dims()) {
-                    type->add_shape(d);
+            const Type& vtype = value->type();
+            if (vtype.kind() == Type::Kind::kTensor && vtype.HasSymbolicShape()) {
+                type->set_dtype(vtype.dtype());
+                for (size_t i = 0; i < vtype.ndim(); ++i) {
+                    type->add_shape(vtype.dims()[i]);
+                    type->add_dim_params(vtype.dims()[i] < 0 ? vtype.dim_param(i) : "");
                 }
             }
         }
@@ -207,7 +207,12 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
         CHECK_EQ(1UL, node.outputs().size());
         // TODO(ChainerX): Support dilation.
         for (int d : node.dilations()) CHECK_EQ(d, 1) << "Dilation is not supported yet";
-        EMIT(Conv, out(0), in(0), in(1), oin(2), strides(), pads(), node.group(), auto_pad());
+        if (node.chainer_channels_last()) {
+            CHECK_EQ(1, node.group());
+            EMIT(ConvNHWC, out(0), in(0), in(1), oin(2), node.strides(), node.pads());
+        } else {
+            EMIT(Conv, out(0), in(0), in(1), oin(2), strides(), pads(), node.group(), auto_pad());
+        }
     } else if (node.op_type() == Node::kConvTranspose) {
         CHECK_LE(2UL, node.inputs().size());
         CHECK_GE(3UL, node.inputs().size());
@@ -268,7 +273,7 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
              node.hidden_size(),
              direction());
     } else if (node.op_type() == Node::kChainerLSTMGrad) {
-        EMIT(LSTMGrad, out(0), out(1), out(2), out(3), in(0), in(1));
+        EMIT(LSTMGrad, out(0), out(1), out(2), out(3), oout(4), in(0), in(1));
     } else if (node.op_type() == Node::kShape) {
         CHECK_EQ(1UL, node.inputs().size());
         CHECK_EQ(1UL, node.outputs().size());
@@ -306,10 +311,9 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
     } else if (node.op_type() == Node::kChainerLRNGrad) {
         EMIT(LRNGrad, out(0), in(0), in(1), in(2), in(3), node.alpha(), node.beta(), node.bias(), node.size());
     } else if (node.op_type() == Node::kUpsample || node.op_type() == Node::kResize) {
-        CHECK_EQ("nearest", node.mode()) << "Only nearest upsampling is supported";
-        EMIT(Resize, out(0), in(0), in(1));
+        EMIT(Resize, out(0), in(0), in(1), node.mode());
     } else if (node.op_type() == Node::kChainerResizeGrad) {
-        EMIT(ResizeGrad, out(0), in(0), in(1));
+        EMIT(ResizeGrad, out(0), in(0), in(1), in(2));
     } else if (node.op_type() == Node::kPad) {
         CHECK_EQ(1UL, node.inputs().size());
         CHECK_EQ(1UL, node.outputs().size());
@@ -321,7 +325,11 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
             CHECK_EQ(3UL, node.outputs().size());
             CHECK(node.output(1)->IsNull());
         }
-        EMIT(MaxPool, out(0), oout(2), in(0), node.kernel_shape(), strides(), pads(), node.chainer_cover_all(), auto_pad());
+        if (node.chainer_channels_last()) {
+            EMIT(MaxPoolNHWC, out(0), in(0), node.kernel_shape(), node.strides(), node.pads(), node.chainer_cover_all());
+        } else {
+            EMIT(MaxPool, out(0), oout(2), in(0), node.kernel_shape(), strides(), pads(), node.chainer_cover_all(), auto_pad());
+        }
     } else if (node.op_type() == Node::kChainerMaxPoolGrad) {
         CHECK_EQ("NOTSET", node.auto_pad()) << "auto_pad is not supported for MaxPool";
         EMIT(MaxPoolGrad, out(0), in(0), in(1), node.kernel_shape(), node.chainer_cover_all());
@@ -333,6 +341,14 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
         EMIT(ROIMaxAlign2D, out(0), in(0), in(1), in(2), node.output_shape(), node.spatial_scale(), node.sampling_ratio_list());
     } else if (node.op_type() == Node::kChainerROIAverageAlign2D) {
         EMIT(ROIAverageAlign2D, out(0), in(0), in(1), in(2), node.output_shape(), node.spatial_scale(), node.sampling_ratio_list());
+    } else if (node.op_type() == Node::kChainerROIMaxPool2DGrad) {
+        EMIT(ROIMaxPool2DGrad, out(0), in(0), in(1), in(2), in(3), node.output_shape(), node.spatial_scale());
+    } else if (node.op_type() == Node::kChainerROIAveragePool2DGrad) {
+        EMIT(ROIAveragePool2DGrad, out(0), in(0), in(1), in(2), in(3), node.output_shape(), node.spatial_scale());
+    } else if (node.op_type() == Node::kChainerROIMaxAlign2DGrad) {
+        EMIT(ROIMaxAlign2DGrad, out(0), in(0), in(1), in(2), in(3), node.output_shape(), node.spatial_scale(), node.sampling_ratio_list());
+    } else if (node.op_type() == Node::kChainerROIAverageAlign2DGrad) {
+        EMIT(ROIAverageAlign2DGrad, out(0), in(0), in(1), in(2), in(3), node.output_shape(), node.spatial_scale(), node.sampling_ratio_list());
     } else if (node.op_type() == Node::kRoiAlign) {
         std::vector<int64_t> sampling_ratio = {node.sampling_ratio(), node.sampling_ratio()};
         std::vector<int64_t> output_shape = {node.output_height(), node.output_width()};
@@ -343,12 +359,18 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
         } else {
             CHECK(false) << "Unknown RoiAlign mode: " << node.mode();
         }
+    } else if (node.op_type() == Node::kNonMaxSuppression) {
+        EMIT(NonMaxSuppression, out(0), in(0), in(1), oin(2), oin(3), oin(4), node.center_point_box());
     } else if (node.op_type() == Node::kChainerResizeImages) {
         EMIT(ResizeImages, out(0), in(0), node.output_shape());
     } else if (node.op_type() == Node::kAveragePool) {
         CHECK_EQ("NOTSET", node.auto_pad()) << "auto_pad is not supported for AveragePool";
         CHECK_EQ(1UL, node.inputs().size());
-        EMIT(AveragePool, out(0), oout(1), in(0), node.kernel_shape(), strides(), pads(), node.count_include_pad());
+        if (node.chainer_channels_last()) {
+            EMIT(AveragePoolNHWC, out(0), in(0), node.kernel_shape(), node.strides(), node.pads(), node.count_include_pad());
+        } else {
+            EMIT(AveragePool, out(0), oout(1), in(0), node.kernel_shape(), strides(), pads(), node.count_include_pad());
+        }
     } else if (node.op_type() == Node::kChainerAveragePoolGrad) {
         CHECK_EQ("NOTSET", node.auto_pad()) << "auto_pad is not supported for AveragePool";
         EMIT(AveragePoolGrad, out(0), in(0), in(1), node.kernel_shape(), node.count_include_pad());
@@ -586,6 +608,10 @@ void EmitSimpleNode(const Node& node, const ValueIdManager& id_manager, ChxVMPro
              pads(),
              node.group(),
              auto_pad());
+    } else if (node.op_type() == Node::kQLinearMatMul) {
+        CHECK_EQ(8UL, node.inputs().size());
+        CHECK_EQ(1UL, node.outputs().size());
+        EMIT(QLinearMatMul, out(0), in(0), in(1), in(2), in(3), in(4), in(5), in(6), in(7));
     } else if (node.op_type() == Node::kMatMulInteger) {
         CHECK_LE(2UL, node.inputs().size());
         CHECK_GE(4UL, node.inputs().size());
@@ -58,6 +58,14 @@ int64_t CalculateFlopsOfConv(const Node& node) {
     Type const& w = node.input(1)->type();
     Type const& y = node.output(0)->type();
     int64_t bsize = x.dims()[0];
+    if (node.chainer_channels_last()) {
+        // NHWC inputs and outputs, and an OHWI weight.
+        int64_t ichan = x.dims().back();
+        int64_t ochan = y.dims().back();
+        int64_t kernel_nums = LowerDimNumElements(w.dims(), 1) / w.dims().back();
+        int64_t output_nums = LowerDimNumElements(y.dims(), 1) / ochan;
+        return bsize * ichan * ochan * output_nums * kernel_nums;
+    }
     int64_t ichan = x.dims()[1];
     int64_t ochan = y.dims()[1];
     int64_t kernel_nums = LowerDimNumElements(w.dims(), 2);
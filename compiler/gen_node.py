@@ -158,6 +158,13 @@ NodeDef('ArgMin', 1, 1, axis=0, keepdims=True)
 NodeDef('Hardmax', 1, 1, axis=1)
 
 NodeDef('Dropout', 1, (1, 2), ratio=0.5)
+NodeDef('RandomNormal', 0, 1,
+        dtype=Dtype, mean=0.0, scale=1.0, seed=float, shape=[int])
+NodeDef('RandomUniform', 0, 1,
+        dtype=Dtype, high=1.0, low=0.0, seed=float, shape=[int])
+NodeDef('RandomNormalLike', 1, 1, dtype=Dtype, mean=0.0, scale=1.0, seed=float)
+NodeDef('RandomUniformLike', 1, 1, dtype=Dtype, high=1.0, low=0.0, seed=float)
+NodeDef('Multinomial', 1, 1, dtype=Dtype, sample_size=1, seed=float)
 
 NodeDef('MatMul', 2, 1)
 NodeDef('Gemm', 3, 1, alpha=1.0, beta=1.0, transA=False, transB=False)
@@ -182,13 +189,18 @@ conv_attrs = attr_sets(auto_pad='NOTSET',
                        kernel_shape=[int],
                        pads=[int],
                        strides=[int])
-NodeDef('Conv', (2, 3), 1, **conv_attrs)
+# Extension: `chainer_channels_last` indicates the input and the output
+# are NHWC and the weight is OHWI. See compiler/layout.h.
+NodeDef('Conv', (2, 3), 1, chainer_channels_last=False, **conv_attrs)
 NodeDef('ConvTranspose', (2, 3), 1,
         output_padding=[int], output_shape=[int], **conv_attrs)
 
 # Extension: the second or the sixth output is for backward context.
+# Extension: `chainer_fuse_relu` applies ReLU to the output. See
+# MergeBatchNormalizationRelu in compiler/merge.cc.
 NodeDef('BatchNormalization', 5, (1, 2, 3, 4, 5, 6),
-        epsilon=1e-5, momentum=0.9, spatial=1, chainer_in_recomputing=0)
+        epsilon=1e-5, momentum=0.9, spatial=1, chainer_in_recomputing=0,
+        chainer_channels_last=False, chainer_fuse_relu=False)
 # Extension: the second output is for backward context.
 NodeDef('LRN', 1, (1, 2), alpha=1e-4, beta=0.75, bias=1.0, size=Required(int))
 NodeDef('LpNormalization', 1, 1, axis=-1, p=2)
@@ -199,9 +211,11 @@ pool_attrs = attr_sets(auto_pad='NOTSET',
                        storage_order=0,
                        strides=[int])
 # Extension: the third output is for backward context.
-NodeDef('MaxPool', 1, (1, 2, 3), chainer_cover_all=False, **pool_attrs)
+NodeDef('MaxPool', 1, (1, 2, 3), chainer_cover_all=False,
+        chainer_channels_last=False, **pool_attrs)
 # Extension: the second output is for backward context.
-NodeDef('AveragePool', 1, (1, 2), count_include_pad=False, **pool_attrs)
+NodeDef('AveragePool', 1, (1, 2), count_include_pad=False,
+        chainer_channels_last=False, **pool_attrs)
 NodeDef('GlobalMaxPool', 1, 1)
 NodeDef('GlobalAveragePool', 1, 1)
 NodeDef('Pad', 1, 1, mode='constant', pads=[int], value=0.0)
@@ -220,6 +234,7 @@ NodeDef('Where', 3, 1)
 
 NodeDef('ImageScaler', 1, 1, scale=1.0, bias_list=[float])
 NodeDef('MaxRoiPool', 2, 1, pooled_shape=Required([int]), spatial_scale=1.0)
+NodeDef('NonMaxSuppression', (2, 3, 4, 5), 1, center_point_box=0)
 NodeDef('RoiAlign', 3, 1, mode='avg', output_height=1, output_width=1,
         sampling_ratio=0, spatial_scale=1.0)
 
@@ -268,7 +283,18 @@ NodeDef('ChainerDoSomething', None, None, function_name=Required(str))
 
 NodeDef('ChainerMaxPoolGrad', 2, 1, chainer_cover_all=False, **pool_attrs)
 NodeDef('ChainerAveragePoolGrad', 2, 1, count_include_pad=False, **pool_attrs)
-NodeDef('ChainerResizeGrad', 2, 1)
+# (gy, scales, shape of x) -> (gx)
+NodeDef('ChainerResizeGrad', 3, 1)
+NodeDef('ChainerROIMaxPool2DGrad', 4, 1,
+        output_shape=[int], spatial_scale=Required(float))
+NodeDef('ChainerROIAveragePool2DGrad', 4, 1,
+        output_shape=[int], spatial_scale=Required(float))
+NodeDef('ChainerROIMaxAlign2DGrad', 4, 1,
+        output_shape=[int], spatial_scale=Required(float),
+        sampling_ratio_list=[int])
+NodeDef('ChainerROIAverageAlign2DGrad', 4, 1,
+        output_shape=[int], spatial_scale=Required(float),
+        sampling_ratio_list=[int])
 NodeDef('ChainerBatchNormalizationGrad', 2, 3)
 NodeDef('ChainerConvTransposeWithDynamicOutputShape', 3, 1, **conv_attrs)
 NodeDef('ChainerSoftmaxCrossEntropy', 2, 1)
@@ -276,7 +302,7 @@ NodeDef('ChainerSelectItem', 2, 1)
 NodeDef('ChainerSelectItemGrad', 3, 1)
 NodeDef('ChainerLRNGrad', 4, 1,
         alpha=1e-4, beta=0.75, bias=1.0, size=Required(int))
-NodeDef('ChainerLSTMGrad', 2, 4)
+NodeDef('ChainerLSTMGrad', 2, (4, 5))
 NodeDef('ChainerConvGradWeight', 3, 1, **conv_attrs)
 NodeDef('ChainerGatherGrad', 3, 1, axis=0)
 NodeDef('ChainerConcatGrad', None, None, axis=0)
@@ -0,0 +1,12378 @@
+// Auto-generated by gen_node.py
+
+#include "gen_node_base.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <common/log.h>
+#include <compiler/flags.h>
+#include <compiler/graph.h>
+#include <compiler/onnx.h>
+#include <compiler/tensor.h>
+
+namespace chainer_compiler {
+
+NodeBase::OpType NodeBase::StringToOpType(const std::string& str) {
+    if (str == "Identity") {
+        return kIdentity;
+        goto goto_label_type;
+    }
+
+    if (str == "Neg") {
+        return kNeg;
+        goto goto_label_type;
+    }
+
+    if (str == "Reciprocal") {
+        return kReciprocal;
+        goto goto_label_type;
+    }
+
+    if (str == "Exp") {
+        return kExp;
+        goto goto_label_type;
+    }
+
+    if (str == "Log") {
+        return kLog;
+        goto goto_label_type;
+    }
+
+    if (str == "Sqrt") {
+        return kSqrt;
+        goto goto_label_type;
+    }
+
+    if (str == "IsNaN") {
+        return kIsNaN;
+        goto goto_label_type;
+    }
+
+    if (str == "IsInf") {
+        return kIsInf;
+        goto goto_label_type;
+    }
+
+    if (str == "Sign") {
+        return kSign;
+        goto goto_label_type;
+    }
+
+    if (str == "Sin") {
+        return kSin;
+        goto goto_label_type;
+    }
+
+    if (str == "Sinh") {
+        return kSinh;
+        goto goto_label_type;
+    }
+
+    if (str == "Cos") {
+        return kCos;
+        goto goto_label_type;
+    }
+
+    if (str == "Cosh") {
+        return kCosh;
+        goto goto_label_type;
+    }
+
+    if (str == "Tan") {
+        return kTan;
+        goto goto_label_type;
+    }
+
+    if (str == "Tanh") {
+        return kTanh;
+        goto goto_label_type;
+    }
+
+    if (str == "Asin") {
+        return kAsin;
+        goto goto_label_type;
+    }
+
+    if (str == "Asinh") {
+        return kAsinh;
+        goto goto_label_type;
+    }
+
+    if (str == "Acos") {
+        return kAcos;
+        goto goto_label_type;
+    }
+
+    if (str == "Acosh") {
+        return kAcosh;
+        goto goto_label_type;
+    }
+
+    if (str == "Atan") {
+        return kAtan;
+        goto goto_label_type;
+    }
+
+    if (str == "Atanh") {
+        return kAtanh;
+        goto goto_label_type;
+    }
+
+    if (str == "Erf") {
+        return kErf;
+        goto goto_label_type;
+    }
+
+    if (str == "Abs") {
+        return kAbs;
+        goto goto_label_type;
+    }
+
+    if (str == "Relu") {
+        return kRelu;
+        goto goto_label_type;
+    }
+
+    if (str == "Selu") {
+        return kSelu;
+        goto goto_label_type;
+    }
+
+    if (str == "LeakyRelu") {
+        return kLeakyRelu;
+        goto goto_label_type;
+    }
+
+    if (str == "Elu") {
+        return kElu;
+        goto goto_label_type;
+    }
+
+    if (str == "Sigmoid") {
+        return kSigmoid;
+        goto goto_label_type;
+    }
+
+    if (str == "Not") {
+        return kNot;
+        goto goto_label_type;
+    }
+
+    if (str == "Floor") {
+        return kFloor;
+        goto goto_label_type;
+    }
+
+    if (str == "Ceil") {
+        return kCeil;
+        goto goto_label_type;
+    }
+
+    if (str == "Softplus") {
+        return kSoftplus;
+        goto goto_label_type;
+    }
+
+    if (str == "Softsign") {
+        return kSoftsign;
+        goto goto_label_type;
+    }
+
+    if (str == "Add") {
+        return kAdd;
+        goto goto_label_type;
+    }
+
+    if (str == "Sub") {
+        return kSub;
+        goto goto_label_type;
+    }
+
+    if (str == "Mul") {
+        return kMul;
+        goto goto_label_type;
+    }
+
+    if (str == "Div") {
+        return kDiv;
+        goto goto_label_type;
+    }
+
+    if (str == "Pow") {
+        return kPow;
+        goto goto_label_type;
+    }
+
+    if (str == "Equal") {
+        return kEqual;
+        goto goto_label_type;
+    }
+
+    if (str == "Greater") {
+        return kGreater;
+        goto goto_label_type;
+    }
+
+    if (str == "Less") {
+        return kLess;
+        goto goto_label_type;
+    }
+
+    if (str == "And") {
+        return kAnd;
+        goto goto_label_type;
+    }
+
+    if (str == "Or") {
+        return kOr;
+        goto goto_label_type;
+    }
+
+    if (str == "Xor") {
+        return kXor;
+        goto goto_label_type;
+    }
+
+    if (str == "Constant") {
+        return kConstant;
+        goto goto_label_type;
+    }
+
+    if (str == "ConstantOfShape") {
+        return kConstantOfShape;
+        goto goto_label_type;
+    }
+
+    if (str == "ConstantLike") {
+        return kConstantLike;
+        goto goto_label_type;
+    }
+
+    if (str == "ConstantFill") {
+        return kConstantFill;
+        goto goto_label_type;
+    }
+
+    if (str == "OneHot") {
+        return kOneHot;
+        goto goto_label_type;
+    }
+
+    if (str == "Cast") {
+        return kCast;
+        goto goto_label_type;
+    }
+
+    if (str == "Shape") {
+        return kShape;
+        goto goto_label_type;
+    }
+
+    if (str == "Size") {
+        return kSize;
+        goto goto_label_type;
+    }
+
+    if (str == "Reshape") {
+        return kReshape;
+        goto goto_label_type;
+    }
+
+    if (str == "Expand") {
+        return kExpand;
+        goto goto_label_type;
+    }
+
+    if (str == "Squeeze") {
+        return kSqueeze;
+        goto goto_label_type;
+    }
+
+    if (str == "Unsqueeze") {
+        return kUnsqueeze;
+        goto goto_label_type;
+    }
+
+    if (str == "Flatten") {
+        return kFlatten;
+        goto goto_label_type;
+    }
+
+    if (str == "Slice") {
+        return kSlice;
+        goto goto_label_type;
+    }
+
+    if (str == "DynamicSlice") {
+        return kDynamicSlice;
+        goto goto_label_type;
+    }
+
+    if (str == "Gather") {
+        return kGather;
+        goto goto_label_type;
+    }
+
+    if (str == "Concat") {
+        return kConcat;
+        goto goto_label_type;
+    }
+
+    if (str == "Split") {
+        return kSplit;
+        goto goto_label_type;
+    }
+
+    if (str == "Transpose") {
+        return kTranspose;
+        goto goto_label_type;
+    }
+
+    if (str == "EyeLike") {
+        return kEyeLike;
+        goto goto_label_type;
+    }
+
+    if (str == "DepthToSpace") {
+        return kDepthToSpace;
+        goto goto_label_type;
+    }
+
+    if (str == "SpaceToDepth") {
+        return kSpaceToDepth;
+        goto goto_label_type;
+    }
+
+    if (str == "Sum") {
+        return kSum;
+        goto goto_label_type;
+    }
+
+    if (str == "Mean") {
+        return kMean;
+        goto goto_label_type;
+    }
+
+    if (str == "Max") {
+        return kMax;
+        goto goto_label_type;
+    }
+
+    if (str == "Min") {
+        return kMin;
+        goto goto_label_type;
+    }
+
+    if (str == "Clip") {
+        return kClip;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceSum") {
+        return kReduceSum;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceSumSquare") {
+        return kReduceSumSquare;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceMean") {
+        return kReduceMean;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceMax") {
+        return kReduceMax;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceMin") {
+        return kReduceMin;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceL1") {
+        return kReduceL1;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceL2") {
+        return kReduceL2;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceLogSum") {
+        return kReduceLogSum;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceLogSumExp") {
+        return kReduceLogSumExp;
+        goto goto_label_type;
+    }
+
+    if (str == "ReduceProd") {
+        return kReduceProd;
+        goto goto_label_type;
+    }
+
+    if (str == "ArgMax") {
+        return kArgMax;
+        goto goto_label_type;
+    }
+
+    if (str == "ArgMin") {
+        return kArgMin;
+        goto goto_label_type;
+    }
+
+    if (str == "Hardmax") {
+        return kHardmax;
+        goto goto_label_type;
+    }
+
+    if (str == "Dropout") {
+        return kDropout;
+        goto goto_label_type;
+    }
+
+    if (str == "MatMul") {
+        return kMatMul;
+        goto goto_label_type;
+    }
+
+    if (str == "Gemm") {
+        return kGemm;
+        goto goto_label_type;
+    }
+
+    if (str == "RNN") {
+        return kRNN;
+        goto goto_label_type;
+    }
+
+    if (str == "GRU") {
+        return kGRU;
+        goto goto_label_type;
+    }
+
+    if (str == "LSTM") {
+        return kLSTM;
+        goto goto_label_type;
+    }
+
+    if (str == "Conv") {
+        return kConv;
+        goto goto_label_type;
+    }
+
+    if (str == "ConvTranspose") {
+        return kConvTranspose;
+        goto goto_label_type;
+    }
+
+    if (str == "BatchNormalization") {
+        return kBatchNormalization;
+        goto goto_label_type;
+    }
+
+    if (str == "LRN") {
+        return kLRN;
+        goto goto_label_type;
+    }
+
+    if (str == "LpNormalization") {
+        return kLpNormalization;
+        goto goto_label_type;
+    }
+
+    if (str == "MaxPool") {
+        return kMaxPool;
+        goto goto_label_type;
+    }
+
+    if (str == "AveragePool") {
+        return kAveragePool;
+        goto goto_label_type;
+    }
+
+    if (str == "GlobalMaxPool") {
+        return kGlobalMaxPool;
+        goto goto_label_type;
+    }
+
+    if (str == "GlobalAveragePool") {
+        return kGlobalAveragePool;
+        goto goto_label_type;
+    }
+
+    if (str == "Pad") {
+        return kPad;
+        goto goto_label_type;
+    }
+
+    if (str == "Upsample") {
+        return kUpsample;
+        goto goto_label_type;
+    }
+
+    if (str == "Resize") {
+        return kResize;
+        goto goto_label_type;
+    }
+
+    if (str == "Softmax") {
+        return kSoftmax;
+        goto goto_label_type;
+    }
+
+    if (str == "LogSoftmax") {
+        return kLogSoftmax;
+        goto goto_label_type;
+    }
+
+    if (str == "If") {
+        return kIf;
+        goto goto_label_type;
+    }
+
+    if (str == "Loop") {
+        return kLoop;
+        goto goto_label_type;
+    }
+
+    if (str == "Where") {
+        return kWhere;
+        goto goto_label_type;
+    }
+
+    if (str == "ImageScaler") {
+        return kImageScaler;
+        goto goto_label_type;
+    }
+
+    if (str == "MaxRoiPool") {
+        return kMaxRoiPool;
+        goto goto_label_type;
+    }
+
+    if (str == "NonMaxSuppression") {
+        return kNonMaxSuppression;
+        goto goto_label_type;
+    }
+
+    if (str == "RoiAlign") {
+        return kRoiAlign;
+        goto goto_label_type;
+    }
+
+    if (str == "QuantizeLinear") {
+        return kQuantizeLinear;
+        goto goto_label_type;
+    }
+
+    if (str == "DequantizeLinear") {
+        return kDequantizeLinear;
+        goto goto_label_type;
+    }
+
+    if (str == "QLinearConv") {
+        return kQLinearConv;
+        goto goto_label_type;
+    }
+
+    if (str == "QLinearMatMul") {
+        return kQLinearMatMul;
+        goto goto_label_type;
+    }
+
+    if (str == "MatMulInteger") {
+        return kMatMulInteger;
+        goto goto_label_type;
+    }
+
+    if (str == "ConvInteger") {
+        return kConvInteger;
+        goto goto_label_type;
+    }
+
+    if (str == "Round") {
+        return kRound;
+        goto goto_label_type;
+    }
+
+    if (str == "BitShift") {
+        return kBitShift;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerLinear") {
+        return kChainerLinear;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerLinearGradWeight") {
+        return kChainerLinearGradWeight;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerReluGrad") {
+        return kChainerReluGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerReduceSumTo") {
+        return kChainerReduceSumTo;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIMaxPool2D") {
+        return kChainerROIMaxPool2D;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIAveragePool2D") {
+        return kChainerROIAveragePool2D;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIMaxAlign2D") {
+        return kChainerROIMaxAlign2D;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIAverageAlign2D") {
+        return kChainerROIAverageAlign2D;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerResizeImages") {
+        return kChainerResizeImages;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerPadBatchSize") {
+        return kChainerPadBatchSize;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerDoSomething") {
+        return kChainerDoSomething;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerMaxPoolGrad") {
+        return kChainerMaxPoolGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerAveragePoolGrad") {
+        return kChainerAveragePoolGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerResizeGrad") {
+        return kChainerResizeGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIMaxPool2DGrad") {
+        return kChainerROIMaxPool2DGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIAveragePool2DGrad") {
+        return kChainerROIAveragePool2DGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIMaxAlign2DGrad") {
+        return kChainerROIMaxAlign2DGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerROIAverageAlign2DGrad") {
+        return kChainerROIAverageAlign2DGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerBatchNormalizationGrad") {
+        return kChainerBatchNormalizationGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerConvTransposeWithDynamicOutputShape") {
+        return kChainerConvTransposeWithDynamicOutputShape;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSoftmaxCrossEntropy") {
+        return kChainerSoftmaxCrossEntropy;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSelectItem") {
+        return kChainerSelectItem;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSelectItemGrad") {
+        return kChainerSelectItemGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerLRNGrad") {
+        return kChainerLRNGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerLSTMGrad") {
+        return kChainerLSTMGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerConvGradWeight") {
+        return kChainerConvGradWeight;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGatherGrad") {
+        return kChainerGatherGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerConcatGrad") {
+        return kChainerConcatGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerDynamicSliceGrad") {
+        return kChainerDynamicSliceGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerFusionGroup") {
+        return kChainerFusionGroup;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGetItem") {
+        return kChainerGetItem;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGetItemGrad") {
+        return kChainerGetItemGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerPrint") {
+        return kChainerPrint;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerNullConstant") {
+        return kChainerNullConstant;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceConstants") {
+        return kChainerSequenceConstants;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceCreate") {
+        return kChainerSequenceCreate;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceAppend") {
+        return kChainerSequenceAppend;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceExtend") {
+        return kChainerSequenceExtend;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequencePop") {
+        return kChainerSequencePop;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceLookup") {
+        return kChainerSequenceLookup;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceGetSlice") {
+        return kChainerSequenceGetSlice;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceStack") {
+        return kChainerSequenceStack;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceConcat") {
+        return kChainerSequenceConcat;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceSplitAxis") {
+        return kChainerSequenceSplitAxis;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequencePad") {
+        return kChainerSequencePad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceSeparate") {
+        return kChainerSequenceSeparate;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceUnpad") {
+        return kChainerSequenceUnpad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceSize") {
+        return kChainerSequenceSize;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceLengths") {
+        return kChainerSequenceLengths;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceRange") {
+        return kChainerSequenceRange;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceLookupGrad") {
+        return kChainerSequenceLookupGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerSequenceGetSliceGrad") {
+        return kChainerSequenceGetSliceGrad;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericLen") {
+        return kChainerGenericLen;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericGetItem") {
+        return kChainerGenericGetItem;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericGetSlice") {
+        return kChainerGenericGetSlice;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericAdd") {
+        return kChainerGenericAdd;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericIs") {
+        return kChainerGenericIs;
+        goto goto_label_type;
+    }
+
+    if (str == "ChainerGenericAccumulateGrad") {
+        return kChainerGenericAccumulateGrad;
+        goto goto_label_type;
+    }
+
+    CHECK(false) << "Unsupported op_type: " << str;
+    goto_label_type:;
+}
+NodeBase::NodeBase(OpType op_type) : op_type_(op_type) {}
+NodeBase::NodeBase(const onnx::NodeProto& xnode, const std::vector<Value*>& inputs, const std::vector<Value*>& outputs) {
+    op_type_ = StringToOpType(xnode.op_type());
+    SetDefaultAttributeValues();
+    ValidateNumInputsOutputs(inputs, outputs);
+
+    // Validate attributes.
+    switch (op_type_) {
+        case kIdentity: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Identity;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Identity;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Identity:;
+            }
+
+            break;
+        }
+
+        case kNeg: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Neg;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Neg;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Neg:;
+            }
+
+            break;
+        }
+
+        case kReciprocal: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Reciprocal;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Reciprocal;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Reciprocal:;
+            }
+
+            break;
+        }
+
+        case kExp: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Exp;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Exp;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Exp:;
+            }
+
+            break;
+        }
+
+        case kLog: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Log;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Log;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Log:;
+            }
+
+            break;
+        }
+
+        case kSqrt: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sqrt;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sqrt;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sqrt:;
+            }
+
+            break;
+        }
+
+        case kIsNaN: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_IsNaN;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_IsNaN;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_IsNaN:;
+            }
+
+            break;
+        }
+
+        case kIsInf: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_IsInf;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_IsInf;
+                }
+
+                if (xattr.name() == "detect_negative") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_detect_negative(xattr.i());
+                    was_detect_negative_set_ = true;
+                    goto goto_label_IsInf;
+                }
+
+                if (xattr.name() == "detect_positive") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_detect_positive(xattr.i());
+                    was_detect_positive_set_ = true;
+                    goto goto_label_IsInf;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_IsInf:;
+            }
+
+            break;
+        }
+
+        case kSign: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sign;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sign;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sign:;
+            }
+
+            break;
+        }
+
+        case kSin: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sin;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sin;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sin:;
+            }
+
+            break;
+        }
+
+        case kSinh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sinh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sinh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sinh:;
+            }
+
+            break;
+        }
+
+        case kCos: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Cos;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Cos;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Cos:;
+            }
+
+            break;
+        }
+
+        case kCosh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Cosh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Cosh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Cosh:;
+            }
+
+            break;
+        }
+
+        case kTan: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Tan;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Tan;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Tan:;
+            }
+
+            break;
+        }
+
+        case kTanh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Tanh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Tanh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Tanh:;
+            }
+
+            break;
+        }
+
+        case kAsin: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Asin;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Asin;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Asin:;
+            }
+
+            break;
+        }
+
+        case kAsinh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Asinh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Asinh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Asinh:;
+            }
+
+            break;
+        }
+
+        case kAcos: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Acos;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Acos;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Acos:;
+            }
+
+            break;
+        }
+
+        case kAcosh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Acosh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Acosh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Acosh:;
+            }
+
+            break;
+        }
+
+        case kAtan: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Atan;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Atan;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Atan:;
+            }
+
+            break;
+        }
+
+        case kAtanh: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Atanh;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Atanh;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Atanh:;
+            }
+
+            break;
+        }
+
+        case kErf: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Erf;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Erf;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Erf:;
+            }
+
+            break;
+        }
+
+        case kAbs: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Abs;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Abs;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Abs:;
+            }
+
+            break;
+        }
+
+        case kRelu: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Relu;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Relu;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Relu:;
+            }
+
+            break;
+        }
+
+        case kSelu: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_Selu;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Selu;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Selu;
+                }
+
+                if (xattr.name() == "gamma") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_gamma(xattr.f());
+                    was_gamma_set_ = true;
+                    goto goto_label_Selu;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Selu:;
+            }
+
+            break;
+        }
+
+        case kLeakyRelu: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_LeakyRelu;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_LeakyRelu;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_LeakyRelu;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_LeakyRelu:;
+            }
+
+            break;
+        }
+
+        case kElu: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_Elu;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Elu;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Elu;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Elu:;
+            }
+
+            break;
+        }
+
+        case kSigmoid: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sigmoid;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sigmoid;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sigmoid:;
+            }
+
+            break;
+        }
+
+        case kNot: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Not;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Not;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Not:;
+            }
+
+            break;
+        }
+
+        case kFloor: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Floor;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Floor;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Floor:;
+            }
+
+            break;
+        }
+
+        case kCeil: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Ceil;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Ceil;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Ceil:;
+            }
+
+            break;
+        }
+
+        case kSoftplus: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Softplus;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Softplus;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Softplus:;
+            }
+
+            break;
+        }
+
+        case kSoftsign: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Softsign;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Softsign;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Softsign:;
+            }
+
+            break;
+        }
+
+        case kAdd: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Add;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Add;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Add:;
+            }
+
+            break;
+        }
+
+        case kSub: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sub;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sub;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sub:;
+            }
+
+            break;
+        }
+
+        case kMul: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Mul;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Mul;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Mul:;
+            }
+
+            break;
+        }
+
+        case kDiv: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Div;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Div;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Div:;
+            }
+
+            break;
+        }
+
+        case kPow: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Pow;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Pow;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Pow:;
+            }
+
+            break;
+        }
+
+        case kEqual: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Equal;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Equal;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Equal:;
+            }
+
+            break;
+        }
+
+        case kGreater: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Greater;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Greater;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Greater:;
+            }
+
+            break;
+        }
+
+        case kLess: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Less;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Less;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Less:;
+            }
+
+            break;
+        }
+
+        case kAnd: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_And;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_And;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_And:;
+            }
+
+            break;
+        }
+
+        case kOr: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Or;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Or;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Or:;
+            }
+
+            break;
+        }
+
+        case kXor: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Xor;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Xor;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Xor:;
+            }
+
+            break;
+        }
+
+        case kConstant: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Constant;
+                }
+
+                if (xattr.name() == "chainer_host") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_host(xattr.i() != 0);
+                    was_chainer_host_set_ = true;
+                    goto goto_label_Constant;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Constant;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::TENSOR) << xnode.DebugString();
+                    set_tensor_value(new Tensor(xattr.t()));
+                    was_tensor_value_set_ = true;
+                    goto goto_label_Constant;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Constant:;
+            }
+
+            break;
+        }
+
+        case kConstantOfShape: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ConstantOfShape;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ConstantOfShape;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::TENSOR) << xnode.DebugString();
+                    set_tensor_value(new Tensor(xattr.t()));
+                    was_tensor_value_set_ = true;
+                    goto goto_label_ConstantOfShape;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ConstantOfShape:;
+            }
+
+            break;
+        }
+
+        case kConstantLike: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ConstantLike;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ConstantLike;
+                }
+
+                if (xattr.name() == "dtype") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_dtype(Dtype(onnx::TensorProto::DataType(xattr.i())));
+                    was_dtype_set_ = true;
+                    goto goto_label_ConstantLike;
+                }
+
+                if (xattr.name() == "shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_shape_set_ = true;
+                    goto goto_label_ConstantLike;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_value(xattr.f());
+                    was_value_set_ = true;
+                    goto goto_label_ConstantLike;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ConstantLike:;
+            }
+
+            break;
+        }
+
+        case kConstantFill: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "dtype") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_dtype(Dtype(onnx::TensorProto::DataType(xattr.i())));
+                    was_dtype_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "extra_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    extra_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_extra_shape_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "input_as_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_input_as_shape(xattr.i());
+                    was_input_as_shape_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_shape_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_value(xattr.f());
+                    was_value_set_ = true;
+                    goto goto_label_ConstantFill;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ConstantFill:;
+            }
+
+            break;
+        }
+
+        case kOneHot: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_OneHot;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_OneHot;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_OneHot;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_OneHot:;
+            }
+
+            break;
+        }
+
+        case kCast: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Cast;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Cast;
+                }
+
+                if (xattr.name() == "to") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_to(Dtype(onnx::TensorProto::DataType(xattr.i())));
+                    was_to_set_ = true;
+                    goto goto_label_Cast;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Cast:;
+            }
+
+            break;
+        }
+
+        case kShape: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Shape;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Shape;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Shape:;
+            }
+
+            break;
+        }
+
+        case kSize: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Size;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Size;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Size:;
+            }
+
+            break;
+        }
+
+        case kReshape: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Reshape;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Reshape;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Reshape:;
+            }
+
+            break;
+        }
+
+        case kExpand: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Expand;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Expand;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Expand:;
+            }
+
+            break;
+        }
+
+        case kSqueeze: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_Squeeze;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Squeeze;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Squeeze;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Squeeze:;
+            }
+
+            break;
+        }
+
+        case kUnsqueeze: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_Unsqueeze;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Unsqueeze;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Unsqueeze;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Unsqueeze:;
+            }
+
+            break;
+        }
+
+        case kFlatten: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Flatten;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Flatten;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Flatten;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Flatten:;
+            }
+
+            break;
+        }
+
+        case kSlice: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_Slice;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Slice;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Slice;
+                }
+
+                if (xattr.name() == "ends") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    ends_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_ends_set_ = true;
+                    goto goto_label_Slice;
+                }
+
+                if (xattr.name() == "starts") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    starts_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_starts_set_ = true;
+                    goto goto_label_Slice;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Slice:;
+            }
+
+            break;
+        }
+
+        case kDynamicSlice: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_DynamicSlice;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_DynamicSlice;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_DynamicSlice:;
+            }
+
+            break;
+        }
+
+        case kGather: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Gather;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Gather;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Gather;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Gather:;
+            }
+
+            break;
+        }
+
+        case kConcat: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Concat;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Concat;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Concat;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Concat:;
+            }
+
+            break;
+        }
+
+        case kSplit: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Split;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Split;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Split;
+                }
+
+                if (xattr.name() == "split") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    split_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_split_set_ = true;
+                    goto goto_label_Split;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Split:;
+            }
+
+            break;
+        }
+
+        case kTranspose: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Transpose;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Transpose;
+                }
+
+                if (xattr.name() == "perm") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    perm_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_perm_set_ = true;
+                    goto goto_label_Transpose;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Transpose:;
+            }
+
+            break;
+        }
+
+        case kEyeLike: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_EyeLike;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_EyeLike;
+                }
+
+                if (xattr.name() == "dtype") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_dtype(Dtype(onnx::TensorProto::DataType(xattr.i())));
+                    was_dtype_set_ = true;
+                    goto goto_label_EyeLike;
+                }
+
+                if (xattr.name() == "k") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_k(xattr.i());
+                    was_k_set_ = true;
+                    goto goto_label_EyeLike;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_EyeLike:;
+            }
+
+            break;
+        }
+
+        case kDepthToSpace: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "blocksize") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_blocksize(xattr.i());
+                    was_blocksize_set_ = true;
+                    goto goto_label_DepthToSpace;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_DepthToSpace;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_DepthToSpace;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_DepthToSpace:;
+            }
+
+            break;
+        }
+
+        case kSpaceToDepth: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "blocksize") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_blocksize(xattr.i());
+                    was_blocksize_set_ = true;
+                    goto goto_label_SpaceToDepth;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_SpaceToDepth;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_SpaceToDepth;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_SpaceToDepth:;
+            }
+
+            break;
+        }
+
+        case kSum: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Sum;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Sum;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Sum:;
+            }
+
+            break;
+        }
+
+        case kMean: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Mean;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Mean;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Mean:;
+            }
+
+            break;
+        }
+
+        case kMax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Max;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Max;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Max:;
+            }
+
+            break;
+        }
+
+        case kMin: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Min;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Min;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Min:;
+            }
+
+            break;
+        }
+
+        case kClip: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Clip;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Clip;
+                }
+
+                if (xattr.name() == "max") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_max(xattr.f());
+                    was_max_set_ = true;
+                    goto goto_label_Clip;
+                }
+
+                if (xattr.name() == "min") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_min(xattr.f());
+                    was_min_set_ = true;
+                    goto goto_label_Clip;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Clip:;
+            }
+
+            break;
+        }
+
+        case kReduceSum: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceSum;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceSum;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceSum;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceSum;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceSum:;
+            }
+
+            break;
+        }
+
+        case kReduceSumSquare: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceSumSquare;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceSumSquare;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceSumSquare;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceSumSquare;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceSumSquare:;
+            }
+
+            break;
+        }
+
+        case kReduceMean: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceMean;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceMean;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceMean;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceMean;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceMean:;
+            }
+
+            break;
+        }
+
+        case kReduceMax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceMax;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceMax;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceMax;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceMax;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceMax:;
+            }
+
+            break;
+        }
+
+        case kReduceMin: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceMin;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceMin;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceMin;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceMin;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceMin:;
+            }
+
+            break;
+        }
+
+        case kReduceL1: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceL1;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceL1;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceL1;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceL1;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceL1:;
+            }
+
+            break;
+        }
+
+        case kReduceL2: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceL2;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceL2;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceL2;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceL2;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceL2:;
+            }
+
+            break;
+        }
+
+        case kReduceLogSum: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceLogSum;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceLogSum;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceLogSum;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceLogSum;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceLogSum:;
+            }
+
+            break;
+        }
+
+        case kReduceLogSumExp: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceLogSumExp;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceLogSumExp;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceLogSumExp;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceLogSumExp;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceLogSumExp:;
+            }
+
+            break;
+        }
+
+        case kReduceProd: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    axes_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_axes_set_ = true;
+                    goto goto_label_ReduceProd;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ReduceProd;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ReduceProd;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ReduceProd;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ReduceProd:;
+            }
+
+            break;
+        }
+
+        case kArgMax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ArgMax;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ArgMax;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ArgMax;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ArgMax;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ArgMax:;
+            }
+
+            break;
+        }
+
+        case kArgMin: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ArgMin;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ArgMin;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ArgMin;
+                }
+
+                if (xattr.name() == "keepdims") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_keepdims(xattr.i() != 0);
+                    was_keepdims_set_ = true;
+                    goto goto_label_ArgMin;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ArgMin:;
+            }
+
+            break;
+        }
+
+        case kHardmax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Hardmax;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Hardmax;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Hardmax;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Hardmax:;
+            }
+
+            break;
+        }
+
+        case kDropout: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Dropout;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Dropout;
+                }
+
+                if (xattr.name() == "ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_ratio(xattr.f());
+                    was_ratio_set_ = true;
+                    goto goto_label_Dropout;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Dropout:;
+            }
+
+            break;
+        }
+
+        case kMatMul: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_MatMul;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_MatMul;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_MatMul:;
+            }
+
+            break;
+        }
+
+        case kGemm: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (xattr.name() == "beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_beta(xattr.f());
+                    was_beta_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (xattr.name() == "transA") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_trans_a(xattr.i() != 0);
+                    was_trans_a_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (xattr.name() == "transB") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_trans_b(xattr.i() != 0);
+                    was_trans_b_set_ = true;
+                    goto goto_label_Gemm;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Gemm:;
+            }
+
+            break;
+        }
+
+        case kRNN: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "activation_alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_alpha_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_alpha_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "activation_beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_beta_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_beta_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "activations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRINGS) << xnode.DebugString();
+                    activations_.assign(xattr.strings().begin(), xattr.strings().end());
+                    was_activations_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "clip") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_clip(xattr.f());
+                    was_clip_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "direction") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_direction(xattr.s());
+                    was_direction_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (xattr.name() == "hidden_size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_hidden_size(xattr.i());
+                    was_hidden_size_set_ = true;
+                    goto goto_label_RNN;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_RNN:;
+            }
+
+            break;
+        }
+
+        case kGRU: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "activation_alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_alpha_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_alpha_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "activation_beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_beta_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_beta_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "activations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRINGS) << xnode.DebugString();
+                    activations_.assign(xattr.strings().begin(), xattr.strings().end());
+                    was_activations_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "clip") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_clip(xattr.f());
+                    was_clip_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "direction") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_direction(xattr.s());
+                    was_direction_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "hidden_size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_hidden_size(xattr.i());
+                    was_hidden_size_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (xattr.name() == "linear_before_reset") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_linear_before_reset(xattr.i());
+                    was_linear_before_reset_set_ = true;
+                    goto goto_label_GRU;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_GRU:;
+            }
+
+            break;
+        }
+
+        case kLSTM: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "activation_alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_alpha_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_alpha_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "activation_beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    activation_beta_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_activation_beta_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "activations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRINGS) << xnode.DebugString();
+                    activations_.assign(xattr.strings().begin(), xattr.strings().end());
+                    was_activations_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "clip") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_clip(xattr.f());
+                    was_clip_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "direction") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_direction(xattr.s());
+                    was_direction_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "hidden_size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_hidden_size(xattr.i());
+                    was_hidden_size_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (xattr.name() == "input_forget") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_input_forget(xattr.i());
+                    was_input_forget_set_ = true;
+                    goto goto_label_LSTM;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_LSTM:;
+            }
+
+            break;
+        }
+
+        case kConv: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_Conv;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Conv:;
+            }
+
+            break;
+        }
+
+        case kConvTranspose: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "output_padding") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_padding_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_padding_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ConvTranspose;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ConvTranspose:;
+            }
+
+            break;
+        }
+
+        case kBatchNormalization: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (xattr.name() == "chainer_in_recomputing") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_in_recomputing(xattr.i());
+                    was_chainer_in_recomputing_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (xattr.name() == "epsilon") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_epsilon(xattr.f());
+                    was_epsilon_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (xattr.name() == "momentum") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_momentum(xattr.f());
+                    was_momentum_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (xattr.name() == "spatial") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_spatial(xattr.i());
+                    was_spatial_set_ = true;
+                    goto goto_label_BatchNormalization;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_BatchNormalization:;
+            }
+
+            break;
+        }
+
+        case kLRN: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (xattr.name() == "beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_beta(xattr.f());
+                    was_beta_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (xattr.name() == "bias") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_bias(xattr.f());
+                    was_bias_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (xattr.name() == "size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_size(xattr.i());
+                    was_size_set_ = true;
+                    goto goto_label_LRN;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_LRN:;
+            }
+
+            break;
+        }
+
+        case kLpNormalization: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_LpNormalization;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_LpNormalization;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_LpNormalization;
+                }
+
+                if (xattr.name() == "p") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_p(xattr.i());
+                    was_p_set_ = true;
+                    goto goto_label_LpNormalization;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_LpNormalization:;
+            }
+
+            break;
+        }
+
+        case kMaxPool: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "chainer_cover_all") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_cover_all(xattr.i() != 0);
+                    was_chainer_cover_all_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "storage_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_storage_order(xattr.i());
+                    was_storage_order_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_MaxPool;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_MaxPool:;
+            }
+
+            break;
+        }
+
+        case kAveragePool: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "count_include_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_count_include_pad(xattr.i() != 0);
+                    was_count_include_pad_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "storage_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_storage_order(xattr.i());
+                    was_storage_order_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_AveragePool;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_AveragePool:;
+            }
+
+            break;
+        }
+
+        case kGlobalMaxPool: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_GlobalMaxPool;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_GlobalMaxPool;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_GlobalMaxPool:;
+            }
+
+            break;
+        }
+
+        case kGlobalAveragePool: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_GlobalAveragePool;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_GlobalAveragePool;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_GlobalAveragePool:;
+            }
+
+            break;
+        }
+
+        case kPad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Pad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Pad;
+                }
+
+                if (xattr.name() == "mode") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_mode(xattr.s());
+                    was_mode_set_ = true;
+                    goto goto_label_Pad;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_Pad;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_value(xattr.f());
+                    was_value_set_ = true;
+                    goto goto_label_Pad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Pad:;
+            }
+
+            break;
+        }
+
+        case kUpsample: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Upsample;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Upsample;
+                }
+
+                if (xattr.name() == "height_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_height_scale(xattr.f());
+                    was_height_scale_set_ = true;
+                    goto goto_label_Upsample;
+                }
+
+                if (xattr.name() == "mode") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_mode(xattr.s());
+                    was_mode_set_ = true;
+                    goto goto_label_Upsample;
+                }
+
+                if (xattr.name() == "width_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_width_scale(xattr.f());
+                    was_width_scale_set_ = true;
+                    goto goto_label_Upsample;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Upsample:;
+            }
+
+            break;
+        }
+
+        case kResize: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Resize;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Resize;
+                }
+
+                if (xattr.name() == "mode") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_mode(xattr.s());
+                    was_mode_set_ = true;
+                    goto goto_label_Resize;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Resize:;
+            }
+
+            break;
+        }
+
+        case kSoftmax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_Softmax;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Softmax;
+                }
+
+                if (xattr.name() == "chainer_is_onnx_semantics") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_is_onnx_semantics(xattr.i() != 0);
+                    was_chainer_is_onnx_semantics_set_ = true;
+                    goto goto_label_Softmax;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Softmax;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Softmax:;
+            }
+
+            break;
+        }
+
+        case kLogSoftmax: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_LogSoftmax;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_LogSoftmax;
+                }
+
+                if (xattr.name() == "chainer_is_onnx_semantics") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_is_onnx_semantics(xattr.i() != 0);
+                    was_chainer_is_onnx_semantics_set_ = true;
+                    goto goto_label_LogSoftmax;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_LogSoftmax;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_LogSoftmax:;
+            }
+
+            break;
+        }
+
+        case kIf: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_If;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_If;
+                }
+
+                if (xattr.name() == "else_branch") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::GRAPH) << xnode.DebugString();
+                    set_else_branch(new Graph(xattr.g()));
+                    was_else_branch_set_ = true;
+                    goto goto_label_If;
+                }
+
+                if (xattr.name() == "then_branch") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::GRAPH) << xnode.DebugString();
+                    set_then_branch(new Graph(xattr.g()));
+                    was_then_branch_set_ = true;
+                    goto goto_label_If;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_If:;
+            }
+
+            break;
+        }
+
+        case kLoop: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "body") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::GRAPH) << xnode.DebugString();
+                    set_body(new Graph(xattr.g()));
+                    was_body_set_ = true;
+                    goto goto_label_Loop;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Loop;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Loop;
+                }
+
+                if (xattr.name() == "chainer_stack_axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_stack_axis(xattr.i());
+                    was_chainer_stack_axis_set_ = true;
+                    goto goto_label_Loop;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Loop:;
+            }
+
+            break;
+        }
+
+        case kWhere: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Where;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Where;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Where:;
+            }
+
+            break;
+        }
+
+        case kImageScaler: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "bias") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOATS) << xnode.DebugString();
+                    bias_list_.assign(xattr.floats().begin(), xattr.floats().end());
+                    was_bias_list_set_ = true;
+                    goto goto_label_ImageScaler;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ImageScaler;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ImageScaler;
+                }
+
+                if (xattr.name() == "scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_scale(xattr.f());
+                    was_scale_set_ = true;
+                    goto goto_label_ImageScaler;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ImageScaler:;
+            }
+
+            break;
+        }
+
+        case kMaxRoiPool: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_MaxRoiPool;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_MaxRoiPool;
+                }
+
+                if (xattr.name() == "pooled_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pooled_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pooled_shape_set_ = true;
+                    goto goto_label_MaxRoiPool;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_MaxRoiPool;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_MaxRoiPool:;
+            }
+
+            break;
+        }
+
+        case kNonMaxSuppression: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "center_point_box") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_center_point_box(xattr.i());
+                    was_center_point_box_set_ = true;
+                    goto goto_label_NonMaxSuppression;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_NonMaxSuppression;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_NonMaxSuppression;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_NonMaxSuppression:;
+            }
+
+            break;
+        }
+
+        case kRoiAlign: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "mode") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_mode(xattr.s());
+                    was_mode_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "output_height") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_output_height(xattr.i());
+                    was_output_height_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "output_width") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_output_width(xattr.i());
+                    was_output_width_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "sampling_ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_sampling_ratio(xattr.i());
+                    was_sampling_ratio_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_RoiAlign;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_RoiAlign:;
+            }
+
+            break;
+        }
+
+        case kQuantizeLinear: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_QuantizeLinear;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_QuantizeLinear;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_QuantizeLinear:;
+            }
+
+            break;
+        }
+
+        case kDequantizeLinear: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_DequantizeLinear;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_DequantizeLinear;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_DequantizeLinear:;
+            }
+
+            break;
+        }
+
+        case kQLinearConv: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_QLinearConv;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_QLinearConv:;
+            }
+
+            break;
+        }
+
+        case kQLinearMatMul: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_QLinearMatMul;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_QLinearMatMul;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_QLinearMatMul:;
+            }
+
+            break;
+        }
+
+        case kMatMulInteger: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_MatMulInteger;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_MatMulInteger;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_MatMulInteger:;
+            }
+
+            break;
+        }
+
+        case kConvInteger: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ConvInteger;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ConvInteger:;
+            }
+
+            break;
+        }
+
+        case kRound: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_Round;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_Round;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_Round:;
+            }
+
+            break;
+        }
+
+        case kBitShift: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_BitShift;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_BitShift;
+                }
+
+                if (xattr.name() == "direction") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_direction(xattr.s());
+                    was_direction_set_ = true;
+                    goto goto_label_BitShift;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_BitShift:;
+            }
+
+            break;
+        }
+
+        case kChainerLinear: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerLinear;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerLinear;
+                }
+
+                if (xattr.name() == "n_batch_axes") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_n_batch_axes(xattr.i());
+                    was_n_batch_axes_set_ = true;
+                    goto goto_label_ChainerLinear;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerLinear:;
+            }
+
+            break;
+        }
+
+        case kChainerLinearGradWeight: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerLinearGradWeight;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerLinearGradWeight;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerLinearGradWeight:;
+            }
+
+            break;
+        }
+
+        case kChainerReluGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerReluGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerReluGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerReluGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerReduceSumTo: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerReduceSumTo;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerReduceSumTo;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerReduceSumTo:;
+            }
+
+            break;
+        }
+
+        case kChainerROIMaxPool2D: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2D;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2D;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2D;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2D;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIMaxPool2D:;
+            }
+
+            break;
+        }
+
+        case kChainerROIAveragePool2D: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2D;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2D;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2D;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2D;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIAveragePool2D:;
+            }
+
+            break;
+        }
+
+        case kChainerROIMaxAlign2D: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2D;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2D;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2D;
+                }
+
+                if (xattr.name() == "sampling_ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    sampling_ratio_list_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_sampling_ratio_list_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2D;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2D;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIMaxAlign2D:;
+            }
+
+            break;
+        }
+
+        case kChainerROIAverageAlign2D: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2D;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2D;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2D;
+                }
+
+                if (xattr.name() == "sampling_ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    sampling_ratio_list_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_sampling_ratio_list_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2D;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2D;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIAverageAlign2D:;
+            }
+
+            break;
+        }
+
+        case kChainerResizeImages: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerResizeImages;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerResizeImages;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerResizeImages;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerResizeImages:;
+            }
+
+            break;
+        }
+
+        case kChainerPadBatchSize: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerPadBatchSize;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerPadBatchSize;
+                }
+
+                if (xattr.name() == "size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_size(xattr.i());
+                    was_size_set_ = true;
+                    goto goto_label_ChainerPadBatchSize;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerPadBatchSize:;
+            }
+
+            break;
+        }
+
+        case kChainerDoSomething: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerDoSomething;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerDoSomething;
+                }
+
+                if (xattr.name() == "function_name") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_function_name(xattr.s());
+                    was_function_name_set_ = true;
+                    goto goto_label_ChainerDoSomething;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerDoSomething:;
+            }
+
+            break;
+        }
+
+        case kChainerMaxPoolGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "chainer_cover_all") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_cover_all(xattr.i() != 0);
+                    was_chainer_cover_all_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "storage_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_storage_order(xattr.i());
+                    was_storage_order_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ChainerMaxPoolGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerMaxPoolGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerAveragePoolGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "count_include_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_count_include_pad(xattr.i() != 0);
+                    was_count_include_pad_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "storage_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_storage_order(xattr.i());
+                    was_storage_order_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ChainerAveragePoolGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerAveragePoolGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerResizeGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerResizeGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerResizeGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerResizeGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerROIMaxPool2DGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2DGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2DGrad;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2DGrad;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIMaxPool2DGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIMaxPool2DGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerROIAveragePool2DGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2DGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2DGrad;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2DGrad;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIAveragePool2DGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIAveragePool2DGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerROIMaxAlign2DGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2DGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2DGrad;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2DGrad;
+                }
+
+                if (xattr.name() == "sampling_ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    sampling_ratio_list_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_sampling_ratio_list_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2DGrad;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIMaxAlign2DGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIMaxAlign2DGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerROIAverageAlign2DGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2DGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2DGrad;
+                }
+
+                if (xattr.name() == "output_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    output_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_output_shape_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2DGrad;
+                }
+
+                if (xattr.name() == "sampling_ratio") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    sampling_ratio_list_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_sampling_ratio_list_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2DGrad;
+                }
+
+                if (xattr.name() == "spatial_scale") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_spatial_scale(xattr.f());
+                    was_spatial_scale_set_ = true;
+                    goto goto_label_ChainerROIAverageAlign2DGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerROIAverageAlign2DGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerBatchNormalizationGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerBatchNormalizationGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerBatchNormalizationGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerBatchNormalizationGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerConvTransposeWithDynamicOutputShape: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ChainerConvTransposeWithDynamicOutputShape;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerConvTransposeWithDynamicOutputShape:;
+            }
+
+            break;
+        }
+
+        case kChainerSoftmaxCrossEntropy: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSoftmaxCrossEntropy;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSoftmaxCrossEntropy;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSoftmaxCrossEntropy:;
+            }
+
+            break;
+        }
+
+        case kChainerSelectItem: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSelectItem;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSelectItem;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSelectItem:;
+            }
+
+            break;
+        }
+
+        case kChainerSelectItemGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSelectItemGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSelectItemGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSelectItemGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerLRNGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "alpha") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_alpha(xattr.f());
+                    was_alpha_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (xattr.name() == "beta") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_beta(xattr.f());
+                    was_beta_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (xattr.name() == "bias") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_bias(xattr.f());
+                    was_bias_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (xattr.name() == "size") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_size(xattr.i());
+                    was_size_set_ = true;
+                    goto goto_label_ChainerLRNGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerLRNGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerLSTMGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerLSTMGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerLSTMGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerLSTMGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerConvGradWeight: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "auto_pad") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_auto_pad(xattr.s());
+                    was_auto_pad_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "dilations") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    dilations_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_dilations_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_group(xattr.i());
+                    was_group_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "kernel_shape") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    kernel_shape_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_kernel_shape_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "pads") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    pads_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_pads_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (xattr.name() == "strides") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    strides_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_strides_set_ = true;
+                    goto goto_label_ChainerConvGradWeight;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerConvGradWeight:;
+            }
+
+            break;
+        }
+
+        case kChainerGatherGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerGatherGrad;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGatherGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGatherGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGatherGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerConcatGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerConcatGrad;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerConcatGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerConcatGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerConcatGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerDynamicSliceGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerDynamicSliceGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerDynamicSliceGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerDynamicSliceGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerFusionGroup: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerFusionGroup;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerFusionGroup;
+                }
+
+                if (xattr.name() == "fusion_type") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::STRING) << xnode.DebugString();
+                    set_fusion_type(xattr.s());
+                    was_fusion_type_set_ = true;
+                    goto goto_label_ChainerFusionGroup;
+                }
+
+                if (xattr.name() == "subgraph") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::GRAPH) << xnode.DebugString();
+                    set_subgraph(new Graph(xattr.g()));
+                    was_subgraph_set_ = true;
+                    goto goto_label_ChainerFusionGroup;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerFusionGroup:;
+            }
+
+            break;
+        }
+
+        case kChainerGetItem: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGetItem;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGetItem;
+                }
+
+                if (xattr.name() == "slice_specs") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    slice_specs_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_slice_specs_set_ = true;
+                    goto goto_label_ChainerGetItem;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGetItem:;
+            }
+
+            break;
+        }
+
+        case kChainerGetItemGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGetItemGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGetItemGrad;
+                }
+
+                if (xattr.name() == "slice_specs") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INTS) << xnode.DebugString();
+                    slice_specs_.assign(xattr.ints().begin(), xattr.ints().end());
+                    was_slice_specs_set_ = true;
+                    goto goto_label_ChainerGetItemGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGetItemGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerPrint: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerPrint;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerPrint;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerPrint:;
+            }
+
+            break;
+        }
+
+        case kChainerNullConstant: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerNullConstant;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerNullConstant;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerNullConstant:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceConstants: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceConstants;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceConstants;
+                }
+
+                if (xattr.name() == "tensor_values") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::TENSORS) << xnode.DebugString();
+                    for (const auto& t : xattr.tensors()) tensor_values_.emplace_back(new Tensor(t));
+                    was_tensor_values_set_ = true;
+                    goto goto_label_ChainerSequenceConstants;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceConstants:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceCreate: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceCreate;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceCreate;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceCreate:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceAppend: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceAppend;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceAppend;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceAppend:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceExtend: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceExtend;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceExtend;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceExtend:;
+            }
+
+            break;
+        }
+
+        case kChainerSequencePop: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequencePop;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequencePop;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequencePop:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceLookup: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceLookup;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceLookup;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceLookup:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceGetSlice: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceGetSlice;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceGetSlice;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceGetSlice:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceStack: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerSequenceStack;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceStack;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceStack;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceStack:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceConcat: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerSequenceConcat;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceConcat;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceConcat;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceConcat:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceSplitAxis: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerSequenceSplitAxis;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceSplitAxis;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceSplitAxis;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceSplitAxis:;
+            }
+
+            break;
+        }
+
+        case kChainerSequencePad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequencePad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequencePad;
+                }
+
+                if (xattr.name() == "length") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_length(xattr.i());
+                    was_length_set_ = true;
+                    goto goto_label_ChainerSequencePad;
+                }
+
+                if (xattr.name() == "value") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::FLOAT) << xnode.DebugString();
+                    set_value(xattr.f());
+                    was_value_set_ = true;
+                    goto goto_label_ChainerSequencePad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequencePad:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceSeparate: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "axis") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_axis(xattr.i());
+                    was_axis_set_ = true;
+                    goto goto_label_ChainerSequenceSeparate;
+                }
+
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceSeparate;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceSeparate;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceSeparate:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceUnpad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceUnpad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceUnpad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceUnpad:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceSize: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceSize;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceSize;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceSize:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceLengths: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceLengths;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceLengths;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceLengths:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceRange: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceRange;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceRange;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceRange:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceLookupGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceLookupGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceLookupGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceLookupGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerSequenceGetSliceGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerSequenceGetSliceGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerSequenceGetSliceGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerSequenceGetSliceGrad:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericLen: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericLen;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericLen;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericLen:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericGetItem: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericGetItem;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericGetItem;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericGetItem:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericGetSlice: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericGetSlice;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericGetSlice;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericGetSlice:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericAdd: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericAdd;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericAdd;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericAdd:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericIs: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericIs;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericIs;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericIs:;
+            }
+
+            break;
+        }
+
+        case kChainerGenericAccumulateGrad: {
+            for (const onnx::AttributeProto& xattr : xnode.attribute()) {
+                if (xattr.name() == "chainer_fusion_group") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_fusion_group(xattr.i());
+                    was_chainer_fusion_group_set_ = true;
+                    goto goto_label_ChainerGenericAccumulateGrad;
+                }
+
+                if (xattr.name() == "chainer_order") {
+                    if (!g_permissive) CHECK_EQ(xattr.type(), onnx::AttributeProto::INT) << xnode.DebugString();
+                    set_chainer_order(xattr.i());
+                    was_chainer_order_set_ = true;
+                    goto goto_label_ChainerGenericAccumulateGrad;
+                }
+
+                if (!g_permissive) CHECK(false) << "Invalid attribute `"<< xattr.name() << "' for " << OpTypeToString(op_type_);
+                unknown_attributes_.push_back(xattr);
+                goto_label_ChainerGenericAccumulateGrad:;
+            }
+
+            break;
+        }
+    }
+
+    ValidateAttributes();
+}
+
+const char* NodeBase::OpTypeToString(OpType op_type) {
+    switch (op_type) {
+        case NodeBase::kIdentity: return "Identity";
+        case NodeBase::kNeg: return "Neg";
+        case NodeBase::kReciprocal: return "Reciprocal";
+        case NodeBase::kExp: return "Exp";
+        case NodeBase::kLog: return "Log";
+        case NodeBase::kSqrt: return "Sqrt";
+        case NodeBase::kIsNaN: return "IsNaN";
+        case NodeBase::kIsInf: return "IsInf";
+        case NodeBase::kSign: return "Sign";
+        case NodeBase::kSin: return "Sin";
+        case NodeBase::kSinh: return "Sinh";
+        case NodeBase::kCos: return "Cos";
+        case NodeBase::kCosh: return "Cosh";
+        case NodeBase::kTan: return "Tan";
+        case NodeBase::kTanh: return "Tanh";
+        case NodeBase::kAsin: return "Asin";
+        case NodeBase::kAsinh: return "Asinh";
+        case NodeBase::kAcos: return "Acos";
+        case NodeBase::kAcosh: return "Acosh";
+        case NodeBase::kAtan: return "Atan";
+        case NodeBase::kAtanh: return "Atanh";
+        case NodeBase::kErf: return "Erf";
+        case NodeBase::kAbs: return "Abs";
+        case NodeBase::kRelu: return "Relu";
+        case NodeBase::kSelu: return "Selu";
+        case NodeBase::kLeakyRelu: return "LeakyRelu";
+        case NodeBase::kElu: return "Elu";
+        case NodeBase::kSigmoid: return "Sigmoid";
+        case NodeBase::kNot: return "Not";
+        case NodeBase::kFloor: return "Floor";
+        case NodeBase::kCeil: return "Ceil";
+        case NodeBase::kSoftplus: return "Softplus";
+        case NodeBase::kSoftsign: return "Softsign";
+        case NodeBase::kAdd: return "Add";
+        case NodeBase::kSub: return "Sub";
+        case NodeBase::kMul: return "Mul";
+        case NodeBase::kDiv: return "Div";
+        case NodeBase::kPow: return "Pow";
+        case NodeBase::kEqual: return "Equal";
+        case NodeBase::kGreater: return "Greater";
+        case NodeBase::kLess: return "Less";
+        case NodeBase::kAnd: return "And";
+        case NodeBase::kOr: return "Or";
+        case NodeBase::kXor: return "Xor";
+        case NodeBase::kConstant: return "Constant";
+        case NodeBase::kConstantOfShape: return "ConstantOfShape";
+        case NodeBase::kConstantLike: return "ConstantLike";
+        case NodeBase::kConstantFill: return "ConstantFill";
+        case NodeBase::kOneHot: return "OneHot";
+        case NodeBase::kCast: return "Cast";
+        case NodeBase::kShape: return "Shape";
+        case NodeBase::kSize: return "Size";
+        case NodeBase::kReshape: return "Reshape";
+        case NodeBase::kExpand: return "Expand";
+        case NodeBase::kSqueeze: return "Squeeze";
+        case NodeBase::kUnsqueeze: return "Unsqueeze";
+        case NodeBase::kFlatten: return "Flatten";
+        case NodeBase::kSlice: return "Slice";
+        case NodeBase::kDynamicSlice: return "DynamicSlice";
+        case NodeBase::kGather: return "Gather";
+        case NodeBase::kConcat: return "Concat";
+        case NodeBase::kSplit: return "Split";
+        case NodeBase::kTranspose: return "Transpose";
+        case NodeBase::kEyeLike: return "EyeLike";
+        case NodeBase::kDepthToSpace: return "DepthToSpace";
+        case NodeBase::kSpaceToDepth: return "SpaceToDepth";
+        case NodeBase::kSum: return "Sum";
+        case NodeBase::kMean: return "Mean";
+        case NodeBase::kMax: return "Max";
+        case NodeBase::kMin: return "Min";
+        case NodeBase::kClip: return "Clip";
+        case NodeBase::kReduceSum: return "ReduceSum";
+        case NodeBase::kReduceSumSquare: return "ReduceSumSquare";
+        case NodeBase::kReduceMean: return "ReduceMean";
+        case NodeBase::kReduceMax: return "ReduceMax";
+        case NodeBase::kReduceMin: return "ReduceMin";
+        case NodeBase::kReduceL1: return "ReduceL1";
+        case NodeBase::kReduceL2: return "ReduceL2";
+        case NodeBase::kReduceLogSum: return "ReduceLogSum";
+        case NodeBase::kReduceLogSumExp: return "ReduceLogSumExp";
+        case NodeBase::kReduceProd: return "ReduceProd";
+        case NodeBase::kArgMax: return "ArgMax";
+        case NodeBase::kArgMin: return "ArgMin";
+        case NodeBase::kHardmax: return "Hardmax";
+        case NodeBase::kDropout: return "Dropout";
+        case NodeBase::kMatMul: return "MatMul";
+        case NodeBase::kGemm: return "Gemm";
+        case NodeBase::kRNN: return "RNN";
+        case NodeBase::kGRU: return "GRU";
+        case NodeBase::kLSTM: return "LSTM";
+        case NodeBase::kConv: return "Conv";
+        case NodeBase::kConvTranspose: return "ConvTranspose";
+        case NodeBase::kBatchNormalization: return "BatchNormalization";
+        case NodeBase::kLRN: return "LRN";
+        case NodeBase::kLpNormalization: return "LpNormalization";
+        case NodeBase::kMaxPool: return "MaxPool";
+        case NodeBase::kAveragePool: return "AveragePool";
+        case NodeBase::kGlobalMaxPool: return "GlobalMaxPool";
+        case NodeBase::kGlobalAveragePool: return "GlobalAveragePool";
+        case NodeBase::kPad: return "Pad";
+        case NodeBase::kUpsample: return "Upsample";
+        case NodeBase::kResize: return "Resize";
+        case NodeBase::kSoftmax: return "Softmax";
+        case NodeBase::kLogSoftmax: return "LogSoftmax";
+        case NodeBase::kIf: return "If";
+        case NodeBase::kLoop: return "Loop";
+        case NodeBase::kWhere: return "Where";
+        case NodeBase::kImageScaler: return "ImageScaler";
+        case NodeBase::kMaxRoiPool: return "MaxRoiPool";
+        case NodeBase::kNonMaxSuppression: return "NonMaxSuppression";
+        case NodeBase::kRoiAlign: return "RoiAlign";
+        case NodeBase::kQuantizeLinear: return "QuantizeLinear";
+        case NodeBase::kDequantizeLinear: return "DequantizeLinear";
+        case NodeBase::kQLinearConv: return "QLinearConv";
+        case NodeBase::kQLinearMatMul: return "QLinearMatMul";
+        case NodeBase::kMatMulInteger: return "MatMulInteger";
+        case NodeBase::kConvInteger: return "ConvInteger";
+        case NodeBase::kRound: return "Round";
+        case NodeBase::kBitShift: return "BitShift";
+        case NodeBase::kChainerLinear: return "ChainerLinear";
+        case NodeBase::kChainerLinearGradWeight: return "ChainerLinearGradWeight";
+        case NodeBase::kChainerReluGrad: return "ChainerReluGrad";
+        case NodeBase::kChainerReduceSumTo: return "ChainerReduceSumTo";
+        case NodeBase::kChainerROIMaxPool2D: return "ChainerROIMaxPool2D";
+        case NodeBase::kChainerROIAveragePool2D: return "ChainerROIAveragePool2D";
+        case NodeBase::kChainerROIMaxAlign2D: return "ChainerROIMaxAlign2D";
+        case NodeBase::kChainerROIAverageAlign2D: return "ChainerROIAverageAlign2D";
+        case NodeBase::kChainerResizeImages: return "ChainerResizeImages";
+        case NodeBase::kChainerPadBatchSize: return "ChainerPadBatchSize";
+        case NodeBase::kChainerDoSomething: return "ChainerDoSomething";
+        case NodeBase::kChainerMaxPoolGrad: return "ChainerMaxPoolGrad";
+        case NodeBase::kChainerAveragePoolGrad: return "ChainerAveragePoolGrad";
+        case NodeBase::kChainerResizeGrad: return "ChainerResizeGrad";
+        case NodeBase::kChainerROIMaxPool2DGrad: return "ChainerROIMaxPool2DGrad";
+        case NodeBase::kChainerROIAveragePool2DGrad: return "ChainerROIAveragePool2DGrad";
+        case NodeBase::kChainerROIMaxAlign2DGrad: return "ChainerROIMaxAlign2DGrad";
+        case NodeBase::kChainerROIAverageAlign2DGrad: return "ChainerROIAverageAlign2DGrad";
+        case NodeBase::kChainerBatchNormalizationGrad: return "ChainerBatchNormalizationGrad";
+        case NodeBase::kChainerConvTransposeWithDynamicOutputShape: return "ChainerConvTransposeWithDynamicOutputShape";
+        case NodeBase::kChainerSoftmaxCrossEntropy: return "ChainerSoftmaxCrossEntropy";
+        case NodeBase::kChainerSelectItem: return "ChainerSelectItem";
+        case NodeBase::kChainerSelectItemGrad: return "ChainerSelectItemGrad";
+        case NodeBase::kChainerLRNGrad: return "ChainerLRNGrad";
+        case NodeBase::kChainerLSTMGrad: return "ChainerLSTMGrad";
+        case NodeBase::kChainerConvGradWeight: return "ChainerConvGradWeight";
+        case NodeBase::kChainerGatherGrad: return "ChainerGatherGrad";
+        case NodeBase::kChainerConcatGrad: return "ChainerConcatGrad";
+        case NodeBase::kChainerDynamicSliceGrad: return "ChainerDynamicSliceGrad";
+        case NodeBase::kChainerFusionGroup: return "ChainerFusionGroup";
+        case NodeBase::kChainerGetItem: return "ChainerGetItem";
+        case NodeBase::kChainerGetItemGrad: return "ChainerGetItemGrad";
+        case NodeBase::kChainerPrint: return "ChainerPrint";
+        case NodeBase::kChainerNullConstant: return "ChainerNullConstant";
+        case NodeBase::kChainerSequenceConstants: return "ChainerSequenceConstants";
+        case NodeBase::kChainerSequenceCreate: return "ChainerSequenceCreate";
+        case NodeBase::kChainerSequenceAppend: return "ChainerSequenceAppend";
+        case NodeBase::kChainerSequenceExtend: return "ChainerSequenceExtend";
+        case NodeBase::kChainerSequencePop: return "ChainerSequencePop";
+        case NodeBase::kChainerSequenceLookup: return "ChainerSequenceLookup";
+        case NodeBase::kChainerSequenceGetSlice: return "ChainerSequenceGetSlice";
+        case NodeBase::kChainerSequenceStack: return "ChainerSequenceStack";
+        case NodeBase::kChainerSequenceConcat: return "ChainerSequenceConcat";
+        case NodeBase::kChainerSequenceSplitAxis: return "ChainerSequenceSplitAxis";
+        case NodeBase::kChainerSequencePad: return "ChainerSequencePad";
+        case NodeBase::kChainerSequenceSeparate: return "ChainerSequenceSeparate";
+        case NodeBase::kChainerSequenceUnpad: return "ChainerSequenceUnpad";
+        case NodeBase::kChainerSequenceSize: return "ChainerSequenceSize";
+        case NodeBase::kChainerSequenceLengths: return "ChainerSequenceLengths";
+        case NodeBase::kChainerSequenceRange: return "ChainerSequenceRange";
+        case NodeBase::kChainerSequenceLookupGrad: return "ChainerSequenceLookupGrad";
+        case NodeBase::kChainerSequenceGetSliceGrad: return "ChainerSequenceGetSliceGrad";
+        case NodeBase::kChainerGenericLen: return "ChainerGenericLen";
+        case NodeBase::kChainerGenericGetItem: return "ChainerGenericGetItem";
+        case NodeBase::kChainerGenericGetSlice: return "ChainerGenericGetSlice";
+        case NodeBase::kChainerGenericAdd: return "ChainerGenericAdd";
+        case NodeBase::kChainerGenericIs: return "ChainerGenericIs";
+        case NodeBase::kChainerGenericAccumulateGrad: return "ChainerGenericAccumulateGrad";
+        default: CHECK(false) << "Unknown op_type: " << static_cast<int>(op_type);
+    }
+}
+
+void NodeBase::FillONNXAttributes(onnx::NodeProto* xnode) const {
+
+    auto add_int_attr = [&xnode](const std::string& name, int v) {
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::INT);
+        xattr->set_i(v);
+    };
+
+    auto add_float_attr = [&xnode](const std::string& name, float v) {
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::FLOAT);
+        xattr->set_f(v);
+    };
+
+    auto add_string_attr = [&xnode](const std::string& name, const std::string& v) {
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::STRING);
+        xattr->set_s(v);
+    };
+
+    auto add_tensor_attr = [&xnode](const std::string& name, const std::unique_ptr<Tensor>& v) {
+        if (!v.get()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::TENSOR);
+        v->ToONNX(xattr->mutable_t());
+    };
+
+    auto add_tensors_attr = [&xnode](const std::string& name, const std::vector<std::unique_ptr<Tensor>>& vec) {
+        if (vec.empty()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::TENSORS);
+        for (const std::unique_ptr<Tensor>& t : vec) t->ToONNX(xattr->add_tensors());
+    };
+
+    auto add_graph_attr = [&xnode](const std::string& name, const std::unique_ptr<Graph>& v) {
+        if (!v.get()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::GRAPH);
+        v->ToONNX(xattr->mutable_g());
+    };
+
+    auto add_ints_attr = [&xnode](const std::string& name, const std::vector<int64_t>& ints) {
+        if (ints.empty()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::INTS);
+        for (int s : ints) xattr->add_ints(s);
+    };
+
+    auto add_floats_attr = [&xnode](const std::string& name, const std::vector<float>& floats) {
+        if (floats.empty()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::FLOATS);
+        for (float s : floats) xattr->add_floats(s);
+    };
+
+    auto add_strings_attr = [&xnode](const std::string& name, const std::vector<std::string>& strings) {
+        if (strings.empty()) return;
+        onnx::AttributeProto* xattr = xnode->add_attribute();
+        xattr->set_name(name);
+        xattr->set_type(onnx::AttributeProto::STRINGS);
+        for (const std::string& s : strings) xattr->add_strings(s);
+    };
+
+    auto add_dtype_attr = [&xnode, add_int_attr](const std::string& name, Dtype v) {
+        add_int_attr(name, static_cast<int>(v.ToONNX()));
+    };
+
+    switch (op_type_) {
+        case kIdentity: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kNeg: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kReciprocal: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kExp: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kLog: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSqrt: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kIsNaN: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kIsInf: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_detect_negative_set_)
+                add_int_attr("detect_negative", detect_negative_);
+            if (was_detect_positive_set_)
+                add_int_attr("detect_positive", detect_positive_);
+            break;
+        }
+
+        case kSign: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSin: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSinh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kCos: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kCosh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kTan: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kTanh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAsin: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAsinh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAcos: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAcosh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAtan: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAtanh: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kErf: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAbs: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kRelu: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSelu: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_gamma_set_)
+                add_float_attr("gamma", gamma_);
+            break;
+        }
+
+        case kLeakyRelu: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kElu: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSigmoid: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kNot: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kFloor: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kCeil: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSoftplus: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSoftsign: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAdd: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSub: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kMul: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kDiv: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kPow: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kEqual: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kGreater: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kLess: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kAnd: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kOr: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kXor: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kConstant: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_host_set_)
+                add_int_attr("chainer_host", chainer_host_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_tensor_value_set_)
+                add_tensor_attr("value", tensor_value_);
+            break;
+        }
+
+        case kConstantOfShape: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_tensor_value_set_)
+                add_tensor_attr("value", tensor_value_);
+            break;
+        }
+
+        case kConstantLike: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dtype_set_)
+                add_dtype_attr("dtype", dtype_);
+            if (was_shape_set_)
+                add_ints_attr("shape", shape_);
+            if (was_value_set_)
+                add_float_attr("value", value_);
+            break;
+        }
+
+        case kConstantFill: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dtype_set_)
+                add_dtype_attr("dtype", dtype_);
+            if (was_extra_shape_set_)
+                add_ints_attr("extra_shape", extra_shape_);
+            if (was_input_as_shape_set_)
+                add_int_attr("input_as_shape", input_as_shape_);
+            if (was_shape_set_)
+                add_ints_attr("shape", shape_);
+            if (was_value_set_)
+                add_float_attr("value", value_);
+            break;
+        }
+
+        case kOneHot: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kCast: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_to_set_)
+                add_dtype_attr("to", to_);
+            break;
+        }
+
+        case kShape: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSize: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kReshape: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kExpand: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSqueeze: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kUnsqueeze: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kFlatten: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSlice: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_ends_set_)
+                add_ints_attr("ends", ends_);
+            if (was_starts_set_)
+                add_ints_attr("starts", starts_);
+            break;
+        }
+
+        case kDynamicSlice: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kGather: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kConcat: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSplit: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_split_set_)
+                add_ints_attr("split", split_);
+            break;
+        }
+
+        case kTranspose: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_perm_set_)
+                add_ints_attr("perm", perm_);
+            break;
+        }
+
+        case kEyeLike: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dtype_set_)
+                add_dtype_attr("dtype", dtype_);
+            if (was_k_set_)
+                add_int_attr("k", k_);
+            break;
+        }
+
+        case kDepthToSpace: {
+            if (was_blocksize_set_)
+                add_int_attr("blocksize", blocksize_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSpaceToDepth: {
+            if (was_blocksize_set_)
+                add_int_attr("blocksize", blocksize_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kSum: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kMean: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kMax: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kMin: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kClip: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_max_set_)
+                add_float_attr("max", max_);
+            if (was_min_set_)
+                add_float_attr("min", min_);
+            break;
+        }
+
+        case kReduceSum: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceSumSquare: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceMean: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceMax: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceMin: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceL1: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceL2: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceLogSum: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceLogSumExp: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kReduceProd: {
+            if (was_axes_set_)
+                add_ints_attr("axes", axes_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kArgMax: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kArgMin: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_keepdims_set_)
+                add_int_attr("keepdims", keepdims_);
+            break;
+        }
+
+        case kHardmax: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kDropout: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_ratio_set_)
+                add_float_attr("ratio", ratio_);
+            break;
+        }
+
+        case kMatMul: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kGemm: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_beta_set_)
+                add_float_attr("beta", beta_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_trans_a_set_)
+                add_int_attr("transA", trans_a_);
+            if (was_trans_b_set_)
+                add_int_attr("transB", trans_b_);
+            break;
+        }
+
+        case kRNN: {
+            if (was_activation_alpha_set_)
+                add_floats_attr("activation_alpha", activation_alpha_);
+            if (was_activation_beta_set_)
+                add_floats_attr("activation_beta", activation_beta_);
+            if (was_activations_set_)
+                add_strings_attr("activations", activations_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_clip_set_)
+                add_float_attr("clip", clip_);
+            if (was_direction_set_)
+                add_string_attr("direction", direction_);
+            if (was_hidden_size_set_)
+                add_int_attr("hidden_size", hidden_size_);
+            break;
+        }
+
+        case kGRU: {
+            if (was_activation_alpha_set_)
+                add_floats_attr("activation_alpha", activation_alpha_);
+            if (was_activation_beta_set_)
+                add_floats_attr("activation_beta", activation_beta_);
+            if (was_activations_set_)
+                add_strings_attr("activations", activations_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_clip_set_)
+                add_float_attr("clip", clip_);
+            if (was_direction_set_)
+                add_string_attr("direction", direction_);
+            if (was_hidden_size_set_)
+                add_int_attr("hidden_size", hidden_size_);
+            if (was_linear_before_reset_set_)
+                add_int_attr("linear_before_reset", linear_before_reset_);
+            break;
+        }
+
+        case kLSTM: {
+            if (was_activation_alpha_set_)
+                add_floats_attr("activation_alpha", activation_alpha_);
+            if (was_activation_beta_set_)
+                add_floats_attr("activation_beta", activation_beta_);
+            if (was_activations_set_)
+                add_strings_attr("activations", activations_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_clip_set_)
+                add_float_attr("clip", clip_);
+            if (was_direction_set_)
+                add_string_attr("direction", direction_);
+            if (was_hidden_size_set_)
+                add_int_attr("hidden_size", hidden_size_);
+            if (was_input_forget_set_)
+                add_int_attr("input_forget", input_forget_);
+            break;
+        }
+
+        case kConv: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kConvTranspose: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_output_padding_set_)
+                add_ints_attr("output_padding", output_padding_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kBatchNormalization: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_in_recomputing_set_)
+                add_int_attr("chainer_in_recomputing", chainer_in_recomputing_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_epsilon_set_)
+                add_float_attr("epsilon", epsilon_);
+            if (was_momentum_set_)
+                add_float_attr("momentum", momentum_);
+            if (was_spatial_set_)
+                add_int_attr("spatial", spatial_);
+            break;
+        }
+
+        case kLRN: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_beta_set_)
+                add_float_attr("beta", beta_);
+            if (was_bias_set_)
+                add_float_attr("bias", bias_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_size_set_)
+                add_int_attr("size", size_);
+            break;
+        }
+
+        case kLpNormalization: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_p_set_)
+                add_int_attr("p", p_);
+            break;
+        }
+
+        case kMaxPool: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_cover_all_set_)
+                add_int_attr("chainer_cover_all", chainer_cover_all_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_storage_order_set_)
+                add_int_attr("storage_order", storage_order_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kAveragePool: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_count_include_pad_set_)
+                add_int_attr("count_include_pad", count_include_pad_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_storage_order_set_)
+                add_int_attr("storage_order", storage_order_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kGlobalMaxPool: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kGlobalAveragePool: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kPad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_mode_set_)
+                add_string_attr("mode", mode_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_value_set_)
+                add_float_attr("value", value_);
+            break;
+        }
+
+        case kUpsample: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_height_scale_set_)
+                add_float_attr("height_scale", height_scale_);
+            if (was_mode_set_)
+                add_string_attr("mode", mode_);
+            if (was_width_scale_set_)
+                add_float_attr("width_scale", width_scale_);
+            break;
+        }
+
+        case kResize: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_mode_set_)
+                add_string_attr("mode", mode_);
+            break;
+        }
+
+        case kSoftmax: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_is_onnx_semantics_set_)
+                add_int_attr("chainer_is_onnx_semantics", chainer_is_onnx_semantics_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kLogSoftmax: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_is_onnx_semantics_set_)
+                add_int_attr("chainer_is_onnx_semantics", chainer_is_onnx_semantics_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kIf: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_else_branch_set_)
+                add_graph_attr("else_branch", else_branch_);
+            if (was_then_branch_set_)
+                add_graph_attr("then_branch", then_branch_);
+            break;
+        }
+
+        case kLoop: {
+            if (was_body_set_)
+                add_graph_attr("body", body_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_chainer_stack_axis_set_)
+                add_int_attr("chainer_stack_axis", chainer_stack_axis_);
+            break;
+        }
+
+        case kWhere: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kImageScaler: {
+            if (was_bias_list_set_)
+                add_floats_attr("bias", bias_list_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_scale_set_)
+                add_float_attr("scale", scale_);
+            break;
+        }
+
+        case kMaxRoiPool: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_pooled_shape_set_)
+                add_ints_attr("pooled_shape", pooled_shape_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kNonMaxSuppression: {
+            if (was_center_point_box_set_)
+                add_int_attr("center_point_box", center_point_box_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kRoiAlign: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_mode_set_)
+                add_string_attr("mode", mode_);
+            if (was_output_height_set_)
+                add_int_attr("output_height", output_height_);
+            if (was_output_width_set_)
+                add_int_attr("output_width", output_width_);
+            if (was_sampling_ratio_set_)
+                add_int_attr("sampling_ratio", sampling_ratio_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kQuantizeLinear: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kDequantizeLinear: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kQLinearConv: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kQLinearMatMul: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kMatMulInteger: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kConvInteger: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kRound: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kBitShift: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_direction_set_)
+                add_string_attr("direction", direction_);
+            break;
+        }
+
+        case kChainerLinear: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_n_batch_axes_set_)
+                add_int_attr("n_batch_axes", n_batch_axes_);
+            break;
+        }
+
+        case kChainerLinearGradWeight: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerReluGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerReduceSumTo: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerROIMaxPool2D: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIAveragePool2D: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIMaxAlign2D: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_sampling_ratio_list_set_)
+                add_ints_attr("sampling_ratio", sampling_ratio_list_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIAverageAlign2D: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_sampling_ratio_list_set_)
+                add_ints_attr("sampling_ratio", sampling_ratio_list_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerResizeImages: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            break;
+        }
+
+        case kChainerPadBatchSize: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_size_set_)
+                add_int_attr("size", size_);
+            break;
+        }
+
+        case kChainerDoSomething: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_function_name_set_)
+                add_string_attr("function_name", function_name_);
+            break;
+        }
+
+        case kChainerMaxPoolGrad: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_cover_all_set_)
+                add_int_attr("chainer_cover_all", chainer_cover_all_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_storage_order_set_)
+                add_int_attr("storage_order", storage_order_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kChainerAveragePoolGrad: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_count_include_pad_set_)
+                add_int_attr("count_include_pad", count_include_pad_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_storage_order_set_)
+                add_int_attr("storage_order", storage_order_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kChainerResizeGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerROIMaxPool2DGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIAveragePool2DGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIMaxAlign2DGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_sampling_ratio_list_set_)
+                add_ints_attr("sampling_ratio", sampling_ratio_list_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerROIAverageAlign2DGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_output_shape_set_)
+                add_ints_attr("output_shape", output_shape_);
+            if (was_sampling_ratio_list_set_)
+                add_ints_attr("sampling_ratio", sampling_ratio_list_);
+            if (was_spatial_scale_set_)
+                add_float_attr("spatial_scale", spatial_scale_);
+            break;
+        }
+
+        case kChainerBatchNormalizationGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerConvTransposeWithDynamicOutputShape: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kChainerSoftmaxCrossEntropy: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSelectItem: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSelectItemGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerLRNGrad: {
+            if (was_alpha_set_)
+                add_float_attr("alpha", alpha_);
+            if (was_beta_set_)
+                add_float_attr("beta", beta_);
+            if (was_bias_set_)
+                add_float_attr("bias", bias_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_size_set_)
+                add_int_attr("size", size_);
+            break;
+        }
+
+        case kChainerLSTMGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerConvGradWeight: {
+            if (was_auto_pad_set_)
+                add_string_attr("auto_pad", auto_pad_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_dilations_set_)
+                add_ints_attr("dilations", dilations_);
+            if (was_group_set_)
+                add_int_attr("group", group_);
+            if (was_kernel_shape_set_)
+                add_ints_attr("kernel_shape", kernel_shape_);
+            if (was_pads_set_)
+                add_ints_attr("pads", pads_);
+            if (was_strides_set_)
+                add_ints_attr("strides", strides_);
+            break;
+        }
+
+        case kChainerGatherGrad: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerConcatGrad: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerDynamicSliceGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerFusionGroup: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_fusion_type_set_)
+                add_string_attr("fusion_type", fusion_type_);
+            if (was_subgraph_set_)
+                add_graph_attr("subgraph", subgraph_);
+            break;
+        }
+
+        case kChainerGetItem: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_slice_specs_set_)
+                add_ints_attr("slice_specs", slice_specs_);
+            break;
+        }
+
+        case kChainerGetItemGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_slice_specs_set_)
+                add_ints_attr("slice_specs", slice_specs_);
+            break;
+        }
+
+        case kChainerPrint: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerNullConstant: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceConstants: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_tensor_values_set_)
+                add_tensors_attr("tensor_values", tensor_values_);
+            break;
+        }
+
+        case kChainerSequenceCreate: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceAppend: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceExtend: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequencePop: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceLookup: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceGetSlice: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceStack: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceConcat: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceSplitAxis: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequencePad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            if (was_length_set_)
+                add_int_attr("length", length_);
+            if (was_value_set_)
+                add_float_attr("value", value_);
+            break;
+        }
+
+        case kChainerSequenceSeparate: {
+            if (was_axis_set_)
+                add_int_attr("axis", axis_);
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceUnpad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceSize: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceLengths: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceRange: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceLookupGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerSequenceGetSliceGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericLen: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericGetItem: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericGetSlice: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericAdd: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericIs: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+
+        case kChainerGenericAccumulateGrad: {
+            if (was_chainer_fusion_group_set_)
+                add_int_attr("chainer_fusion_group", chainer_fusion_group_);
+            if (was_chainer_order_set_)
+                add_int_attr("chainer_order", chainer_order_);
+            break;
+        }
+    }
+
+    for (const onnx::AttributeProto& xattr : unknown_attributes_) {
+        *xnode->add_attribute() = xattr;
+    }
+}
+
+void NodeBase::SetDefaultAttributeValues() {
+    const float inf = std::numeric_limits<float>::infinity();
+    switch (op_type_) {
+        case kIdentity: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kNeg: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kReciprocal: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kExp: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kLog: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSqrt: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kIsNaN: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kIsInf: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            detect_negative_ = 1;
+            detect_positive_ = 1;
+            break;
+        }
+
+        case kSign: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSin: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSinh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kCos: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kCosh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kTan: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kTanh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAsin: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAsinh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAcos: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAcosh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAtan: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAtanh: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kErf: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAbs: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kRelu: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSelu: {
+            alpha_ = 1.6732631921768188;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            gamma_ = 1.0507010221481323;
+            break;
+        }
+
+        case kLeakyRelu: {
+            alpha_ = 0.01;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kElu: {
+            alpha_ = 1.0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSigmoid: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kNot: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kFloor: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kCeil: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSoftplus: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSoftsign: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAdd: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSub: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kMul: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kDiv: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kPow: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kEqual: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kGreater: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kLess: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kAnd: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kOr: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kXor: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kConstant: {
+            chainer_fusion_group_ = 0;
+            chainer_host_ = false;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kConstantOfShape: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kConstantLike: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            value_ = 0.0;
+            break;
+        }
+
+        case kConstantFill: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            value_ = 0.0;
+            break;
+        }
+
+        case kOneHot: {
+            axis_ = -1;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kCast: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kShape: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSize: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kReshape: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kExpand: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSqueeze: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kUnsqueeze: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kFlatten: {
+            axis_ = 1;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSlice: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kDynamicSlice: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kGather: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kConcat: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSplit: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kTranspose: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kEyeLike: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            k_ = 0;
+            break;
+        }
+
+        case kDepthToSpace: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSpaceToDepth: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kSum: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kMean: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kMax: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kMin: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kClip: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            max_ = inf;
+            min_ = -inf;
+            break;
+        }
+
+        case kReduceSum: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceSumSquare: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceMean: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceMax: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceMin: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceL1: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceL2: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceLogSum: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceLogSumExp: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kReduceProd: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kArgMax: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kArgMin: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            keepdims_ = true;
+            break;
+        }
+
+        case kHardmax: {
+            axis_ = 1;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kDropout: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            ratio_ = 0.5;
+            break;
+        }
+
+        case kMatMul: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kGemm: {
+            alpha_ = 1.0;
+            beta_ = 1.0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            trans_a_ = false;
+            trans_b_ = false;
+            break;
+        }
+
+        case kRNN: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            direction_ = "forward";
+            break;
+        }
+
+        case kGRU: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            direction_ = "forward";
+            linear_before_reset_ = 0;
+            break;
+        }
+
+        case kLSTM: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            direction_ = "forward";
+            input_forget_ = 0;
+            break;
+        }
+
+        case kConv: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kConvTranspose: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kBatchNormalization: {
+            chainer_fusion_group_ = 0;
+            chainer_in_recomputing_ = 0;
+            chainer_order_ = -1;
+            epsilon_ = 1e-05;
+            momentum_ = 0.9;
+            spatial_ = 1;
+            break;
+        }
+
+        case kLRN: {
+            alpha_ = 0.0001;
+            beta_ = 0.75;
+            bias_ = 1.0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kLpNormalization: {
+            axis_ = -1;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            p_ = 2;
+            break;
+        }
+
+        case kMaxPool: {
+            auto_pad_ = "NOTSET";
+            chainer_cover_all_ = false;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            storage_order_ = 0;
+            break;
+        }
+
+        case kAveragePool: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            count_include_pad_ = false;
+            storage_order_ = 0;
+            break;
+        }
+
+        case kGlobalMaxPool: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kGlobalAveragePool: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kPad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            mode_ = "constant";
+            value_ = 0.0;
+            break;
+        }
+
+        case kUpsample: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            mode_ = "nearest";
+            break;
+        }
+
+        case kResize: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            mode_ = "nearest";
+            break;
+        }
+
+        case kSoftmax: {
+            axis_ = 1;
+            chainer_fusion_group_ = 0;
+            chainer_is_onnx_semantics_ = true;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kLogSoftmax: {
+            axis_ = 1;
+            chainer_fusion_group_ = 0;
+            chainer_is_onnx_semantics_ = true;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kIf: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kLoop: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            chainer_stack_axis_ = 0;
+            break;
+        }
+
+        case kWhere: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kImageScaler: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            scale_ = 1.0;
+            break;
+        }
+
+        case kMaxRoiPool: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            spatial_scale_ = 1.0;
+            break;
+        }
+
+        case kNonMaxSuppression: {
+            center_point_box_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kRoiAlign: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            mode_ = "avg";
+            output_height_ = 1;
+            output_width_ = 1;
+            sampling_ratio_ = 0;
+            spatial_scale_ = 1.0;
+            break;
+        }
+
+        case kQuantizeLinear: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kDequantizeLinear: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kQLinearConv: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kQLinearMatMul: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kMatMulInteger: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kConvInteger: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kRound: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kBitShift: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            direction_ = "LEFT";
+            break;
+        }
+
+        case kChainerLinear: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            n_batch_axes_ = 1;
+            break;
+        }
+
+        case kChainerLinearGradWeight: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerReluGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerReduceSumTo: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIMaxPool2D: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIAveragePool2D: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIMaxAlign2D: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIAverageAlign2D: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerResizeImages: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerPadBatchSize: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerDoSomething: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerMaxPoolGrad: {
+            auto_pad_ = "NOTSET";
+            chainer_cover_all_ = false;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            storage_order_ = 0;
+            break;
+        }
+
+        case kChainerAveragePoolGrad: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            count_include_pad_ = false;
+            storage_order_ = 0;
+            break;
+        }
+
+        case kChainerResizeGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIMaxPool2DGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIAveragePool2DGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIMaxAlign2DGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerROIAverageAlign2DGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerBatchNormalizationGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerConvTransposeWithDynamicOutputShape: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kChainerSoftmaxCrossEntropy: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSelectItem: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSelectItemGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerLRNGrad: {
+            alpha_ = 0.0001;
+            beta_ = 0.75;
+            bias_ = 1.0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerLSTMGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerConvGradWeight: {
+            auto_pad_ = "NOTSET";
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            group_ = 1;
+            break;
+        }
+
+        case kChainerGatherGrad: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerConcatGrad: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerDynamicSliceGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerFusionGroup: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGetItem: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGetItemGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerPrint: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerNullConstant: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceConstants: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceCreate: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceAppend: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceExtend: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequencePop: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceLookup: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceGetSlice: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceStack: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceConcat: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceSplitAxis: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequencePad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            length_ = 0;
+            value_ = 0.0;
+            break;
+        }
+
+        case kChainerSequenceSeparate: {
+            axis_ = 0;
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceUnpad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceSize: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceLengths: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceRange: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceLookupGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerSequenceGetSliceGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericLen: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericGetItem: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericGetSlice: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericAdd: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericIs: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+
+        case kChainerGenericAccumulateGrad: {
+            chainer_fusion_group_ = 0;
+            chainer_order_ = -1;
+            break;
+        }
+    }
+}
+
+void NodeBase::ValidateNumInputsOutputs(const std::vector<Value*>& inputs, const std::vector<Value*>& outputs) const {
+    switch (op_type_) {
+        case kIdentity: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Identity";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Identity";
+            break;
+        }
+
+        case kNeg: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Neg";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Neg";
+            break;
+        }
+
+        case kReciprocal: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Reciprocal";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Reciprocal";
+            break;
+        }
+
+        case kExp: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Exp";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Exp";
+            break;
+        }
+
+        case kLog: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Log";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Log";
+            break;
+        }
+
+        case kSqrt: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Sqrt";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sqrt";
+            break;
+        }
+
+        case kIsNaN: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for IsNaN";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for IsNaN";
+            break;
+        }
+
+        case kIsInf: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for IsInf";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for IsInf";
+            break;
+        }
+
+        case kSign: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Sign";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sign";
+            break;
+        }
+
+        case kSin: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Sin";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sin";
+            break;
+        }
+
+        case kSinh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Sinh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sinh";
+            break;
+        }
+
+        case kCos: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Cos";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Cos";
+            break;
+        }
+
+        case kCosh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Cosh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Cosh";
+            break;
+        }
+
+        case kTan: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Tan";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Tan";
+            break;
+        }
+
+        case kTanh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Tanh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Tanh";
+            break;
+        }
+
+        case kAsin: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Asin";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Asin";
+            break;
+        }
+
+        case kAsinh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Asinh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Asinh";
+            break;
+        }
+
+        case kAcos: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Acos";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Acos";
+            break;
+        }
+
+        case kAcosh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Acosh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Acosh";
+            break;
+        }
+
+        case kAtan: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Atan";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Atan";
+            break;
+        }
+
+        case kAtanh: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Atanh";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Atanh";
+            break;
+        }
+
+        case kErf: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Erf";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Erf";
+            break;
+        }
+
+        case kAbs: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Abs";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Abs";
+            break;
+        }
+
+        case kRelu: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Relu";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Relu";
+            break;
+        }
+
+        case kSelu: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Selu";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Selu";
+            break;
+        }
+
+        case kLeakyRelu: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for LeakyRelu";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for LeakyRelu";
+            break;
+        }
+
+        case kElu: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Elu";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Elu";
+            break;
+        }
+
+        case kSigmoid: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Sigmoid";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sigmoid";
+            break;
+        }
+
+        case kNot: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Not";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Not";
+            break;
+        }
+
+        case kFloor: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Floor";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Floor";
+            break;
+        }
+
+        case kCeil: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Ceil";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Ceil";
+            break;
+        }
+
+        case kSoftplus: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Softplus";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Softplus";
+            break;
+        }
+
+        case kSoftsign: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Softsign";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Softsign";
+            break;
+        }
+
+        case kAdd: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Add";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Add";
+            break;
+        }
+
+        case kSub: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Sub";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sub";
+            break;
+        }
+
+        case kMul: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Mul";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Mul";
+            break;
+        }
+
+        case kDiv: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Div";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Div";
+            break;
+        }
+
+        case kPow: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Pow";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Pow";
+            break;
+        }
+
+        case kEqual: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Equal";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Equal";
+            break;
+        }
+
+        case kGreater: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Greater";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Greater";
+            break;
+        }
+
+        case kLess: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Less";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Less";
+            break;
+        }
+
+        case kAnd: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for And";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for And";
+            break;
+        }
+
+        case kOr: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Or";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Or";
+            break;
+        }
+
+        case kXor: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Xor";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Xor";
+            break;
+        }
+
+        case kConstant: {
+            CHECK_EQ(0, inputs.size()) << "Unexpected number of inputs for Constant";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Constant";
+            break;
+        }
+
+        case kConstantOfShape: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ConstantOfShape";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ConstantOfShape";
+            break;
+        }
+
+        case kConstantLike: {
+            CHECK(0 == inputs.size() || 1 == inputs.size()) << "Unexpected number of inputs for ConstantLike (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ConstantLike";
+            break;
+        }
+
+        case kConstantFill: {
+            CHECK(0 == inputs.size() || 1 == inputs.size()) << "Unexpected number of inputs for ConstantFill (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ConstantFill";
+            break;
+        }
+
+        case kOneHot: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for OneHot";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for OneHot";
+            break;
+        }
+
+        case kCast: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Cast";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Cast";
+            break;
+        }
+
+        case kShape: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Shape";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Shape";
+            break;
+        }
+
+        case kSize: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Size";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Size";
+            break;
+        }
+
+        case kReshape: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Reshape";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Reshape";
+            break;
+        }
+
+        case kExpand: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Expand";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Expand";
+            break;
+        }
+
+        case kSqueeze: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Squeeze";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Squeeze";
+            break;
+        }
+
+        case kUnsqueeze: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Unsqueeze";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Unsqueeze";
+            break;
+        }
+
+        case kFlatten: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Flatten";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Flatten";
+            break;
+        }
+
+        case kSlice: {
+            CHECK(1 == inputs.size() || 3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size()) << "Unexpected number of inputs for Slice (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Slice";
+            break;
+        }
+
+        case kDynamicSlice: {
+            CHECK(3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size()) << "Unexpected number of inputs for DynamicSlice (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for DynamicSlice";
+            break;
+        }
+
+        case kGather: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Gather";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Gather";
+            break;
+        }
+
+        case kConcat: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Concat";
+            break;
+        }
+
+        case kSplit: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Split";
+            break;
+        }
+
+        case kTranspose: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Transpose";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Transpose";
+            break;
+        }
+
+        case kEyeLike: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for EyeLike";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for EyeLike";
+            break;
+        }
+
+        case kDepthToSpace: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for DepthToSpace";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for DepthToSpace";
+            break;
+        }
+
+        case kSpaceToDepth: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for SpaceToDepth";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for SpaceToDepth";
+            break;
+        }
+
+        case kSum: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Sum";
+            break;
+        }
+
+        case kMean: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Mean";
+            break;
+        }
+
+        case kMax: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Max";
+            break;
+        }
+
+        case kMin: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Min";
+            break;
+        }
+
+        case kClip: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Clip";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Clip";
+            break;
+        }
+
+        case kReduceSum: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceSum";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceSum";
+            break;
+        }
+
+        case kReduceSumSquare: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceSumSquare";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceSumSquare";
+            break;
+        }
+
+        case kReduceMean: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceMean";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceMean";
+            break;
+        }
+
+        case kReduceMax: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceMax";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceMax";
+            break;
+        }
+
+        case kReduceMin: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceMin";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceMin";
+            break;
+        }
+
+        case kReduceL1: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceL1";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceL1";
+            break;
+        }
+
+        case kReduceL2: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceL2";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceL2";
+            break;
+        }
+
+        case kReduceLogSum: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceLogSum";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceLogSum";
+            break;
+        }
+
+        case kReduceLogSumExp: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceLogSumExp";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceLogSumExp";
+            break;
+        }
+
+        case kReduceProd: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ReduceProd";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ReduceProd";
+            break;
+        }
+
+        case kArgMax: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ArgMax";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ArgMax";
+            break;
+        }
+
+        case kArgMin: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ArgMin";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ArgMin";
+            break;
+        }
+
+        case kHardmax: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Hardmax";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Hardmax";
+            break;
+        }
+
+        case kDropout: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Dropout";
+            CHECK(1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for Dropout (" << outputs.size() << ")";
+            break;
+        }
+
+        case kMatMul: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for MatMul";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for MatMul";
+            break;
+        }
+
+        case kGemm: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for Gemm";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Gemm";
+            break;
+        }
+
+        case kRNN: {
+            CHECK(3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size() || 6 == inputs.size()) << "Unexpected number of inputs for RNN (" << inputs.size() << ")";
+            CHECK(0 == outputs.size() || 1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for RNN (" << outputs.size() << ")";
+            break;
+        }
+
+        case kGRU: {
+            CHECK(3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size() || 6 == inputs.size()) << "Unexpected number of inputs for GRU (" << inputs.size() << ")";
+            CHECK(0 == outputs.size() || 1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for GRU (" << outputs.size() << ")";
+            break;
+        }
+
+        case kLSTM: {
+            CHECK(3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size() || 6 == inputs.size() || 7 == inputs.size() || 8 == inputs.size()) << "Unexpected number of inputs for LSTM (" << inputs.size() << ")";
+            CHECK(0 == outputs.size() || 1 == outputs.size() || 2 == outputs.size() || 3 == outputs.size() || 4 == outputs.size()) << "Unexpected number of outputs for LSTM (" << outputs.size() << ")";
+            break;
+        }
+
+        case kConv: {
+            CHECK(2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for Conv (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Conv";
+            break;
+        }
+
+        case kConvTranspose: {
+            CHECK(2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for ConvTranspose (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ConvTranspose";
+            break;
+        }
+
+        case kBatchNormalization: {
+            CHECK_EQ(5, inputs.size()) << "Unexpected number of inputs for BatchNormalization";
+            CHECK(1 == outputs.size() || 2 == outputs.size() || 3 == outputs.size() || 4 == outputs.size() || 5 == outputs.size() || 6 == outputs.size()) << "Unexpected number of outputs for BatchNormalization (" << outputs.size() << ")";
+            break;
+        }
+
+        case kLRN: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for LRN";
+            CHECK(1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for LRN (" << outputs.size() << ")";
+            break;
+        }
+
+        case kLpNormalization: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for LpNormalization";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for LpNormalization";
+            break;
+        }
+
+        case kMaxPool: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for MaxPool";
+            CHECK(1 == outputs.size() || 2 == outputs.size() || 3 == outputs.size()) << "Unexpected number of outputs for MaxPool (" << outputs.size() << ")";
+            break;
+        }
+
+        case kAveragePool: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for AveragePool";
+            CHECK(1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for AveragePool (" << outputs.size() << ")";
+            break;
+        }
+
+        case kGlobalMaxPool: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for GlobalMaxPool";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for GlobalMaxPool";
+            break;
+        }
+
+        case kGlobalAveragePool: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for GlobalAveragePool";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for GlobalAveragePool";
+            break;
+        }
+
+        case kPad: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Pad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Pad";
+            break;
+        }
+
+        case kUpsample: {
+            CHECK(1 == inputs.size() || 2 == inputs.size()) << "Unexpected number of inputs for Upsample (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Upsample";
+            break;
+        }
+
+        case kResize: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for Resize";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Resize";
+            break;
+        }
+
+        case kSoftmax: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Softmax";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Softmax";
+            break;
+        }
+
+        case kLogSoftmax: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for LogSoftmax";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for LogSoftmax";
+            break;
+        }
+
+        case kIf: {
+            break;
+        }
+
+        case kLoop: {
+            break;
+        }
+
+        case kWhere: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for Where";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Where";
+            break;
+        }
+
+        case kImageScaler: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ImageScaler";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ImageScaler";
+            break;
+        }
+
+        case kMaxRoiPool: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for MaxRoiPool";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for MaxRoiPool";
+            break;
+        }
+
+        case kNonMaxSuppression: {
+            CHECK(2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size()) << "Unexpected number of inputs for NonMaxSuppression (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for NonMaxSuppression";
+            break;
+        }
+
+        case kRoiAlign: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for RoiAlign";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for RoiAlign";
+            break;
+        }
+
+        case kQuantizeLinear: {
+            CHECK(2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for QuantizeLinear (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for QuantizeLinear";
+            break;
+        }
+
+        case kDequantizeLinear: {
+            CHECK(2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for DequantizeLinear (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for DequantizeLinear";
+            break;
+        }
+
+        case kQLinearConv: {
+            CHECK(8 == inputs.size() || 9 == inputs.size()) << "Unexpected number of inputs for QLinearConv (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for QLinearConv";
+            break;
+        }
+
+        case kQLinearMatMul: {
+            CHECK_EQ(8, inputs.size()) << "Unexpected number of inputs for QLinearMatMul";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for QLinearMatMul";
+            break;
+        }
+
+        case kMatMulInteger: {
+            CHECK(2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size()) << "Unexpected number of inputs for MatMulInteger (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for MatMulInteger";
+            break;
+        }
+
+        case kConvInteger: {
+            CHECK(2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size()) << "Unexpected number of inputs for ConvInteger (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ConvInteger";
+            break;
+        }
+
+        case kRound: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for Round";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for Round";
+            break;
+        }
+
+        case kBitShift: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for BitShift";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for BitShift";
+            break;
+        }
+
+        case kChainerLinear: {
+            CHECK(2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for ChainerLinear (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerLinear";
+            break;
+        }
+
+        case kChainerLinearGradWeight: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerLinearGradWeight";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerLinearGradWeight";
+            break;
+        }
+
+        case kChainerReluGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerReluGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerReluGrad";
+            break;
+        }
+
+        case kChainerReduceSumTo: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerReduceSumTo";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerReduceSumTo";
+            break;
+        }
+
+        case kChainerROIMaxPool2D: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerROIMaxPool2D";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIMaxPool2D";
+            break;
+        }
+
+        case kChainerROIAveragePool2D: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerROIAveragePool2D";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIAveragePool2D";
+            break;
+        }
+
+        case kChainerROIMaxAlign2D: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerROIMaxAlign2D";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIMaxAlign2D";
+            break;
+        }
+
+        case kChainerROIAverageAlign2D: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerROIAverageAlign2D";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIAverageAlign2D";
+            break;
+        }
+
+        case kChainerResizeImages: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerResizeImages";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerResizeImages";
+            break;
+        }
+
+        case kChainerPadBatchSize: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerPadBatchSize";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerPadBatchSize";
+            break;
+        }
+
+        case kChainerDoSomething: {
+            break;
+        }
+
+        case kChainerMaxPoolGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerMaxPoolGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerMaxPoolGrad";
+            break;
+        }
+
+        case kChainerAveragePoolGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerAveragePoolGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerAveragePoolGrad";
+            break;
+        }
+
+        case kChainerResizeGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerResizeGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerResizeGrad";
+            break;
+        }
+
+        case kChainerROIMaxPool2DGrad: {
+            CHECK_EQ(4, inputs.size()) << "Unexpected number of inputs for ChainerROIMaxPool2DGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIMaxPool2DGrad";
+            break;
+        }
+
+        case kChainerROIAveragePool2DGrad: {
+            CHECK_EQ(4, inputs.size()) << "Unexpected number of inputs for ChainerROIAveragePool2DGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIAveragePool2DGrad";
+            break;
+        }
+
+        case kChainerROIMaxAlign2DGrad: {
+            CHECK_EQ(4, inputs.size()) << "Unexpected number of inputs for ChainerROIMaxAlign2DGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIMaxAlign2DGrad";
+            break;
+        }
+
+        case kChainerROIAverageAlign2DGrad: {
+            CHECK_EQ(4, inputs.size()) << "Unexpected number of inputs for ChainerROIAverageAlign2DGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerROIAverageAlign2DGrad";
+            break;
+        }
+
+        case kChainerBatchNormalizationGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerBatchNormalizationGrad";
+            CHECK_EQ(3, outputs.size()) << "Unexpected number of outputs for ChainerBatchNormalizationGrad";
+            break;
+        }
+
+        case kChainerConvTransposeWithDynamicOutputShape: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerConvTransposeWithDynamicOutputShape";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerConvTransposeWithDynamicOutputShape";
+            break;
+        }
+
+        case kChainerSoftmaxCrossEntropy: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSoftmaxCrossEntropy";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSoftmaxCrossEntropy";
+            break;
+        }
+
+        case kChainerSelectItem: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSelectItem";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSelectItem";
+            break;
+        }
+
+        case kChainerSelectItemGrad: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerSelectItemGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSelectItemGrad";
+            break;
+        }
+
+        case kChainerLRNGrad: {
+            CHECK_EQ(4, inputs.size()) << "Unexpected number of inputs for ChainerLRNGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerLRNGrad";
+            break;
+        }
+
+        case kChainerLSTMGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerLSTMGrad";
+            CHECK_EQ(4, outputs.size()) << "Unexpected number of outputs for ChainerLSTMGrad";
+            break;
+        }
+
+        case kChainerConvGradWeight: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerConvGradWeight";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerConvGradWeight";
+            break;
+        }
+
+        case kChainerGatherGrad: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerGatherGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGatherGrad";
+            break;
+        }
+
+        case kChainerConcatGrad: {
+            break;
+        }
+
+        case kChainerDynamicSliceGrad: {
+            CHECK(4 == inputs.size() || 5 == inputs.size() || 6 == inputs.size()) << "Unexpected number of inputs for ChainerDynamicSliceGrad (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerDynamicSliceGrad";
+            break;
+        }
+
+        case kChainerFusionGroup: {
+            break;
+        }
+
+        case kChainerGetItem: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGetItem";
+            break;
+        }
+
+        case kChainerGetItemGrad: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGetItemGrad";
+            break;
+        }
+
+        case kChainerPrint: {
+            CHECK_EQ(0, outputs.size()) << "Unexpected number of outputs for ChainerPrint";
+            break;
+        }
+
+        case kChainerNullConstant: {
+            CHECK_EQ(0, inputs.size()) << "Unexpected number of inputs for ChainerNullConstant";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerNullConstant";
+            break;
+        }
+
+        case kChainerSequenceConstants: {
+            CHECK_EQ(0, inputs.size()) << "Unexpected number of inputs for ChainerSequenceConstants";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceConstants";
+            break;
+        }
+
+        case kChainerSequenceCreate: {
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceCreate";
+            break;
+        }
+
+        case kChainerSequenceAppend: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSequenceAppend";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceAppend";
+            break;
+        }
+
+        case kChainerSequenceExtend: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSequenceExtend";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceExtend";
+            break;
+        }
+
+        case kChainerSequencePop: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequencePop";
+            CHECK_EQ(2, outputs.size()) << "Unexpected number of outputs for ChainerSequencePop";
+            break;
+        }
+
+        case kChainerSequenceLookup: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSequenceLookup";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceLookup";
+            break;
+        }
+
+        case kChainerSequenceGetSlice: {
+            CHECK(1 == inputs.size() || 2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size()) << "Unexpected number of inputs for ChainerSequenceGetSlice (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceGetSlice";
+            break;
+        }
+
+        case kChainerSequenceStack: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequenceStack";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceStack";
+            break;
+        }
+
+        case kChainerSequenceConcat: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequenceConcat";
+            CHECK(1 == outputs.size() || 2 == outputs.size()) << "Unexpected number of outputs for ChainerSequenceConcat (" << outputs.size() << ")";
+            break;
+        }
+
+        case kChainerSequenceSplitAxis: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSequenceSplitAxis";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceSplitAxis";
+            break;
+        }
+
+        case kChainerSequencePad: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequencePad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequencePad";
+            break;
+        }
+
+        case kChainerSequenceSeparate: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequenceSeparate";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceSeparate";
+            break;
+        }
+
+        case kChainerSequenceUnpad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerSequenceUnpad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceUnpad";
+            break;
+        }
+
+        case kChainerSequenceSize: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequenceSize";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceSize";
+            break;
+        }
+
+        case kChainerSequenceLengths: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerSequenceLengths";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceLengths";
+            break;
+        }
+
+        case kChainerSequenceRange: {
+            CHECK(1 == inputs.size() || 2 == inputs.size() || 3 == inputs.size()) << "Unexpected number of inputs for ChainerSequenceRange (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceRange";
+            break;
+        }
+
+        case kChainerSequenceLookupGrad: {
+            CHECK_EQ(3, inputs.size()) << "Unexpected number of inputs for ChainerSequenceLookupGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceLookupGrad";
+            break;
+        }
+
+        case kChainerSequenceGetSliceGrad: {
+            CHECK(2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size() || 5 == inputs.size()) << "Unexpected number of inputs for ChainerSequenceGetSliceGrad (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerSequenceGetSliceGrad";
+            break;
+        }
+
+        case kChainerGenericLen: {
+            CHECK_EQ(1, inputs.size()) << "Unexpected number of inputs for ChainerGenericLen";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericLen";
+            break;
+        }
+
+        case kChainerGenericGetItem: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerGenericGetItem";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericGetItem";
+            break;
+        }
+
+        case kChainerGenericGetSlice: {
+            CHECK(1 == inputs.size() || 2 == inputs.size() || 3 == inputs.size() || 4 == inputs.size()) << "Unexpected number of inputs for ChainerGenericGetSlice (" << inputs.size() << ")";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericGetSlice";
+            break;
+        }
+
+        case kChainerGenericAdd: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerGenericAdd";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericAdd";
+            break;
+        }
+
+        case kChainerGenericIs: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerGenericIs";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericIs";
+            break;
+        }
+
+        case kChainerGenericAccumulateGrad: {
+            CHECK_EQ(2, inputs.size()) << "Unexpected number of inputs for ChainerGenericAccumulateGrad";
+            CHECK_EQ(1, outputs.size()) << "Unexpected number of outputs for ChainerGenericAccumulateGrad";
+            break;
+        }
+    }
+}
+
+void NodeBase::ValidateAttributes() const {
+    switch (op_type_) {
+        case kIdentity: {
+            break;
+        }
+
+        case kNeg: {
+            break;
+        }
+
+        case kReciprocal: {
+            break;
+        }
+
+        case kExp: {
+            break;
+        }
+
+        case kLog: {
+            break;
+        }
+
+        case kSqrt: {
+            break;
+        }
+
+        case kIsNaN: {
+            break;
+        }
+
+        case kIsInf: {
+            break;
+        }
+
+        case kSign: {
+            break;
+        }
+
+        case kSin: {
+            break;
+        }
+
+        case kSinh: {
+            break;
+        }
+
+        case kCos: {
+            break;
+        }
+
+        case kCosh: {
+            break;
+        }
+
+        case kTan: {
+            break;
+        }
+
+        case kTanh: {
+            break;
+        }
+
+        case kAsin: {
+            break;
+        }
+
+        case kAsinh: {
+            break;
+        }
+
+        case kAcos: {
+            break;
+        }
+
+        case kAcosh: {
+            break;
+        }
+
+        case kAtan: {
+            break;
+        }
+
+        case kAtanh: {
+            break;
+        }
+
+        case kErf: {
+            break;
+        }
+
+        case kAbs: {
+            break;
+        }
+
+        case kRelu: {
+            break;
+        }
+
+        case kSelu: {
+            break;
+        }
+
+        case kLeakyRelu: {
+            break;
+        }
+
+        case kElu: {
+            break;
+        }
+
+        case kSigmoid: {
+            break;
+        }
+
+        case kNot: {
+            break;
+        }
+
+        case kFloor: {
+            break;
+        }
+
+        case kCeil: {
+            break;
+        }
+
+        case kSoftplus: {
+            break;
+        }
+
+        case kSoftsign: {
+            break;
+        }
+
+        case kAdd: {
+            break;
+        }
+
+        case kSub: {
+            break;
+        }
+
+        case kMul: {
+            break;
+        }
+
+        case kDiv: {
+            break;
+        }
+
+        case kPow: {
+            break;
+        }
+
+        case kEqual: {
+            break;
+        }
+
+        case kGreater: {
+            break;
+        }
+
+        case kLess: {
+            break;
+        }
+
+        case kAnd: {
+            break;
+        }
+
+        case kOr: {
+            break;
+        }
+
+        case kXor: {
+            break;
+        }
+
+        case kConstant: {
+            CHECK(was_tensor_value_set_) << "tensor_value is mandatory for Constant";
+            break;
+        }
+
+        case kConstantOfShape: {
+            break;
+        }
+
+        case kConstantLike: {
+            break;
+        }
+
+        case kConstantFill: {
+            break;
+        }
+
+        case kOneHot: {
+            break;
+        }
+
+        case kCast: {
+            CHECK(was_to_set_) << "to is mandatory for Cast";
+            break;
+        }
+
+        case kShape: {
+            break;
+        }
+
+        case kSize: {
+            break;
+        }
+
+        case kReshape: {
+            break;
+        }
+
+        case kExpand: {
+            break;
+        }
+
+        case kSqueeze: {
+            break;
+        }
+
+        case kUnsqueeze: {
+            CHECK(was_axes_set_) << "axes is mandatory for Unsqueeze";
+            break;
+        }
+
+        case kFlatten: {
+            break;
+        }
+
+        case kSlice: {
+            break;
+        }
+
+        case kDynamicSlice: {
+            break;
+        }
+
+        case kGather: {
+            break;
+        }
+
+        case kConcat: {
+            CHECK(was_axis_set_) << "axis is mandatory for Concat";
+            break;
+        }
+
+        case kSplit: {
+            break;
+        }
+
+        case kTranspose: {
+            break;
+        }
+
+        case kEyeLike: {
+            break;
+        }
+
+        case kDepthToSpace: {
+            CHECK(was_blocksize_set_) << "blocksize is mandatory for DepthToSpace";
+            break;
+        }
+
+        case kSpaceToDepth: {
+            CHECK(was_blocksize_set_) << "blocksize is mandatory for SpaceToDepth";
+            break;
+        }
+
+        case kSum: {
+            break;
+        }
+
+        case kMean: {
+            break;
+        }
+
+        case kMax: {
+            break;
+        }
+
+        case kMin: {
+            break;
+        }
+
+        case kClip: {
+            break;
+        }
+
+        case kReduceSum: {
+            break;
+        }
+
+        case kReduceSumSquare: {
+            break;
+        }
+
+        case kReduceMean: {
+            break;
+        }
+
+        case kReduceMax: {
+            break;
+        }
+
+        case kReduceMin: {
+            break;
+        }
+
+        case kReduceL1: {
+            break;
+        }
+
+        case kReduceL2: {
+            break;
+        }
+
+        case kReduceLogSum: {
+            break;
+        }
+
+        case kReduceLogSumExp: {
+            break;
+        }
+
+        case kReduceProd: {
+            break;
+        }
+
+        case kArgMax: {
+            break;
+        }
+
+        case kArgMin: {
+            break;
+        }
+
+        case kHardmax: {
+            break;
+        }
+
+        case kDropout: {
+            break;
+        }
+
+        case kMatMul: {
+            break;
+        }
+
+        case kGemm: {
+            break;
+        }
+
+        case kRNN: {
+            break;
+        }
+
+        case kGRU: {
+            break;
+        }
+
+        case kLSTM: {
+            break;
+        }
+
+        case kConv: {
+            break;
+        }
+
+        case kConvTranspose: {
+            break;
+        }
+
+        case kBatchNormalization: {
+            break;
+        }
+
+        case kLRN: {
+            CHECK(was_size_set_) << "size is mandatory for LRN";
+            break;
+        }
+
+        case kLpNormalization: {
+            break;
+        }
+
+        case kMaxPool: {
+            CHECK(was_kernel_shape_set_) << "kernel_shape is mandatory for MaxPool";
+            break;
+        }
+
+        case kAveragePool: {
+            CHECK(was_kernel_shape_set_) << "kernel_shape is mandatory for AveragePool";
+            break;
+        }
+
+        case kGlobalMaxPool: {
+            break;
+        }
+
+        case kGlobalAveragePool: {
+            break;
+        }
+
+        case kPad: {
+            break;
+        }
+
+        case kUpsample: {
+            break;
+        }
+
+        case kResize: {
+            break;
+        }
+
+        case kSoftmax: {
+            break;
+        }
+
+        case kLogSoftmax: {
+            break;
+        }
+
+        case kIf: {
+            break;
+        }
+
+        case kLoop: {
+            break;
+        }
+
+        case kWhere: {
+            break;
+        }
+
+        case kImageScaler: {
+            break;
+        }
+
+        case kMaxRoiPool: {
+            CHECK(was_pooled_shape_set_) << "pooled_shape is mandatory for MaxRoiPool";
+            break;
+        }
+
+        case kNonMaxSuppression: {
+            break;
+        }
+
+        case kRoiAlign: {
+            break;
+        }
+
+        case kQuantizeLinear: {
+            break;
+        }
+
+        case kDequantizeLinear: {
+            break;
+        }
+
+        case kQLinearConv: {
+            break;
+        }
+
+        case kQLinearMatMul: {
+            break;
+        }
+
+        case kMatMulInteger: {
+            break;
+        }
+
+        case kConvInteger: {
+            break;
+        }
+
+        case kRound: {
+            break;
+        }
+
+        case kBitShift: {
+            break;
+        }
+
+        case kChainerLinear: {
+            break;
+        }
+
+        case kChainerLinearGradWeight: {
+            break;
+        }
+
+        case kChainerReluGrad: {
+            break;
+        }
+
+        case kChainerReduceSumTo: {
+            break;
+        }
+
+        case kChainerROIMaxPool2D: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIMaxPool2D";
+            break;
+        }
+
+        case kChainerROIAveragePool2D: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIAveragePool2D";
+            break;
+        }
+
+        case kChainerROIMaxAlign2D: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIMaxAlign2D";
+            break;
+        }
+
+        case kChainerROIAverageAlign2D: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIAverageAlign2D";
+            break;
+        }
+
+        case kChainerResizeImages: {
+            break;
+        }
+
+        case kChainerPadBatchSize: {
+            CHECK(was_size_set_) << "size is mandatory for ChainerPadBatchSize";
+            break;
+        }
+
+        case kChainerDoSomething: {
+            CHECK(was_function_name_set_) << "function_name is mandatory for ChainerDoSomething";
+            break;
+        }
+
+        case kChainerMaxPoolGrad: {
+            CHECK(was_kernel_shape_set_) << "kernel_shape is mandatory for ChainerMaxPoolGrad";
+            break;
+        }
+
+        case kChainerAveragePoolGrad: {
+            CHECK(was_kernel_shape_set_) << "kernel_shape is mandatory for ChainerAveragePoolGrad";
+            break;
+        }
+
+        case kChainerResizeGrad: {
+            break;
+        }
+
+        case kChainerROIMaxPool2DGrad: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIMaxPool2DGrad";
+            break;
+        }
+
+        case kChainerROIAveragePool2DGrad: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIAveragePool2DGrad";
+            break;
+        }
+
+        case kChainerROIMaxAlign2DGrad: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIMaxAlign2DGrad";
+            break;
+        }
+
+        case kChainerROIAverageAlign2DGrad: {
+            CHECK(was_spatial_scale_set_) << "spatial_scale is mandatory for ChainerROIAverageAlign2DGrad";
+            break;
+        }
+
+        case kChainerBatchNormalizationGrad: {
+            break;
+        }
+
+        case kChainerConvTransposeWithDynamicOutputShape: {
+            break;
+        }
+
+        case kChainerSoftmaxCrossEntropy: {
+            break;
+        }
+
+        case kChainerSelectItem: {
+            break;
+        }
+
+        case kChainerSelectItemGrad: {
+            break;
+        }
+
+        case kChainerLRNGrad: {
+            CHECK(was_size_set_) << "size is mandatory for ChainerLRNGrad";
+            break;
+        }
+
+        case kChainerLSTMGrad: {
+            break;
+        }
+
+        case kChainerConvGradWeight: {
+            break;
+        }
+
+        case kChainerGatherGrad: {
+            break;
+        }
+
+        case kChainerConcatGrad: {
+            break;
+        }
+
+        case kChainerDynamicSliceGrad: {
+            break;
+        }
+
+        case kChainerFusionGroup: {
+            break;
+        }
+
+        case kChainerGetItem: {
+            break;
+        }
+
+        case kChainerGetItemGrad: {
+            break;
+        }
+
+        case kChainerPrint: {
+            break;
+        }
+
+        case kChainerNullConstant: {
+            break;
+        }
+
+        case kChainerSequenceConstants: {
+            break;
+        }
+
+        case kChainerSequenceCreate: {
+            break;
+        }
+
+        case kChainerSequenceAppend: {
+            break;
+        }
+
+        case kChainerSequenceExtend: {
+            break;
+        }
+
+        case kChainerSequencePop: {
+            break;
+        }
+
+        case kChainerSequenceLookup: {
+            break;
+        }
+
+        case kChainerSequenceGetSlice: {
+            break;
+        }
+
+        case kChainerSequenceStack: {
+            break;
+        }
+
+        case kChainerSequenceConcat: {
+            break;
+        }
+
+        case kChainerSequenceSplitAxis: {
+            break;
+        }
+
+        case kChainerSequencePad: {
+            break;
+        }
+
+        case kChainerSequenceSeparate: {
+            break;
+        }
+
+        case kChainerSequenceUnpad: {
+            break;
+        }
+
+        case kChainerSequenceSize: {
+            break;
+        }
+
+        case kChainerSequenceLengths: {
+            break;
+        }
+
+        case kChainerSequenceRange: {
+            break;
+        }
+
+        case kChainerSequenceLookupGrad: {
+            break;
+        }
+
+        case kChainerSequenceGetSliceGrad: {
+            break;
+        }
+
+        case kChainerGenericLen: {
+            break;
+        }
+
+        case kChainerGenericGetItem: {
+            break;
+        }
+
+        case kChainerGenericGetSlice: {
+            break;
+        }
+
+        case kChainerGenericAdd: {
+            break;
+        }
+
+        case kChainerGenericIs: {
+            break;
+        }
+
+        case kChainerGenericAccumulateGrad: {
+            break;
+        }
+    }
+}
+
+NodeBase* NodeBase::set_activation_alpha(const std::vector<float>& activation_alpha) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM) << "Invalid attribute `activation_alpha' for " << OpTypeToString(op_type_);
+    activation_alpha_ = activation_alpha;
+    was_activation_alpha_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_activation_beta(const std::vector<float>& activation_beta) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM) << "Invalid attribute `activation_beta' for " << OpTypeToString(op_type_);
+    activation_beta_ = activation_beta;
+    was_activation_beta_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_activations(const std::vector<std::string>& activations) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM) << "Invalid attribute `activations' for " << OpTypeToString(op_type_);
+    activations_ = activations;
+    was_activations_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_alpha(float alpha) {
+    CHECK(op_type_ == kSelu || op_type_ == kLeakyRelu || op_type_ == kElu || op_type_ == kGemm || op_type_ == kLRN || op_type_ == kChainerLRNGrad) << "Invalid attribute `alpha' for " << OpTypeToString(op_type_);
+    alpha_ = alpha;
+    was_alpha_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_auto_pad(const std::string& auto_pad) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `auto_pad' for " << OpTypeToString(op_type_);
+    auto_pad_ = auto_pad;
+    was_auto_pad_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_axes(const std::vector<int64_t>& axes) {
+    CHECK(op_type_ == kSqueeze || op_type_ == kUnsqueeze || op_type_ == kSlice || op_type_ == kReduceSum || op_type_ == kReduceSumSquare || op_type_ == kReduceMean || op_type_ == kReduceMax || op_type_ == kReduceMin || op_type_ == kReduceL1 || op_type_ == kReduceL2 || op_type_ == kReduceLogSum || op_type_ == kReduceLogSumExp || op_type_ == kReduceProd) << "Invalid attribute `axes' for " << OpTypeToString(op_type_);
+    axes_ = axes;
+    was_axes_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_axis(int64_t axis) {
+    CHECK(op_type_ == kOneHot || op_type_ == kFlatten || op_type_ == kGather || op_type_ == kConcat || op_type_ == kSplit || op_type_ == kArgMax || op_type_ == kArgMin || op_type_ == kHardmax || op_type_ == kLpNormalization || op_type_ == kSoftmax || op_type_ == kLogSoftmax || op_type_ == kChainerGatherGrad || op_type_ == kChainerConcatGrad || op_type_ == kChainerSequenceStack || op_type_ == kChainerSequenceConcat || op_type_ == kChainerSequenceSplitAxis || op_type_ == kChainerSequenceSeparate) << "Invalid attribute `axis' for " << OpTypeToString(op_type_);
+    axis_ = axis;
+    was_axis_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_beta(float beta) {
+    CHECK(op_type_ == kGemm || op_type_ == kLRN || op_type_ == kChainerLRNGrad) << "Invalid attribute `beta' for " << OpTypeToString(op_type_);
+    beta_ = beta;
+    was_beta_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_bias(float bias) {
+    CHECK(op_type_ == kLRN || op_type_ == kChainerLRNGrad) << "Invalid attribute `bias' for " << OpTypeToString(op_type_);
+    bias_ = bias;
+    was_bias_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_bias_list(const std::vector<float>& bias_list) {
+    CHECK(op_type_ == kImageScaler) << "Invalid attribute `bias_list' for " << OpTypeToString(op_type_);
+    bias_list_ = bias_list;
+    was_bias_list_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_blocksize(int64_t blocksize) {
+    CHECK(op_type_ == kDepthToSpace || op_type_ == kSpaceToDepth) << "Invalid attribute `blocksize' for " << OpTypeToString(op_type_);
+    blocksize_ = blocksize;
+    was_blocksize_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_body(Graph* body) {
+    CHECK(op_type_ == kLoop) << "Invalid attribute `body' for " << OpTypeToString(op_type_);
+    body_.reset(body);
+    was_body_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_center_point_box(int64_t center_point_box) {
+    CHECK(op_type_ == kNonMaxSuppression) << "Invalid attribute `center_point_box' for " << OpTypeToString(op_type_);
+    center_point_box_ = center_point_box;
+    was_center_point_box_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_cover_all(bool chainer_cover_all) {
+    CHECK(op_type_ == kMaxPool || op_type_ == kChainerMaxPoolGrad) << "Invalid attribute `chainer_cover_all' for " << OpTypeToString(op_type_);
+    chainer_cover_all_ = chainer_cover_all;
+    was_chainer_cover_all_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_fusion_group(int64_t chainer_fusion_group) {
+    CHECK(op_type_ == kIdentity || op_type_ == kNeg || op_type_ == kReciprocal || op_type_ == kExp || op_type_ == kLog || op_type_ == kSqrt || op_type_ == kIsNaN || op_type_ == kIsInf || op_type_ == kSign || op_type_ == kSin || op_type_ == kSinh || op_type_ == kCos || op_type_ == kCosh || op_type_ == kTan || op_type_ == kTanh || op_type_ == kAsin || op_type_ == kAsinh || op_type_ == kAcos || op_type_ == kAcosh || op_type_ == kAtan || op_type_ == kAtanh || op_type_ == kErf || op_type_ == kAbs || op_type_ == kRelu || op_type_ == kSelu || op_type_ == kLeakyRelu || op_type_ == kElu || op_type_ == kSigmoid || op_type_ == kNot || op_type_ == kFloor || op_type_ == kCeil || op_type_ == kSoftplus || op_type_ == kSoftsign || op_type_ == kAdd || op_type_ == kSub || op_type_ == kMul || op_type_ == kDiv || op_type_ == kPow || op_type_ == kEqual || op_type_ == kGreater || op_type_ == kLess || op_type_ == kAnd || op_type_ == kOr || op_type_ == kXor || op_type_ == kConstant || op_type_ == kConstantOfShape || op_type_ == kConstantLike || op_type_ == kConstantFill || op_type_ == kOneHot || op_type_ == kCast || op_type_ == kShape || op_type_ == kSize || op_type_ == kReshape || op_type_ == kExpand || op_type_ == kSqueeze || op_type_ == kUnsqueeze || op_type_ == kFlatten || op_type_ == kSlice || op_type_ == kDynamicSlice || op_type_ == kGather || op_type_ == kConcat || op_type_ == kSplit || op_type_ == kTranspose || op_type_ == kEyeLike || op_type_ == kDepthToSpace || op_type_ == kSpaceToDepth || op_type_ == kSum || op_type_ == kMean || op_type_ == kMax || op_type_ == kMin || op_type_ == kClip || op_type_ == kReduceSum || op_type_ == kReduceSumSquare || op_type_ == kReduceMean || op_type_ == kReduceMax || op_type_ == kReduceMin || op_type_ == kReduceL1 || op_type_ == kReduceL2 || op_type_ == kReduceLogSum || op_type_ == kReduceLogSumExp || op_type_ == kReduceProd || op_type_ == kArgMax || op_type_ == kArgMin || op_type_ == kHardmax || op_type_ == kDropout || op_type_ == kMatMul || op_type_ == kGemm || op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM || op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kBatchNormalization || op_type_ == kLRN || op_type_ == kLpNormalization || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kGlobalMaxPool || op_type_ == kGlobalAveragePool || op_type_ == kPad || op_type_ == kUpsample || op_type_ == kResize || op_type_ == kSoftmax || op_type_ == kLogSoftmax || op_type_ == kIf || op_type_ == kLoop || op_type_ == kWhere || op_type_ == kImageScaler || op_type_ == kMaxRoiPool || op_type_ == kNonMaxSuppression || op_type_ == kRoiAlign || op_type_ == kQuantizeLinear || op_type_ == kDequantizeLinear || op_type_ == kQLinearConv || op_type_ == kQLinearMatMul || op_type_ == kMatMulInteger || op_type_ == kConvInteger || op_type_ == kRound || op_type_ == kBitShift || op_type_ == kChainerLinear || op_type_ == kChainerLinearGradWeight || op_type_ == kChainerReluGrad || op_type_ == kChainerReduceSumTo || op_type_ == kChainerROIMaxPool2D || op_type_ == kChainerROIAveragePool2D || op_type_ == kChainerROIMaxAlign2D || op_type_ == kChainerROIAverageAlign2D || op_type_ == kChainerResizeImages || op_type_ == kChainerPadBatchSize || op_type_ == kChainerDoSomething || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerResizeGrad || op_type_ == kChainerROIMaxPool2DGrad || op_type_ == kChainerROIAveragePool2DGrad || op_type_ == kChainerROIMaxAlign2DGrad || op_type_ == kChainerROIAverageAlign2DGrad || op_type_ == kChainerBatchNormalizationGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerSoftmaxCrossEntropy || op_type_ == kChainerSelectItem || op_type_ == kChainerSelectItemGrad || op_type_ == kChainerLRNGrad || op_type_ == kChainerLSTMGrad || op_type_ == kChainerConvGradWeight || op_type_ == kChainerGatherGrad || op_type_ == kChainerConcatGrad || op_type_ == kChainerDynamicSliceGrad || op_type_ == kChainerFusionGroup || op_type_ == kChainerGetItem || op_type_ == kChainerGetItemGrad || op_type_ == kChainerPrint || op_type_ == kChainerNullConstant || op_type_ == kChainerSequenceConstants || op_type_ == kChainerSequenceCreate || op_type_ == kChainerSequenceAppend || op_type_ == kChainerSequenceExtend || op_type_ == kChainerSequencePop || op_type_ == kChainerSequenceLookup || op_type_ == kChainerSequenceGetSlice || op_type_ == kChainerSequenceStack || op_type_ == kChainerSequenceConcat || op_type_ == kChainerSequenceSplitAxis || op_type_ == kChainerSequencePad || op_type_ == kChainerSequenceSeparate || op_type_ == kChainerSequenceUnpad || op_type_ == kChainerSequenceSize || op_type_ == kChainerSequenceLengths || op_type_ == kChainerSequenceRange || op_type_ == kChainerSequenceLookupGrad || op_type_ == kChainerSequenceGetSliceGrad || op_type_ == kChainerGenericLen || op_type_ == kChainerGenericGetItem || op_type_ == kChainerGenericGetSlice || op_type_ == kChainerGenericAdd || op_type_ == kChainerGenericIs || op_type_ == kChainerGenericAccumulateGrad) << "Invalid attribute `chainer_fusion_group' for " << OpTypeToString(op_type_);
+    chainer_fusion_group_ = chainer_fusion_group;
+    was_chainer_fusion_group_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_host(bool chainer_host) {
+    CHECK(op_type_ == kConstant) << "Invalid attribute `chainer_host' for " << OpTypeToString(op_type_);
+    chainer_host_ = chainer_host;
+    was_chainer_host_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_in_recomputing(int64_t chainer_in_recomputing) {
+    CHECK(op_type_ == kBatchNormalization) << "Invalid attribute `chainer_in_recomputing' for " << OpTypeToString(op_type_);
+    chainer_in_recomputing_ = chainer_in_recomputing;
+    was_chainer_in_recomputing_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_is_onnx_semantics(bool chainer_is_onnx_semantics) {
+    CHECK(op_type_ == kSoftmax || op_type_ == kLogSoftmax) << "Invalid attribute `chainer_is_onnx_semantics' for " << OpTypeToString(op_type_);
+    chainer_is_onnx_semantics_ = chainer_is_onnx_semantics;
+    was_chainer_is_onnx_semantics_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_order(int64_t chainer_order) {
+    CHECK(op_type_ == kIdentity || op_type_ == kNeg || op_type_ == kReciprocal || op_type_ == kExp || op_type_ == kLog || op_type_ == kSqrt || op_type_ == kIsNaN || op_type_ == kIsInf || op_type_ == kSign || op_type_ == kSin || op_type_ == kSinh || op_type_ == kCos || op_type_ == kCosh || op_type_ == kTan || op_type_ == kTanh || op_type_ == kAsin || op_type_ == kAsinh || op_type_ == kAcos || op_type_ == kAcosh || op_type_ == kAtan || op_type_ == kAtanh || op_type_ == kErf || op_type_ == kAbs || op_type_ == kRelu || op_type_ == kSelu || op_type_ == kLeakyRelu || op_type_ == kElu || op_type_ == kSigmoid || op_type_ == kNot || op_type_ == kFloor || op_type_ == kCeil || op_type_ == kSoftplus || op_type_ == kSoftsign || op_type_ == kAdd || op_type_ == kSub || op_type_ == kMul || op_type_ == kDiv || op_type_ == kPow || op_type_ == kEqual || op_type_ == kGreater || op_type_ == kLess || op_type_ == kAnd || op_type_ == kOr || op_type_ == kXor || op_type_ == kConstant || op_type_ == kConstantOfShape || op_type_ == kConstantLike || op_type_ == kConstantFill || op_type_ == kOneHot || op_type_ == kCast || op_type_ == kShape || op_type_ == kSize || op_type_ == kReshape || op_type_ == kExpand || op_type_ == kSqueeze || op_type_ == kUnsqueeze || op_type_ == kFlatten || op_type_ == kSlice || op_type_ == kDynamicSlice || op_type_ == kGather || op_type_ == kConcat || op_type_ == kSplit || op_type_ == kTranspose || op_type_ == kEyeLike || op_type_ == kDepthToSpace || op_type_ == kSpaceToDepth || op_type_ == kSum || op_type_ == kMean || op_type_ == kMax || op_type_ == kMin || op_type_ == kClip || op_type_ == kReduceSum || op_type_ == kReduceSumSquare || op_type_ == kReduceMean || op_type_ == kReduceMax || op_type_ == kReduceMin || op_type_ == kReduceL1 || op_type_ == kReduceL2 || op_type_ == kReduceLogSum || op_type_ == kReduceLogSumExp || op_type_ == kReduceProd || op_type_ == kArgMax || op_type_ == kArgMin || op_type_ == kHardmax || op_type_ == kDropout || op_type_ == kMatMul || op_type_ == kGemm || op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM || op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kBatchNormalization || op_type_ == kLRN || op_type_ == kLpNormalization || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kGlobalMaxPool || op_type_ == kGlobalAveragePool || op_type_ == kPad || op_type_ == kUpsample || op_type_ == kResize || op_type_ == kSoftmax || op_type_ == kLogSoftmax || op_type_ == kIf || op_type_ == kLoop || op_type_ == kWhere || op_type_ == kImageScaler || op_type_ == kMaxRoiPool || op_type_ == kNonMaxSuppression || op_type_ == kRoiAlign || op_type_ == kQuantizeLinear || op_type_ == kDequantizeLinear || op_type_ == kQLinearConv || op_type_ == kQLinearMatMul || op_type_ == kMatMulInteger || op_type_ == kConvInteger || op_type_ == kRound || op_type_ == kBitShift || op_type_ == kChainerLinear || op_type_ == kChainerLinearGradWeight || op_type_ == kChainerReluGrad || op_type_ == kChainerReduceSumTo || op_type_ == kChainerROIMaxPool2D || op_type_ == kChainerROIAveragePool2D || op_type_ == kChainerROIMaxAlign2D || op_type_ == kChainerROIAverageAlign2D || op_type_ == kChainerResizeImages || op_type_ == kChainerPadBatchSize || op_type_ == kChainerDoSomething || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerResizeGrad || op_type_ == kChainerROIMaxPool2DGrad || op_type_ == kChainerROIAveragePool2DGrad || op_type_ == kChainerROIMaxAlign2DGrad || op_type_ == kChainerROIAverageAlign2DGrad || op_type_ == kChainerBatchNormalizationGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerSoftmaxCrossEntropy || op_type_ == kChainerSelectItem || op_type_ == kChainerSelectItemGrad || op_type_ == kChainerLRNGrad || op_type_ == kChainerLSTMGrad || op_type_ == kChainerConvGradWeight || op_type_ == kChainerGatherGrad || op_type_ == kChainerConcatGrad || op_type_ == kChainerDynamicSliceGrad || op_type_ == kChainerFusionGroup || op_type_ == kChainerGetItem || op_type_ == kChainerGetItemGrad || op_type_ == kChainerPrint || op_type_ == kChainerNullConstant || op_type_ == kChainerSequenceConstants || op_type_ == kChainerSequenceCreate || op_type_ == kChainerSequenceAppend || op_type_ == kChainerSequenceExtend || op_type_ == kChainerSequencePop || op_type_ == kChainerSequenceLookup || op_type_ == kChainerSequenceGetSlice || op_type_ == kChainerSequenceStack || op_type_ == kChainerSequenceConcat || op_type_ == kChainerSequenceSplitAxis || op_type_ == kChainerSequencePad || op_type_ == kChainerSequenceSeparate || op_type_ == kChainerSequenceUnpad || op_type_ == kChainerSequenceSize || op_type_ == kChainerSequenceLengths || op_type_ == kChainerSequenceRange || op_type_ == kChainerSequenceLookupGrad || op_type_ == kChainerSequenceGetSliceGrad || op_type_ == kChainerGenericLen || op_type_ == kChainerGenericGetItem || op_type_ == kChainerGenericGetSlice || op_type_ == kChainerGenericAdd || op_type_ == kChainerGenericIs || op_type_ == kChainerGenericAccumulateGrad) << "Invalid attribute `chainer_order' for " << OpTypeToString(op_type_);
+    chainer_order_ = chainer_order;
+    was_chainer_order_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_chainer_stack_axis(int64_t chainer_stack_axis) {
+    CHECK(op_type_ == kLoop) << "Invalid attribute `chainer_stack_axis' for " << OpTypeToString(op_type_);
+    chainer_stack_axis_ = chainer_stack_axis;
+    was_chainer_stack_axis_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_clip(float clip) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM) << "Invalid attribute `clip' for " << OpTypeToString(op_type_);
+    clip_ = clip;
+    was_clip_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_count_include_pad(bool count_include_pad) {
+    CHECK(op_type_ == kAveragePool || op_type_ == kChainerAveragePoolGrad) << "Invalid attribute `count_include_pad' for " << OpTypeToString(op_type_);
+    count_include_pad_ = count_include_pad;
+    was_count_include_pad_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_detect_negative(int64_t detect_negative) {
+    CHECK(op_type_ == kIsInf) << "Invalid attribute `detect_negative' for " << OpTypeToString(op_type_);
+    detect_negative_ = detect_negative;
+    was_detect_negative_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_detect_positive(int64_t detect_positive) {
+    CHECK(op_type_ == kIsInf) << "Invalid attribute `detect_positive' for " << OpTypeToString(op_type_);
+    detect_positive_ = detect_positive;
+    was_detect_positive_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_dilations(const std::vector<int64_t>& dilations) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `dilations' for " << OpTypeToString(op_type_);
+    dilations_ = dilations;
+    was_dilations_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_direction(const std::string& direction) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM || op_type_ == kBitShift) << "Invalid attribute `direction' for " << OpTypeToString(op_type_);
+    direction_ = direction;
+    was_direction_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_dtype(Dtype dtype) {
+    CHECK(op_type_ == kConstantLike || op_type_ == kConstantFill || op_type_ == kEyeLike) << "Invalid attribute `dtype' for " << OpTypeToString(op_type_);
+    dtype_ = dtype;
+    was_dtype_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_else_branch(Graph* else_branch) {
+    CHECK(op_type_ == kIf) << "Invalid attribute `else_branch' for " << OpTypeToString(op_type_);
+    else_branch_.reset(else_branch);
+    was_else_branch_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_ends(const std::vector<int64_t>& ends) {
+    CHECK(op_type_ == kSlice) << "Invalid attribute `ends' for " << OpTypeToString(op_type_);
+    ends_ = ends;
+    was_ends_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_epsilon(float epsilon) {
+    CHECK(op_type_ == kBatchNormalization) << "Invalid attribute `epsilon' for " << OpTypeToString(op_type_);
+    epsilon_ = epsilon;
+    was_epsilon_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_extra_shape(const std::vector<int64_t>& extra_shape) {
+    CHECK(op_type_ == kConstantFill) << "Invalid attribute `extra_shape' for " << OpTypeToString(op_type_);
+    extra_shape_ = extra_shape;
+    was_extra_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_function_name(const std::string& function_name) {
+    CHECK(op_type_ == kChainerDoSomething) << "Invalid attribute `function_name' for " << OpTypeToString(op_type_);
+    function_name_ = function_name;
+    was_function_name_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_fusion_type(const std::string& fusion_type) {
+    CHECK(op_type_ == kChainerFusionGroup) << "Invalid attribute `fusion_type' for " << OpTypeToString(op_type_);
+    fusion_type_ = fusion_type;
+    was_fusion_type_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_gamma(float gamma) {
+    CHECK(op_type_ == kSelu) << "Invalid attribute `gamma' for " << OpTypeToString(op_type_);
+    gamma_ = gamma;
+    was_gamma_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_group(int64_t group) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `group' for " << OpTypeToString(op_type_);
+    group_ = group;
+    was_group_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_height_scale(float height_scale) {
+    CHECK(op_type_ == kUpsample) << "Invalid attribute `height_scale' for " << OpTypeToString(op_type_);
+    height_scale_ = height_scale;
+    was_height_scale_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_hidden_size(int64_t hidden_size) {
+    CHECK(op_type_ == kRNN || op_type_ == kGRU || op_type_ == kLSTM) << "Invalid attribute `hidden_size' for " << OpTypeToString(op_type_);
+    hidden_size_ = hidden_size;
+    was_hidden_size_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_input_as_shape(int64_t input_as_shape) {
+    CHECK(op_type_ == kConstantFill) << "Invalid attribute `input_as_shape' for " << OpTypeToString(op_type_);
+    input_as_shape_ = input_as_shape;
+    was_input_as_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_input_forget(int64_t input_forget) {
+    CHECK(op_type_ == kLSTM) << "Invalid attribute `input_forget' for " << OpTypeToString(op_type_);
+    input_forget_ = input_forget;
+    was_input_forget_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_k(int64_t k) {
+    CHECK(op_type_ == kEyeLike) << "Invalid attribute `k' for " << OpTypeToString(op_type_);
+    k_ = k;
+    was_k_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_keepdims(bool keepdims) {
+    CHECK(op_type_ == kReduceSum || op_type_ == kReduceSumSquare || op_type_ == kReduceMean || op_type_ == kReduceMax || op_type_ == kReduceMin || op_type_ == kReduceL1 || op_type_ == kReduceL2 || op_type_ == kReduceLogSum || op_type_ == kReduceLogSumExp || op_type_ == kReduceProd || op_type_ == kArgMax || op_type_ == kArgMin) << "Invalid attribute `keepdims' for " << OpTypeToString(op_type_);
+    keepdims_ = keepdims;
+    was_keepdims_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_kernel_shape(const std::vector<int64_t>& kernel_shape) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `kernel_shape' for " << OpTypeToString(op_type_);
+    kernel_shape_ = kernel_shape;
+    was_kernel_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_length(int64_t length) {
+    CHECK(op_type_ == kChainerSequencePad) << "Invalid attribute `length' for " << OpTypeToString(op_type_);
+    length_ = length;
+    was_length_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_linear_before_reset(int64_t linear_before_reset) {
+    CHECK(op_type_ == kGRU) << "Invalid attribute `linear_before_reset' for " << OpTypeToString(op_type_);
+    linear_before_reset_ = linear_before_reset;
+    was_linear_before_reset_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_max(float max) {
+    CHECK(op_type_ == kClip) << "Invalid attribute `max' for " << OpTypeToString(op_type_);
+    max_ = max;
+    was_max_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_min(float min) {
+    CHECK(op_type_ == kClip) << "Invalid attribute `min' for " << OpTypeToString(op_type_);
+    min_ = min;
+    was_min_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_mode(const std::string& mode) {
+    CHECK(op_type_ == kPad || op_type_ == kUpsample || op_type_ == kResize || op_type_ == kRoiAlign) << "Invalid attribute `mode' for " << OpTypeToString(op_type_);
+    mode_ = mode;
+    was_mode_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_momentum(float momentum) {
+    CHECK(op_type_ == kBatchNormalization) << "Invalid attribute `momentum' for " << OpTypeToString(op_type_);
+    momentum_ = momentum;
+    was_momentum_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_n_batch_axes(int64_t n_batch_axes) {
+    CHECK(op_type_ == kChainerLinear) << "Invalid attribute `n_batch_axes' for " << OpTypeToString(op_type_);
+    n_batch_axes_ = n_batch_axes;
+    was_n_batch_axes_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_output_height(int64_t output_height) {
+    CHECK(op_type_ == kRoiAlign) << "Invalid attribute `output_height' for " << OpTypeToString(op_type_);
+    output_height_ = output_height;
+    was_output_height_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_output_padding(const std::vector<int64_t>& output_padding) {
+    CHECK(op_type_ == kConvTranspose) << "Invalid attribute `output_padding' for " << OpTypeToString(op_type_);
+    output_padding_ = output_padding;
+    was_output_padding_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_output_shape(const std::vector<int64_t>& output_shape) {
+    CHECK(op_type_ == kConvTranspose || op_type_ == kChainerROIMaxPool2D || op_type_ == kChainerROIAveragePool2D || op_type_ == kChainerROIMaxAlign2D || op_type_ == kChainerROIAverageAlign2D || op_type_ == kChainerResizeImages || op_type_ == kChainerROIMaxPool2DGrad || op_type_ == kChainerROIAveragePool2DGrad || op_type_ == kChainerROIMaxAlign2DGrad || op_type_ == kChainerROIAverageAlign2DGrad) << "Invalid attribute `output_shape' for " << OpTypeToString(op_type_);
+    output_shape_ = output_shape;
+    was_output_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_output_width(int64_t output_width) {
+    CHECK(op_type_ == kRoiAlign) << "Invalid attribute `output_width' for " << OpTypeToString(op_type_);
+    output_width_ = output_width;
+    was_output_width_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_p(int64_t p) {
+    CHECK(op_type_ == kLpNormalization) << "Invalid attribute `p' for " << OpTypeToString(op_type_);
+    p_ = p;
+    was_p_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_pads(const std::vector<int64_t>& pads) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kPad || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `pads' for " << OpTypeToString(op_type_);
+    pads_ = pads;
+    was_pads_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_perm(const std::vector<int64_t>& perm) {
+    CHECK(op_type_ == kTranspose) << "Invalid attribute `perm' for " << OpTypeToString(op_type_);
+    perm_ = perm;
+    was_perm_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_pooled_shape(const std::vector<int64_t>& pooled_shape) {
+    CHECK(op_type_ == kMaxRoiPool) << "Invalid attribute `pooled_shape' for " << OpTypeToString(op_type_);
+    pooled_shape_ = pooled_shape;
+    was_pooled_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_ratio(float ratio) {
+    CHECK(op_type_ == kDropout) << "Invalid attribute `ratio' for " << OpTypeToString(op_type_);
+    ratio_ = ratio;
+    was_ratio_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_sampling_ratio(int64_t sampling_ratio) {
+    CHECK(op_type_ == kRoiAlign) << "Invalid attribute `sampling_ratio' for " << OpTypeToString(op_type_);
+    sampling_ratio_ = sampling_ratio;
+    was_sampling_ratio_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_sampling_ratio_list(const std::vector<int64_t>& sampling_ratio_list) {
+    CHECK(op_type_ == kChainerROIMaxAlign2D || op_type_ == kChainerROIAverageAlign2D || op_type_ == kChainerROIMaxAlign2DGrad || op_type_ == kChainerROIAverageAlign2DGrad) << "Invalid attribute `sampling_ratio_list' for " << OpTypeToString(op_type_);
+    sampling_ratio_list_ = sampling_ratio_list;
+    was_sampling_ratio_list_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_scale(float scale) {
+    CHECK(op_type_ == kImageScaler) << "Invalid attribute `scale' for " << OpTypeToString(op_type_);
+    scale_ = scale;
+    was_scale_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_shape(const std::vector<int64_t>& shape) {
+    CHECK(op_type_ == kConstantLike || op_type_ == kConstantFill) << "Invalid attribute `shape' for " << OpTypeToString(op_type_);
+    shape_ = shape;
+    was_shape_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_size(int64_t size) {
+    CHECK(op_type_ == kLRN || op_type_ == kChainerPadBatchSize || op_type_ == kChainerLRNGrad) << "Invalid attribute `size' for " << OpTypeToString(op_type_);
+    size_ = size;
+    was_size_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_slice_specs(const std::vector<int64_t>& slice_specs) {
+    CHECK(op_type_ == kChainerGetItem || op_type_ == kChainerGetItemGrad) << "Invalid attribute `slice_specs' for " << OpTypeToString(op_type_);
+    slice_specs_ = slice_specs;
+    was_slice_specs_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_spatial(int64_t spatial) {
+    CHECK(op_type_ == kBatchNormalization) << "Invalid attribute `spatial' for " << OpTypeToString(op_type_);
+    spatial_ = spatial;
+    was_spatial_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_spatial_scale(float spatial_scale) {
+    CHECK(op_type_ == kMaxRoiPool || op_type_ == kRoiAlign || op_type_ == kChainerROIMaxPool2D || op_type_ == kChainerROIAveragePool2D || op_type_ == kChainerROIMaxAlign2D || op_type_ == kChainerROIAverageAlign2D || op_type_ == kChainerROIMaxPool2DGrad || op_type_ == kChainerROIAveragePool2DGrad || op_type_ == kChainerROIMaxAlign2DGrad || op_type_ == kChainerROIAverageAlign2DGrad) << "Invalid attribute `spatial_scale' for " << OpTypeToString(op_type_);
+    spatial_scale_ = spatial_scale;
+    was_spatial_scale_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_split(const std::vector<int64_t>& split) {
+    CHECK(op_type_ == kSplit) << "Invalid attribute `split' for " << OpTypeToString(op_type_);
+    split_ = split;
+    was_split_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_starts(const std::vector<int64_t>& starts) {
+    CHECK(op_type_ == kSlice) << "Invalid attribute `starts' for " << OpTypeToString(op_type_);
+    starts_ = starts;
+    was_starts_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_storage_order(int64_t storage_order) {
+    CHECK(op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad) << "Invalid attribute `storage_order' for " << OpTypeToString(op_type_);
+    storage_order_ = storage_order;
+    was_storage_order_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_strides(const std::vector<int64_t>& strides) {
+    CHECK(op_type_ == kConv || op_type_ == kConvTranspose || op_type_ == kMaxPool || op_type_ == kAveragePool || op_type_ == kQLinearConv || op_type_ == kConvInteger || op_type_ == kChainerMaxPoolGrad || op_type_ == kChainerAveragePoolGrad || op_type_ == kChainerConvTransposeWithDynamicOutputShape || op_type_ == kChainerConvGradWeight) << "Invalid attribute `strides' for " << OpTypeToString(op_type_);
+    strides_ = strides;
+    was_strides_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_subgraph(Graph* subgraph) {
+    CHECK(op_type_ == kChainerFusionGroup) << "Invalid attribute `subgraph' for " << OpTypeToString(op_type_);
+    subgraph_.reset(subgraph);
+    was_subgraph_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_tensor_value(Tensor* tensor_value) {
+    CHECK(op_type_ == kConstant || op_type_ == kConstantOfShape) << "Invalid attribute `tensor_value' for " << OpTypeToString(op_type_);
+    tensor_value_.reset(tensor_value);
+    was_tensor_value_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_tensor_values(std::vector<std::unique_ptr<Tensor>>&& tensor_values) {
+    CHECK(op_type_ == kChainerSequenceConstants) << "Invalid attribute `tensor_values' for " << OpTypeToString(op_type_);
+    tensor_values_ = std::move(tensor_values);
+    was_tensor_values_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_then_branch(Graph* then_branch) {
+    CHECK(op_type_ == kIf) << "Invalid attribute `then_branch' for " << OpTypeToString(op_type_);
+    then_branch_.reset(then_branch);
+    was_then_branch_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_to(Dtype to) {
+    CHECK(op_type_ == kCast) << "Invalid attribute `to' for " << OpTypeToString(op_type_);
+    to_ = to;
+    was_to_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_trans_a(bool trans_a) {
+    CHECK(op_type_ == kGemm) << "Invalid attribute `trans_a' for " << OpTypeToString(op_type_);
+    trans_a_ = trans_a;
+    was_trans_a_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_trans_b(bool trans_b) {
+    CHECK(op_type_ == kGemm) << "Invalid attribute `trans_b' for " << OpTypeToString(op_type_);
+    trans_b_ = trans_b;
+    was_trans_b_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_value(float value) {
+    CHECK(op_type_ == kConstantLike || op_type_ == kConstantFill || op_type_ == kPad || op_type_ == kChainerSequencePad) << "Invalid attribute `value' for " << OpTypeToString(op_type_);
+    value_ = value;
+    was_value_set_ = true;
+    return this;
+}
+
+NodeBase* NodeBase::set_width_scale(float width_scale) {
+    CHECK(op_type_ == kUpsample) << "Invalid attribute `width_scale' for " << OpTypeToString(op_type_);
+    width_scale_ = width_scale;
+    was_width_scale_set_ = true;
+    return this;
+}
+
+
+}  // namespace chainer_compiler
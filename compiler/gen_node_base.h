@@ -0,0 +1,791 @@
+// Auto-generated by gen_node.py
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <compiler/dtype.h>
+#include <compiler/onnx.h>
+
+namespace chainer_compiler {
+
+class Graph;
+class Tensor;
+class Value;
+
+class NodeBase {
+public:
+    void FillONNXAttributes(onnx::NodeProto* xnode) const;
+
+    void SetDefaultAttributeValues();
+
+    void ValidateNumInputsOutputs(const std::vector<Value*>& inputs, const std::vector<Value*>& outputs) const;
+    void ValidateAttributes() const;
+
+    enum OpType {
+        kIdentity,
+        kNeg,
+        kReciprocal,
+        kExp,
+        kLog,
+        kSqrt,
+        kIsNaN,
+        kIsInf,
+        kSign,
+        kSin,
+        kSinh,
+        kCos,
+        kCosh,
+        kTan,
+        kTanh,
+        kAsin,
+        kAsinh,
+        kAcos,
+        kAcosh,
+        kAtan,
+        kAtanh,
+        kErf,
+        kAbs,
+        kRelu,
+        kSelu,
+        kLeakyRelu,
+        kElu,
+        kSigmoid,
+        kNot,
+        kFloor,
+        kCeil,
+        kSoftplus,
+        kSoftsign,
+        kAdd,
+        kSub,
+        kMul,
+        kDiv,
+        kPow,
+        kEqual,
+        kGreater,
+        kLess,
+        kAnd,
+        kOr,
+        kXor,
+        kConstant,
+        kConstantOfShape,
+        kConstantLike,
+        kConstantFill,
+        kOneHot,
+        kCast,
+        kShape,
+        kSize,
+        kReshape,
+        kExpand,
+        kSqueeze,
+        kUnsqueeze,
+        kFlatten,
+        kSlice,
+        kDynamicSlice,
+        kGather,
+        kConcat,
+        kSplit,
+        kTranspose,
+        kEyeLike,
+        kDepthToSpace,
+        kSpaceToDepth,
+        kSum,
+        kMean,
+        kMax,
+        kMin,
+        kClip,
+        kReduceSum,
+        kReduceSumSquare,
+        kReduceMean,
+        kReduceMax,
+        kReduceMin,
+        kReduceL1,
+        kReduceL2,
+        kReduceLogSum,
+        kReduceLogSumExp,
+        kReduceProd,
+        kArgMax,
+        kArgMin,
+        kHardmax,
+        kDropout,
+        kMatMul,
+        kGemm,
+        kRNN,
+        kGRU,
+        kLSTM,
+        kConv,
+        kConvTranspose,
+        kBatchNormalization,
+        kLRN,
+        kLpNormalization,
+        kMaxPool,
+        kAveragePool,
+        kGlobalMaxPool,
+        kGlobalAveragePool,
+        kPad,
+        kUpsample,
+        kResize,
+        kSoftmax,
+        kLogSoftmax,
+        kIf,
+        kLoop,
+        kWhere,
+        kImageScaler,
+        kMaxRoiPool,
+        kNonMaxSuppression,
+        kRoiAlign,
+        kQuantizeLinear,
+        kDequantizeLinear,
+        kQLinearConv,
+        kQLinearMatMul,
+        kMatMulInteger,
+        kConvInteger,
+        kRound,
+        kBitShift,
+        kChainerLinear,
+        kChainerLinearGradWeight,
+        kChainerReluGrad,
+        kChainerReduceSumTo,
+        kChainerROIMaxPool2D,
+        kChainerROIAveragePool2D,
+        kChainerROIMaxAlign2D,
+        kChainerROIAverageAlign2D,
+        kChainerResizeImages,
+        kChainerPadBatchSize,
+        kChainerDoSomething,
+        kChainerMaxPoolGrad,
+        kChainerAveragePoolGrad,
+        kChainerResizeGrad,
+        kChainerROIMaxPool2DGrad,
+        kChainerROIAveragePool2DGrad,
+        kChainerROIMaxAlign2DGrad,
+        kChainerROIAverageAlign2DGrad,
+        kChainerBatchNormalizationGrad,
+        kChainerConvTransposeWithDynamicOutputShape,
+        kChainerSoftmaxCrossEntropy,
+        kChainerSelectItem,
+        kChainerSelectItemGrad,
+        kChainerLRNGrad,
+        kChainerLSTMGrad,
+        kChainerConvGradWeight,
+        kChainerGatherGrad,
+        kChainerConcatGrad,
+        kChainerDynamicSliceGrad,
+        kChainerFusionGroup,
+        kChainerGetItem,
+        kChainerGetItemGrad,
+        kChainerPrint,
+        kChainerNullConstant,
+        kChainerSequenceConstants,
+        kChainerSequenceCreate,
+        kChainerSequenceAppend,
+        kChainerSequenceExtend,
+        kChainerSequencePop,
+        kChainerSequenceLookup,
+        kChainerSequenceGetSlice,
+        kChainerSequenceStack,
+        kChainerSequenceConcat,
+        kChainerSequenceSplitAxis,
+        kChainerSequencePad,
+        kChainerSequenceSeparate,
+        kChainerSequenceUnpad,
+        kChainerSequenceSize,
+        kChainerSequenceLengths,
+        kChainerSequenceRange,
+        kChainerSequenceLookupGrad,
+        kChainerSequenceGetSliceGrad,
+        kChainerGenericLen,
+        kChainerGenericGetItem,
+        kChainerGenericGetSlice,
+        kChainerGenericAdd,
+        kChainerGenericIs,
+        kChainerGenericAccumulateGrad,
+    };
+
+    static OpType StringToOpType(const std::string& str);
+    static const char* OpTypeToString(OpType op_type);
+    OpType op_type() const {
+        return op_type_;
+    }
+
+    const std::vector<float>& activation_alpha() const {
+        return activation_alpha_;
+    }
+
+    NodeBase* set_activation_alpha(const std::vector<float>& activation_alpha);
+    const std::vector<float>& activation_beta() const {
+        return activation_beta_;
+    }
+
+    NodeBase* set_activation_beta(const std::vector<float>& activation_beta);
+    const std::vector<std::string>& activations() const {
+        return activations_;
+    }
+
+    NodeBase* set_activations(const std::vector<std::string>& activations);
+    float alpha() const {
+        return alpha_;
+    }
+
+    NodeBase* set_alpha(float alpha);
+    const std::string& auto_pad() const {
+        return auto_pad_;
+    }
+
+    NodeBase* set_auto_pad(const std::string& auto_pad);
+    const std::vector<int64_t>& axes() const {
+        return axes_;
+    }
+
+    NodeBase* set_axes(const std::vector<int64_t>& axes);
+    int64_t axis() const {
+        return axis_;
+    }
+
+    NodeBase* set_axis(int64_t axis);
+    float beta() const {
+        return beta_;
+    }
+
+    NodeBase* set_beta(float beta);
+    float bias() const {
+        return bias_;
+    }
+
+    NodeBase* set_bias(float bias);
+    const std::vector<float>& bias_list() const {
+        return bias_list_;
+    }
+
+    NodeBase* set_bias_list(const std::vector<float>& bias_list);
+    int64_t blocksize() const {
+        return blocksize_;
+    }
+
+    NodeBase* set_blocksize(int64_t blocksize);
+    const std::unique_ptr<Graph>& body() const {
+        return body_;
+    }
+
+    Graph* release_body() {
+        return body_.release();
+    }
+
+    NodeBase* set_body(Graph* body);
+    int64_t center_point_box() const {
+        return center_point_box_;
+    }
+
+    NodeBase* set_center_point_box(int64_t center_point_box);
+    bool chainer_cover_all() const {
+        return chainer_cover_all_;
+    }
+
+    NodeBase* set_chainer_cover_all(bool chainer_cover_all);
+    int64_t chainer_fusion_group() const {
+        return chainer_fusion_group_;
+    }
+
+    NodeBase* set_chainer_fusion_group(int64_t chainer_fusion_group);
+    bool chainer_host() const {
+        return chainer_host_;
+    }
+
+    NodeBase* set_chainer_host(bool chainer_host);
+    int64_t chainer_in_recomputing() const {
+        return chainer_in_recomputing_;
+    }
+
+    NodeBase* set_chainer_in_recomputing(int64_t chainer_in_recomputing);
+    bool chainer_is_onnx_semantics() const {
+        return chainer_is_onnx_semantics_;
+    }
+
+    NodeBase* set_chainer_is_onnx_semantics(bool chainer_is_onnx_semantics);
+    int64_t chainer_order() const {
+        return chainer_order_;
+    }
+
+    NodeBase* set_chainer_order(int64_t chainer_order);
+    int64_t chainer_stack_axis() const {
+        return chainer_stack_axis_;
+    }
+
+    NodeBase* set_chainer_stack_axis(int64_t chainer_stack_axis);
+    float clip() const {
+        return clip_;
+    }
+
+    NodeBase* set_clip(float clip);
+    bool count_include_pad() const {
+        return count_include_pad_;
+    }
+
+    NodeBase* set_count_include_pad(bool count_include_pad);
+    int64_t detect_negative() const {
+        return detect_negative_;
+    }
+
+    NodeBase* set_detect_negative(int64_t detect_negative);
+    int64_t detect_positive() const {
+        return detect_positive_;
+    }
+
+    NodeBase* set_detect_positive(int64_t detect_positive);
+    const std::vector<int64_t>& dilations() const {
+        return dilations_;
+    }
+
+    NodeBase* set_dilations(const std::vector<int64_t>& dilations);
+    const std::string& direction() const {
+        return direction_;
+    }
+
+    NodeBase* set_direction(const std::string& direction);
+    Dtype dtype() const {
+        return dtype_;
+    }
+
+    NodeBase* set_dtype(Dtype dtype);
+    const std::unique_ptr<Graph>& else_branch() const {
+        return else_branch_;
+    }
+
+    Graph* release_else_branch() {
+        return else_branch_.release();
+    }
+
+    NodeBase* set_else_branch(Graph* else_branch);
+    const std::vector<int64_t>& ends() const {
+        return ends_;
+    }
+
+    NodeBase* set_ends(const std::vector<int64_t>& ends);
+    float epsilon() const {
+        return epsilon_;
+    }
+
+    NodeBase* set_epsilon(float epsilon);
+    const std::vector<int64_t>& extra_shape() const {
+        return extra_shape_;
+    }
+
+    NodeBase* set_extra_shape(const std::vector<int64_t>& extra_shape);
+    const std::string& function_name() const {
+        return function_name_;
+    }
+
+    NodeBase* set_function_name(const std::string& function_name);
+    const std::string& fusion_type() const {
+        return fusion_type_;
+    }
+
+    NodeBase* set_fusion_type(const std::string& fusion_type);
+    float gamma() const {
+        return gamma_;
+    }
+
+    NodeBase* set_gamma(float gamma);
+    int64_t group() const {
+        return group_;
+    }
+
+    NodeBase* set_group(int64_t group);
+    float height_scale() const {
+        return height_scale_;
+    }
+
+    NodeBase* set_height_scale(float height_scale);
+    int64_t hidden_size() const {
+        return hidden_size_;
+    }
+
+    NodeBase* set_hidden_size(int64_t hidden_size);
+    int64_t input_as_shape() const {
+        return input_as_shape_;
+    }
+
+    NodeBase* set_input_as_shape(int64_t input_as_shape);
+    int64_t input_forget() const {
+        return input_forget_;
+    }
+
+    NodeBase* set_input_forget(int64_t input_forget);
+    int64_t k() const {
+        return k_;
+    }
+
+    NodeBase* set_k(int64_t k);
+    bool keepdims() const {
+        return keepdims_;
+    }
+
+    NodeBase* set_keepdims(bool keepdims);
+    const std::vector<int64_t>& kernel_shape() const {
+        return kernel_shape_;
+    }
+
+    NodeBase* set_kernel_shape(const std::vector<int64_t>& kernel_shape);
+    int64_t length() const {
+        return length_;
+    }
+
+    NodeBase* set_length(int64_t length);
+    int64_t linear_before_reset() const {
+        return linear_before_reset_;
+    }
+
+    NodeBase* set_linear_before_reset(int64_t linear_before_reset);
+    float max() const {
+        return max_;
+    }
+
+    NodeBase* set_max(float max);
+    float min() const {
+        return min_;
+    }
+
+    NodeBase* set_min(float min);
+    const std::string& mode() const {
+        return mode_;
+    }
+
+    NodeBase* set_mode(const std::string& mode);
+    float momentum() const {
+        return momentum_;
+    }
+
+    NodeBase* set_momentum(float momentum);
+    int64_t n_batch_axes() const {
+        return n_batch_axes_;
+    }
+
+    NodeBase* set_n_batch_axes(int64_t n_batch_axes);
+    int64_t output_height() const {
+        return output_height_;
+    }
+
+    NodeBase* set_output_height(int64_t output_height);
+    const std::vector<int64_t>& output_padding() const {
+        return output_padding_;
+    }
+
+    NodeBase* set_output_padding(const std::vector<int64_t>& output_padding);
+    const std::vector<int64_t>& output_shape() const {
+        return output_shape_;
+    }
+
+    NodeBase* set_output_shape(const std::vector<int64_t>& output_shape);
+    int64_t output_width() const {
+        return output_width_;
+    }
+
+    NodeBase* set_output_width(int64_t output_width);
+    int64_t p() const {
+        return p_;
+    }
+
+    NodeBase* set_p(int64_t p);
+    const std::vector<int64_t>& pads() const {
+        return pads_;
+    }
+
+    NodeBase* set_pads(const std::vector<int64_t>& pads);
+    const std::vector<int64_t>& perm() const {
+        return perm_;
+    }
+
+    NodeBase* set_perm(const std::vector<int64_t>& perm);
+    const std::vector<int64_t>& pooled_shape() const {
+        return pooled_shape_;
+    }
+
+    NodeBase* set_pooled_shape(const std::vector<int64_t>& pooled_shape);
+    float ratio() const {
+        return ratio_;
+    }
+
+    NodeBase* set_ratio(float ratio);
+    int64_t sampling_ratio() const {
+        return sampling_ratio_;
+    }
+
+    NodeBase* set_sampling_ratio(int64_t sampling_ratio);
+    const std::vector<int64_t>& sampling_ratio_list() const {
+        return sampling_ratio_list_;
+    }
+
+    NodeBase* set_sampling_ratio_list(const std::vector<int64_t>& sampling_ratio_list);
+    float scale() const {
+        return scale_;
+    }
+
+    NodeBase* set_scale(float scale);
+    const std::vector<int64_t>& shape() const {
+        return shape_;
+    }
+
+    NodeBase* set_shape(const std::vector<int64_t>& shape);
+    int64_t size() const {
+        return size_;
+    }
+
+    NodeBase* set_size(int64_t size);
+    const std::vector<int64_t>& slice_specs() const {
+        return slice_specs_;
+    }
+
+    NodeBase* set_slice_specs(const std::vector<int64_t>& slice_specs);
+    int64_t spatial() const {
+        return spatial_;
+    }
+
+    NodeBase* set_spatial(int64_t spatial);
+    float spatial_scale() const {
+        return spatial_scale_;
+    }
+
+    NodeBase* set_spatial_scale(float spatial_scale);
+    const std::vector<int64_t>& split() const {
+        return split_;
+    }
+
+    NodeBase* set_split(const std::vector<int64_t>& split);
+    const std::vector<int64_t>& starts() const {
+        return starts_;
+    }
+
+    NodeBase* set_starts(const std::vector<int64_t>& starts);
+    int64_t storage_order() const {
+        return storage_order_;
+    }
+
+    NodeBase* set_storage_order(int64_t storage_order);
+    const std::vector<int64_t>& strides() const {
+        return strides_;
+    }
+
+    NodeBase* set_strides(const std::vector<int64_t>& strides);
+    const std::unique_ptr<Graph>& subgraph() const {
+        return subgraph_;
+    }
+
+    Graph* release_subgraph() {
+        return subgraph_.release();
+    }
+
+    NodeBase* set_subgraph(Graph* subgraph);
+    const std::unique_ptr<Tensor>& tensor_value() const {
+        return tensor_value_;
+    }
+
+    NodeBase* set_tensor_value(Tensor* tensor_value);
+    const std::vector<std::unique_ptr<Tensor>>& tensor_values() const {
+        return tensor_values_;
+    }
+
+    NodeBase* set_tensor_values(std::vector<std::unique_ptr<Tensor>>&& tensor_values);
+    const std::unique_ptr<Graph>& then_branch() const {
+        return then_branch_;
+    }
+
+    Graph* release_then_branch() {
+        return then_branch_.release();
+    }
+
+    NodeBase* set_then_branch(Graph* then_branch);
+    Dtype to() const {
+        return to_;
+    }
+
+    NodeBase* set_to(Dtype to);
+    bool trans_a() const {
+        return trans_a_;
+    }
+
+    NodeBase* set_trans_a(bool trans_a);
+    bool trans_b() const {
+        return trans_b_;
+    }
+
+    NodeBase* set_trans_b(bool trans_b);
+    float value() const {
+        return value_;
+    }
+
+    NodeBase* set_value(float value);
+    float width_scale() const {
+        return width_scale_;
+    }
+
+    NodeBase* set_width_scale(float width_scale);
+protected:
+    std::vector<float> activation_alpha_;
+    bool was_activation_alpha_set_ = false;
+    std::vector<float> activation_beta_;
+    bool was_activation_beta_set_ = false;
+    std::vector<std::string> activations_;
+    bool was_activations_set_ = false;
+    float alpha_;
+    bool was_alpha_set_ = false;
+    std::string auto_pad_;
+    bool was_auto_pad_set_ = false;
+    std::vector<int64_t> axes_;
+    bool was_axes_set_ = false;
+    int64_t axis_;
+    bool was_axis_set_ = false;
+    float beta_;
+    bool was_beta_set_ = false;
+    float bias_;
+    bool was_bias_set_ = false;
+    std::vector<float> bias_list_;
+    bool was_bias_list_set_ = false;
+    int64_t blocksize_;
+    bool was_blocksize_set_ = false;
+    std::unique_ptr<Graph> body_;
+    bool was_body_set_ = false;
+    int64_t center_point_box_;
+    bool was_center_point_box_set_ = false;
+    bool chainer_cover_all_;
+    bool was_chainer_cover_all_set_ = false;
+    int64_t chainer_fusion_group_;
+    bool was_chainer_fusion_group_set_ = false;
+    bool chainer_host_;
+    bool was_chainer_host_set_ = false;
+    int64_t chainer_in_recomputing_;
+    bool was_chainer_in_recomputing_set_ = false;
+    bool chainer_is_onnx_semantics_;
+    bool was_chainer_is_onnx_semantics_set_ = false;
+    int64_t chainer_order_;
+    bool was_chainer_order_set_ = false;
+    int64_t chainer_stack_axis_;
+    bool was_chainer_stack_axis_set_ = false;
+    float clip_;
+    bool was_clip_set_ = false;
+    bool count_include_pad_;
+    bool was_count_include_pad_set_ = false;
+    int64_t detect_negative_;
+    bool was_detect_negative_set_ = false;
+    int64_t detect_positive_;
+    bool was_detect_positive_set_ = false;
+    std::vector<int64_t> dilations_;
+    bool was_dilations_set_ = false;
+    std::string direction_;
+    bool was_direction_set_ = false;
+    Dtype dtype_;
+    bool was_dtype_set_ = false;
+    std::unique_ptr<Graph> else_branch_;
+    bool was_else_branch_set_ = false;
+    std::vector<int64_t> ends_;
+    bool was_ends_set_ = false;
+    float epsilon_;
+    bool was_epsilon_set_ = false;
+    std::vector<int64_t> extra_shape_;
+    bool was_extra_shape_set_ = false;
+    std::string function_name_;
+    bool was_function_name_set_ = false;
+    std::string fusion_type_;
+    bool was_fusion_type_set_ = false;
+    float gamma_;
+    bool was_gamma_set_ = false;
+    int64_t group_;
+    bool was_group_set_ = false;
+    float height_scale_;
+    bool was_height_scale_set_ = false;
+    int64_t hidden_size_;
+    bool was_hidden_size_set_ = false;
+    int64_t input_as_shape_;
+    bool was_input_as_shape_set_ = false;
+    int64_t input_forget_;
+    bool was_input_forget_set_ = false;
+    int64_t k_;
+    bool was_k_set_ = false;
+    bool keepdims_;
+    bool was_keepdims_set_ = false;
+    std::vector<int64_t> kernel_shape_;
+    bool was_kernel_shape_set_ = false;
+    int64_t length_;
+    bool was_length_set_ = false;
+    int64_t linear_before_reset_;
+    bool was_linear_before_reset_set_ = false;
+    float max_;
+    bool was_max_set_ = false;
+    float min_;
+    bool was_min_set_ = false;
+    std::string mode_;
+    bool was_mode_set_ = false;
+    float momentum_;
+    bool was_momentum_set_ = false;
+    int64_t n_batch_axes_;
+    bool was_n_batch_axes_set_ = false;
+    int64_t output_height_;
+    bool was_output_height_set_ = false;
+    std::vector<int64_t> output_padding_;
+    bool was_output_padding_set_ = false;
+    std::vector<int64_t> output_shape_;
+    bool was_output_shape_set_ = false;
+    int64_t output_width_;
+    bool was_output_width_set_ = false;
+    int64_t p_;
+    bool was_p_set_ = false;
+    std::vector<int64_t> pads_;
+    bool was_pads_set_ = false;
+    std::vector<int64_t> perm_;
+    bool was_perm_set_ = false;
+    std::vector<int64_t> pooled_shape_;
+    bool was_pooled_shape_set_ = false;
+    float ratio_;
+    bool was_ratio_set_ = false;
+    int64_t sampling_ratio_;
+    bool was_sampling_ratio_set_ = false;
+    std::vector<int64_t> sampling_ratio_list_;
+    bool was_sampling_ratio_list_set_ = false;
+    float scale_;
+    bool was_scale_set_ = false;
+    std::vector<int64_t> shape_;
+    bool was_shape_set_ = false;
+    int64_t size_;
+    bool was_size_set_ = false;
+    std::vector<int64_t> slice_specs_;
+    bool was_slice_specs_set_ = false;
+    int64_t spatial_;
+    bool was_spatial_set_ = false;
+    float spatial_scale_;
+    bool was_spatial_scale_set_ = false;
+    std::vector<int64_t> split_;
+    bool was_split_set_ = false;
+    std::vector<int64_t> starts_;
+    bool was_starts_set_ = false;
+    int64_t storage_order_;
+    bool was_storage_order_set_ = false;
+    std::vector<int64_t> strides_;
+    bool was_strides_set_ = false;
+    std::unique_ptr<Graph> subgraph_;
+    bool was_subgraph_set_ = false;
+    std::unique_ptr<Tensor> tensor_value_;
+    bool was_tensor_value_set_ = false;
+    std::vector<std::unique_ptr<Tensor>> tensor_values_;
+    bool was_tensor_values_set_ = false;
+    std::unique_ptr<Graph> then_branch_;
+    bool was_then_branch_set_ = false;
+    Dtype to_;
+    bool was_to_set_ = false;
+    bool trans_a_;
+    bool was_trans_a_set_ = false;
+    bool trans_b_;
+    bool was_trans_b_set_ = false;
+    float value_;
+    bool was_value_set_ = false;
+    float width_scale_;
+    bool was_width_scale_set_ = false;
+
+    OpType op_type_;
+    std::vector<onnx::AttributeProto> unknown_attributes_;
+
+    explicit NodeBase(OpType op_type);
+    NodeBase(const onnx::NodeProto& xnode, const std::vector<Value*>& inputs, const std::vector<Value*>& outputs);
+};
+
+}  // namespace chainer_compiler
@@ -22,11 +22,11 @@ namespace chainer_compiler {
 
 namespace {
 
-void SetInitialGradients(Graph* graph) {
+void SetInitialGradients(Graph* graph, Value* loss_scale) {
     CHECK_EQ(1UL, graph->output_values().size());
     for (Value* value : graph->output_values()) {
         GraphBuilder gb(graph, "GradIn", value);
-        Value* one = gb.Const(Type(value->type().dtype(), {}), {1.0});
+        Value* one = loss_scale ? loss_scale : gb.Const(Type(value->type().dtype(), {}), {1.0});
         Value* shape = gb.Op(Node::kShape, {value});
         Value* grad = gb.Op(Node::kExpand, {one, shape});
         CHECK(value->grad() == nullptr);
@@ -118,8 +118,8 @@ void GenerateGradientNodesImpl(Graph* graph, Graph* dest_graph, const std::set<V
 
 }  // namespace
 
-void AddGradientNodesForTraining(Graph* graph) {
-    SetInitialGradients(graph);
+void AddGradientNodesForTraining(Graph* graph, Value* loss_scale) {
+    SetInitialGradients(graph, loss_scale);
 
     std::set<Value*> xs = GetParamValues(graph);
     GenerateGradientNodes(graph, graph, std::vector<Value*>(xs.begin(), xs.end()), graph->output_values(), nullptr);
@@ -9,7 +9,9 @@ namespace chainer_compiler {
 class Graph;
 class Value;
 
-void AddGradientNodesForTraining(Graph* graph);
+// Adds gradient nodes for all parameters of `graph`. The gradient of
+// the loss is initialized by `loss_scale` instead of one if specified.
+void AddGradientNodesForTraining(Graph* graph, Value* loss_scale = nullptr);
 
 void GenerateGradientNodes(Graph* graph, Graph* dest_graph);
 
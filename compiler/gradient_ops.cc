@@ -262,6 +262,12 @@ void IdentityGradFn(GradientOpContext* gc) {
     gc->GradOp(Node::kIdentity, 0, {gc->gy(0)});
 }
 
+void CastGradFn(GradientOpContext* gc) {
+    const Dtype dtype = gc->NoRetainX(0)->type().dtype();
+    if (!dtype.IsFloat()) return;
+    gc->GradOp(Node::kCast, 0, {gc->gy(0)})->producer()->set_to(dtype);
+}
+
 void ReshapeGradFn(GradientOpContext* gc) {
     GraphBuilder gb{gc->builder(0)};
     Value* t0 = gb.Op(Node::kShape, {gc->x(0)});
@@ -530,7 +536,30 @@ void ResizeGradFn(GradientOpContext* gc) {
     GraphBuilder gb{gc->builder(0)};
     Node* node = gc->node();
     CHECK_EQ(2, node->inputs().size());
-    gc->GradOp(Node::kChainerResizeGrad, 0, {gc->gy(0), gc->x(1)});
+    CHECK_EQ("nearest", node->mode()) << "Only nearest resize is differentiable";
+    Value* x_shape = gb.Op(Node::kShape, {gc->x(0)});
+    gc->GradOp(Node::kChainerResizeGrad, 0, {gc->gy(0), gc->x(1), x_shape});
+}
+
+void ROIPool2DGradFn(GradientOpContext* gc) {
+    const Node* node = gc->node();
+    const Node::OpType grad_op =
+            node->op_type() == Node::kChainerROIMaxPool2D ? Node::kChainerROIMaxPool2DGrad : Node::kChainerROIAveragePool2DGrad;
+    gc->GradOp(grad_op, 0, {gc->gy(0), gc->x(0), gc->x(1), gc->x(2)})
+            ->producer()
+            ->set_output_shape(node->output_shape())
+            ->set_spatial_scale(node->spatial_scale());
+}
+
+void ROIAlign2DGradFn(GradientOpContext* gc) {
+    const Node* node = gc->node();
+    const Node::OpType grad_op =
+            node->op_type() == Node::kChainerROIMaxAlign2D ? Node::kChainerROIMaxAlign2DGrad : Node::kChainerROIAverageAlign2DGrad;
+    gc->GradOp(grad_op, 0, {gc->gy(0), gc->x(0), gc->x(1), gc->x(2)})
+            ->producer()
+            ->set_output_shape(node->output_shape())
+            ->set_spatial_scale(node->spatial_scale())
+            ->set_sampling_ratio_list(node->sampling_ratio_list());
 }
 
 void LogSoftmaxGradFn(GradientOpContext* gc) {
@@ -624,10 +653,17 @@ void LSTMGradFn(GradientOpContext* gc) {
     Node* node = gc->node();
     // TODO(hamaji): Currently, gradient of LSTM is only for ONNX
     // generated by CH2O.
-    CHECK_EQ(5UL, node->inputs().size()) << "Not implemented yet";
+    const bool has_peepholes = node->inputs().size() == 8 && !node->input(7)->IsNull();
+    if (has_peepholes) {
+        CHECK(node->input(5)->IsNull() && node->input(6)->IsNull()) << "Not implemented yet";
+    } else {
+        CHECK_EQ(5UL, node->inputs().size()) << "Not implemented yet";
+    }
     CHECK_EQ(3UL, node->outputs().size()) << "Not implemented yet";
     Value* context = gc->AddOutput(Type(Type::Kind::kOpaque));
-    gc->GradMOp(Node::kChainerLSTMGrad, {0, 1, 2, 3}, {gc->gy(0), context});
+    std::vector<int> xis = {0, 1, 2, 3};
+    if (has_peepholes) xis.push_back(7);
+    gc->GradMOp(Node::kChainerLSTMGrad, xis, {gc->gy(0), context});
 }
 
 void DoNothingGradFn(GradientOpContext*) {
@@ -1064,6 +1100,7 @@ bool AddGradientForNode(Graph* graph, Graph* dest_graph, Node* node, std::map<Va
         register_grad_fn(Node::kTanh, &TanhGradFn);
 
         register_grad_fn(Node::kIdentity, &IdentityGradFn);
+        register_grad_fn(Node::kCast, &CastGradFn);
         register_grad_fn(Node::kReshape, &ReshapeGradFn);
         register_grad_fn(Node::kSqueeze, &ReshapeGradFn);
         register_grad_fn(Node::kUnsqueeze, &ReshapeGradFn);
@@ -1084,6 +1121,10 @@ bool AddGradientForNode(Graph* graph, Graph* dest_graph, Node* node, std::map<Va
         register_grad_fn(Node::kAveragePool, &AveragePoolGradFn);
         register_grad_fn(Node::kUpsample, &ResizeGradFn);
         register_grad_fn(Node::kResize, &ResizeGradFn);
+        register_grad_fn(Node::kChainerROIMaxPool2D, &ROIPool2DGradFn);
+        register_grad_fn(Node::kChainerROIAveragePool2D, &ROIPool2DGradFn);
+        register_grad_fn(Node::kChainerROIMaxAlign2D, &ROIAlign2DGradFn);
+        register_grad_fn(Node::kChainerROIAverageAlign2D, &ROIAlign2DGradFn);
         register_grad_fn(Node::kLogSoftmax, &LogSoftmaxGradFn);
         register_grad_fn(Node::kSoftmax, &SoftmaxGradFn);
 
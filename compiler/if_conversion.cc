@@ -0,0 +1,169 @@
+#include "compiler/if_conversion.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <common/log.h>
+#include <common/strutil.h>
+#include <compiler/dtype.h>
+#include <compiler/flops.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/speculation.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+// Sequences may be modified in-place so their ops are not speculated.
+bool HasOnlyTensorOutputs(const Node& node) {
+    for (const Value* output : node.outputs()) {
+        if (!output->IsNull() && output->type().kind() != Type::Kind::kTensor) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the FLOPs of `branch` or -1 if it cannot be evaluated
+// unconditionally.
+int64_t GetBranchFlops(const Graph& branch) {
+    int64_t total_flops = 0;
+    for (const Node* node : branch.GetLiveNodes()) {
+        if (!CanBeSpeculated(*node) || !HasOnlyTensorOutputs(*node)) {
+            return -1;
+        }
+        const int64_t flops = CalculateFlops(*node);
+        if (flops < 0) {
+            return -1;
+        }
+        total_flops += flops;
+    }
+    return total_flops;
+}
+
+bool HasSameKnownType(const Value& then_value, const Value& else_value) {
+    const Type& then_type = then_value.type();
+    const Type& else_type = else_value.type();
+    return then_type.kind() == Type::Kind::kTensor && else_type.kind() == Type::Kind::kTensor && then_type.HasKnownShape() &&
+           else_type.HasKnownShape() && then_type.dtype() == else_type.dtype() && then_type.dims() == else_type.dims();
+}
+
+bool CanBeConverted(const Node& cond, int64_t max_flops) {
+    const Type& cond_type = cond.input(0)->type();
+    if (cond_type.kind() != Type::Kind::kTensor || !cond_type.HasKnownShape() || cond_type.NumElements() != 1) {
+        return false;
+    }
+
+    const std::vector<Value*>& then_outputs = cond.then_branch()->output_values();
+    const std::vector<Value*>& else_outputs = cond.else_branch()->output_values();
+    CHECK_EQ(cond.outputs().size(), then_outputs.size());
+    CHECK_EQ(cond.outputs().size(), else_outputs.size());
+    for (size_t i = 0; i < cond.outputs().size(); ++i) {
+        if (cond.output(i)->IsNull()) {
+            continue;
+        }
+        if (!HasSameKnownType(*then_outputs[i], *else_outputs[i])) {
+            return false;
+        }
+        // Where must not broadcast the outputs by the condition.
+        if (cond_type.ndim() > then_outputs[i]->type().ndim()) {
+            return false;
+        }
+    }
+
+    const int64_t then_flops = GetBranchFlops(*cond.then_branch());
+    const int64_t else_flops = GetBranchFlops(*cond.else_branch());
+    return then_flops >= 0 && else_flops >= 0 && then_flops + else_flops <= max_flops;
+}
+
+// Copies the nodes in `branch` to `graph` and returns the copies of
+// the outputs of `branch`.
+std::vector<Value*> CopyBranch(Graph* graph, const Node& cond, const Graph& branch, const std::string& suffix, GraphBuilder* gb) {
+    const std::vector<Value*>& branch_inputs = branch.input_values();
+    CHECK_EQ(cond.inputs().size(), branch_inputs.size() + 1);
+
+    // Branch values to their copies in `graph`.
+    std::map<Value*, Value*> copies;
+    for (size_t i = 0; i < branch_inputs.size(); ++i) {
+        copies[branch_inputs[i]] = cond.input(i + 1);
+    }
+
+    for (Node* node : branch.GetTopologicallySortedNodes()) {
+        std::vector<Value*> inputs;
+        for (Value* input : node->inputs()) {
+            if (input->IsNull()) {
+                inputs.push_back(gb->Null());
+                continue;
+            }
+            auto found = copies.find(input);
+            CHECK(found != copies.end()) << "Unknown input in If branch: " << input->DebugString();
+            inputs.push_back(found->second);
+        }
+        std::vector<Value*> outputs;
+        for (Value* output : node->outputs()) {
+            if (output->IsNull()) {
+                outputs.push_back(gb->Null());
+                continue;
+            }
+            Value* copy = graph->AddValue(StrCat(output->name(), suffix), output->type());
+            copies.emplace(output, copy);
+            outputs.push_back(copy);
+        }
+        onnx::NodeProto xnode;
+        node->ToONNX(&xnode);
+        xnode.set_name(StrCat(node->name(), suffix));
+        graph->AddNodeImpl(std::unique_ptr<Node>(new Node(xnode, inputs, outputs)), inputs, outputs);
+    }
+
+    std::vector<Value*> results;
+    for (Value* output : branch.output_values()) {
+        auto found = copies.find(output);
+        CHECK(found != copies.end()) << "If branch output is not computed: " << output->DebugString();
+        results.push_back(found->second);
+    }
+    return results;
+}
+
+void ConvertIf(Graph* graph, Node* cond) {
+    GraphBuilder gb(graph, "IfToWhere", cond->output(0));
+    const std::vector<Value*> then_outputs = CopyBranch(graph, *cond, *cond->then_branch(), "@then", &gb);
+    const std::vector<Value*> else_outputs = CopyBranch(graph, *cond, *cond->else_branch(), "@else", &gb);
+    for (size_t i = 0; i < cond->outputs().size(); ++i) {
+        Value* output = cond->output(i);
+        if (!output->IsNull()) {
+            gb.Op(Node::kWhere, {cond->input(0), then_outputs[i], else_outputs[i]}, output);
+        }
+    }
+    graph->DetachNode(cond);
+}
+
+int ConvertIfToWhereImpl(Graph* graph, int64_t max_flops) {
+    int num_converted = 0;
+    for (Node* node : graph->GetLiveNodes()) {
+        for (Graph* subgraph : node->GetSubGraphs()) {
+            num_converted += ConvertIfToWhereImpl(subgraph, max_flops);
+        }
+        if (node->op_type() == Node::kIf && CanBeConverted(*node, max_flops)) {
+            ConvertIf(graph, node);
+            ++num_converted;
+        }
+    }
+    return num_converted;
+}
+
+}  // namespace
+
+int ConvertIfToWhere(Graph* graph, int64_t max_flops) {
+    int num_converted = ConvertIfToWhereImpl(graph, max_flops);
+    CLOG() << "If conversion: " << num_converted << " Ifs were converted to Where" << std::endl;
+    return num_converted;
+}
+
+}  // namespace chainer_compiler
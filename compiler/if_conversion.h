@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace chainer_compiler {
+
+class Graph;
+
+// Replaces If nodes whose branches are small and free of side effects
+// with copies of both branches followed by Where, so the condition no
+// longer needs to be transferred to the host and the branches can be
+// fused with surrounding nodes. An If is converted only if the total
+// FLOPs of both branches are known and at most `max_flops`, and the
+// outputs of the branches have the same known type. Must be run after
+// `CanonicalizeSubGraphs`. Returns the number of converted Ifs.
+int ConvertIfToWhere(Graph* graph, int64_t max_flops);
+
+}  // namespace chainer_compiler
@@ -0,0 +1,110 @@
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/if_conversion.h>
+#include <compiler/node.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+Graph* MakeBranch(const std::string& name, const Type& type, Node::OpType op_type) {
+    Graph* branch = new Graph(name);
+    Value* x = branch->AddInputValue("x_" + name, type);
+    Value* y = branch->AddOutputValue("y_" + name, type);
+    GraphBuilder gb(branch, name, y);
+    gb.Op(op_type, {x}, y);
+    return branch;
+}
+
+std::map<Node::OpType, int> CountOps(const Graph& graph) {
+    std::map<Node::OpType, int> counts;
+    for (const Node* node : graph.GetTopologicallySortedNodes()) {
+        ++counts[node->op_type()];
+    }
+    return counts;
+}
+
+TEST(IfConversionTest, Basic) {
+    const Type type(Dtype::kFloat32, {2});
+    Graph graph("test");
+    Value* cond = graph.AddInputValue("cond", Type(Dtype::kBool, {}));
+    Value* x = graph.AddInputValue("x", type);
+    Value* y = graph.AddOutputValue("y", type);
+
+    {
+        GraphBuilder gb(&graph, "test", y);
+        Node* node = gb.MOp(Node::kIf, {cond, x}, {y});
+        node->set_then_branch(MakeBranch("then", type, Node::kRelu));
+        node->set_else_branch(MakeBranch("else", type, Node::kNeg));
+    }
+
+    // Too many FLOPs.
+    EXPECT_EQ(0, ConvertIfToWhere(&graph, 3));
+    EXPECT_EQ(1, ConvertIfToWhere(&graph, 4));
+    graph.DeleteDetached();
+    graph.CheckSanity("converted");
+
+    std::map<Node::OpType, int> counts = CountOps(graph);
+    EXPECT_EQ(0, counts[Node::kIf]);
+    EXPECT_EQ(1, counts[Node::kRelu]);
+    EXPECT_EQ(1, counts[Node::kNeg]);
+    EXPECT_EQ(1, counts[Node::kWhere]);
+    EXPECT_EQ(Node::kWhere, y->producer()->op_type());
+    EXPECT_EQ(cond, y->producer()->input(0));
+}
+
+TEST(IfConversionTest, SideEffect) {
+    const Type type(Dtype::kFloat32, {2});
+    Graph graph("test");
+    Value* cond = graph.AddInputValue("cond", Type(Dtype::kBool, {}));
+    Value* x = graph.AddInputValue("x", type);
+    Value* y = graph.AddOutputValue("y", type);
+
+    {
+        GraphBuilder gb(&graph, "test", y);
+        Node* node = gb.MOp(Node::kIf, {cond, x}, {y});
+        node->set_then_branch(MakeBranch("then", type, Node::kRelu));
+        node->set_else_branch(MakeBranch("else", type, Node::kDropout));
+    }
+
+    EXPECT_EQ(0, ConvertIfToWhere(&graph, 100));
+    EXPECT_EQ(1, CountOps(graph)[Node::kIf]);
+}
+
+TEST(IfConversionTest, MayFail) {
+    for (Dtype dtype : {Dtype::kInt64, Dtype::kFloat32}) {
+        const Type type(dtype, {2});
+        Graph graph("test");
+        Value* cond = graph.AddInputValue("cond", Type(Dtype::kBool, {}));
+        Value* x = graph.AddInputValue("x", type);
+        Value* y = graph.AddOutputValue("y", type);
+
+        Graph* then_branch = new Graph("then");
+        {
+            Value* then_x = then_branch->AddInputValue("x_then", type);
+            Value* then_y = then_branch->AddOutputValue("y_then", type);
+            GraphBuilder gb(then_branch, "then", then_y);
+            gb.Op(Node::kDiv, {then_x, then_x}, then_y);
+        }
+
+        {
+            GraphBuilder gb(&graph, "test", y);
+            Node* node = gb.MOp(Node::kIf, {cond, x}, {y});
+            node->set_then_branch(then_branch);
+            node->set_else_branch(MakeBranch("else", type, Node::kNeg));
+        }
+
+        // Integer division by zero in the untaken branch must not
+        // happen.
+        const int expected = dtype == Dtype::kFloat32 ? 1 : 0;
+        EXPECT_EQ(expected, ConvertIfToWhere(&graph, 100)) << dtype;
+    }
+}
+
+}  // namespace
+}  // namespace chainer_compiler
@@ -0,0 +1,239 @@
+#include "compiler/layout.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/manipulation.h>
+
+#include <common/log.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+const std::vector<int64_t> kToChannelsLast = {0, 2, 3, 1};
+const std::vector<int64_t> kToChannelsFirst = {0, 3, 1, 2};
+
+std::vector<int64_t> Permute(const std::vector<int64_t>& dims, const std::vector<int64_t>& perm) {
+    std::vector<int64_t> permuted;
+    for (int64_t axis : perm) {
+        permuted.push_back(dims[axis]);
+    }
+    return permuted;
+}
+
+Type* PermuteType(const Type& type, const std::vector<int64_t>& perm) {
+    if (!type.HasKnownShape() || type.ndim() != perm.size()) {
+        return new Type(type.dtype());
+    }
+    return new Type(type.dtype(), Permute(type.dims(), perm));
+}
+
+bool IsFloat4D(const Value* value) {
+    const Type& type = value->type();
+    return type.dtype() == Dtype::kFloat32 && type.HasKnownShape() && type.ndim() == 4;
+}
+
+bool HasSingleOutput(const Node& node) {
+    for (size_t i = 1; i < node.outputs().size(); ++i) {
+        if (!node.output(i)->IsNull()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns true if `node` has a channels last implementation.
+bool CanBeChannelsLast(const Node& node) {
+    if (node.inputs().empty() || !IsFloat4D(node.input(0)) || !HasSingleOutput(node)) {
+        return false;
+    }
+
+    switch (node.op_type()) {
+        case Node::kConv:
+            for (int64_t d : node.dilations()) {
+                if (d != 1) return false;
+            }
+            return node.group() == 1 && node.auto_pad() == "NOTSET" && node.input(1)->type().ndim() == 4;
+
+        case Node::kMaxPool:
+        case Node::kAveragePool:
+            return node.auto_pad() == "NOTSET" && node.kernel_shape().size() == 2;
+
+        case Node::kBatchNormalization:
+            return node.outputs().size() == 1 && !node.chainer_in_recomputing();
+
+        default:
+            return false;
+    }
+}
+
+// Returns true if `node` computes the same regardless of the layout
+// when all its inputs have the same layout and shape.
+bool IsLayoutAgnostic(const Node& node) {
+    switch (node.op_type()) {
+        case Node::kIdentity:
+        case Node::kRelu:
+        case Node::kLeakyRelu:
+        case Node::kElu:
+        case Node::kSelu:
+        case Node::kSigmoid:
+        case Node::kTanh:
+        case Node::kClip:
+        case Node::kAdd:
+        case Node::kSub:
+        case Node::kMul:
+        case Node::kDiv:
+        case Node::kSum:
+        case Node::kMax:
+        case Node::kMin:
+            return node.outputs().size() == 1;
+
+        default:
+            return false;
+    }
+}
+
+class ChannelsLastConverter {
+public:
+    explicit ChannelsLastConverter(Graph* graph) : graph_(graph) {
+    }
+
+    void Run() {
+        for (Node* node : graph_->GetTopologicallySortedNodes()) {
+            Convert(node);
+        }
+        CLOG() << "Channels last: " << num_converted_ << " nodes are NHWC with " << num_transposes_ << " transposes" << std::endl;
+    }
+
+private:
+    void Convert(Node* node) {
+        if (CanBeChannelsLast(*node)) {
+            Value* x = node->input(0);
+            if (!channels_last_.count(x)) {
+                node->ReplaceInput(x, ToChannelsLast(x));
+            }
+            if (node->op_type() == Node::kConv) {
+                Value* w = node->input(1);
+                node->ReplaceInput(w, ToOHWI(w));
+            }
+            node->set_chainer_channels_last(true);
+            SetChannelsLastOutput(node);
+            ++num_converted_;
+            return;
+        }
+
+        if (IsLayoutAgnostic(*node) && AreAllInputsChannelsLast(*node)) {
+            SetChannelsLastOutput(node);
+            return;
+        }
+
+        for (Value* input : node->inputs()) {
+            if (channels_last_.count(input)) {
+                node->ReplaceInput(input, ToChannelsFirst(input));
+            }
+        }
+    }
+
+    bool AreAllInputsChannelsLast(const Node& node) const {
+        const Value* first = node.input(0);
+        for (const Value* input : node.inputs()) {
+            if (!channels_last_.count(input) || input->type().dims() != first->type().dims()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SetChannelsLastOutput(Node* node) {
+        Value* output = node->output(0);
+        if (output->IsOutput()) {
+            // Graph outputs are kept in NCHW.
+            GraphBuilder gb(graph_, "ChannelsLast", output);
+            std::unique_ptr<Type> type(PermuteType(output->type(), kToChannelsLast));
+            Value* nhwc = gb.Temp(*type);
+            node->ReplaceOutput(output, nhwc);
+            gb.Op(Node::kTranspose, {nhwc}, output)->producer()->set_perm(kToChannelsFirst);
+            channels_last_.emplace(nhwc);
+            channels_first_of_.emplace(nhwc, output);
+            ++num_transposes_;
+        } else {
+            output->set_type(PermuteType(output->type(), kToChannelsLast));
+            channels_last_.emplace(output);
+        }
+    }
+
+    Value* ToChannelsLast(Value* value) {
+        return Transpose(value, kToChannelsLast, &channels_last_of_);
+    }
+
+    Value* ToChannelsFirst(Value* value) {
+        return Transpose(value, kToChannelsFirst, &channels_first_of_);
+    }
+
+    // OIHW => OHWI. Constant weights (e.g., initializers) are not
+    // folded by PropagateConstants, so new ones are created in OHWI.
+    Value* ToOHWI(Value* value) {
+        const Tensor* tensor = value->GetConstTensor();
+        if (!tensor) {
+            return Transpose(value, kToChannelsLast, &ohwi_of_);
+        }
+        auto found = ohwi_of_.find(value);
+        if (found != ohwi_of_.end()) {
+            return found->second;
+        }
+        GraphBuilder gb(graph_, "ChannelsLast", value);
+        chainerx::Array ohwi = chainerx::AsContiguous(chainerx::Transpose(tensor->chx(), {0, 2, 3, 1}));
+        Value* transposed = value->initializer() ? gb.Param(ohwi, value) : gb.Const(ohwi);
+        ohwi_of_.emplace(value, transposed);
+        return transposed;
+    }
+
+    Value* Transpose(Value* value, const std::vector<int64_t>& perm, std::map<Value*, Value*>* cache) {
+        auto found = cache->find(value);
+        if (found != cache->end()) {
+            return found->second;
+        }
+        GraphBuilder gb(graph_, "ChannelsLast", value);
+        std::unique_ptr<Type> type(PermuteType(value->type(), perm));
+        Value* transposed = gb.Temp(*type);
+        gb.Op(Node::kTranspose, {value}, transposed)->producer()->set_perm(perm);
+        if (cache == &channels_last_of_) {
+            channels_last_.emplace(transposed);
+        }
+        cache->emplace(value, transposed);
+        ++num_transposes_;
+        return transposed;
+    }
+
+    Graph* graph_;
+    // NHWC values.
+    std::set<const Value*> channels_last_;
+    // NCHW values to their NHWC counterparts.
+    std::map<Value*, Value*> channels_last_of_;
+    // NHWC values to their NCHW counterparts.
+    std::map<Value*, Value*> channels_first_of_;
+    // OIHW weights to their OHWI counterparts.
+    std::map<Value*, Value*> ohwi_of_;
+    int num_converted_{0};
+    int num_transposes_{0};
+};
+
+}  // namespace
+
+void PropagateChannelsLast(Graph* graph) {
+    ChannelsLastConverter converter(graph);
+    converter.Run();
+}
+
+}  // namespace chainer_compiler
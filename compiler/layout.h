@@ -0,0 +1,15 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Graph;
+
+// Rewrites float32 Conv, MaxPool, AveragePool and BatchNormalization
+// nodes so they take and produce NHWC tensors. The weights of Conv
+// become OHWI. Elementwise nodes between converted nodes keep the NHWC
+// layout, so transposes are inserted only where the layout changes,
+// e.g., at the beginning of the network and before Flatten. Converted
+// nodes have `chainer_channels_last` set. Only for inference.
+void PropagateChannelsLast(Graph* graph);
+
+}  // namespace chainer_compiler
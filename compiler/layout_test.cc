@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <chainerx/testing/context_session.h>
+
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/layout.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+TEST(LayoutTest, ConvReluMaxPool) {
+    Graph graph("test");
+    Value* input = graph.AddInputValue("input", Type(Dtype::kFloat32, {1, 3, 8, 8}));
+    Value* w = graph.AddInputValue("w", Type(Dtype::kFloat32, {4, 3, 3, 3}));
+    Value* output = graph.AddOutputValue("output", Type(Dtype::kFloat32, {1, 4, 4, 4}));
+
+    {
+        GraphBuilder gb(&graph, "test", output);
+        Value* conv = gb.Op(Node::kConv, {input, w}, gb.Temp(Type(Dtype::kFloat32, {1, 4, 8, 8})));
+        conv->producer()->set_pads({1, 1, 1, 1});
+        Value* relu = gb.Op(Node::kRelu, {conv}, gb.Temp(Type(Dtype::kFloat32, {1, 4, 8, 8})));
+        Node* pool = gb.Op(Node::kMaxPool, {relu}, output)->producer();
+        pool->set_kernel_shape({2, 2});
+        pool->set_strides({2, 2});
+    }
+
+    PropagateChannelsLast(&graph);
+    graph.CheckSanity("converted");
+
+    std::vector<std::vector<int64_t>> perms;
+    for (const Node* node : graph.GetTopologicallySortedNodes()) {
+        switch (node->op_type()) {
+            case Node::kTranspose:
+                perms.push_back(node->perm());
+                break;
+            case Node::kConv:
+            case Node::kMaxPool:
+                EXPECT_TRUE(node->chainer_channels_last());
+                break;
+            case Node::kRelu:
+                EXPECT_EQ(std::vector<int64_t>({1, 8, 8, 4}), node->output(0)->type().dims());
+                break;
+            default:
+                FAIL() << "Unexpected node: " << node->DebugString();
+        }
+    }
+
+    // The input, the weight, and the output are transposed.
+    ASSERT_EQ(3, perms.size());
+    EXPECT_EQ(1, std::count(perms.begin(), perms.end(), std::vector<int64_t>({0, 3, 1, 2})));
+    EXPECT_EQ(2, std::count(perms.begin(), perms.end(), std::vector<int64_t>({0, 2, 3, 1})));
+    EXPECT_EQ(Node::kTranspose, output->producer()->op_type());
+}
+
+TEST(LayoutTest, ConvWithInitializer) {
+    chainerx::testing::ContextSession sess;
+
+    Graph graph("test");
+    Value* input = graph.AddInputValue("input", Type(Dtype::kFloat32, {1, 2, 4, 4}));
+    // OIHW weight for a 1x2 kernel.
+    const std::vector<int64_t> w_dims = {1, 2, 1, 2};
+    Value* w = graph.AddInputValue("w", Type(Dtype::kFloat32, w_dims));
+    w->ResetInitializer(std::make_unique<Tensor>("w", Dtype::kFloat32, w_dims, std::vector<float>{0, 1, 2, 3}));
+    Value* output = graph.AddOutputValue("output", Type(Dtype::kFloat32, {1, 1, 4, 3}));
+
+    {
+        GraphBuilder gb(&graph, "test", output);
+        gb.Op(Node::kConv, {input, w}, output);
+    }
+
+    PropagateChannelsLast(&graph);
+    graph.CheckSanity("converted");
+
+    const Node* conv = nullptr;
+    for (const Node* node : graph.GetTopologicallySortedNodes()) {
+        if (node->op_type() == Node::kConv) {
+            conv = node;
+        } else {
+            // Only the input and the output are transposed.
+            ASSERT_EQ(Node::kTranspose, node->op_type());
+            EXPECT_NE(w, node->input(0));
+        }
+    }
+    ASSERT_TRUE(conv);
+    const Tensor* ohwi = conv->input(1)->initializer();
+    ASSERT_TRUE(ohwi);
+    EXPECT_EQ(std::vector<int64_t>({1, 1, 2, 2}), ohwi->dims());
+    const std::vector<float> expected = {0, 2, 1, 3};
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(expected[i], ohwi->Get<float>(i));
+    }
+    EXPECT_TRUE(w->users().empty());
+}
+
+}  // namespace
+}  // namespace chainer_compiler
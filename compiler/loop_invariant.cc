@@ -0,0 +1,205 @@
+#include "compiler/loop_invariant.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <common/log.h>
+#include <compiler/graph.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/speculation.h>
+#include <compiler/tensor.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+bool CanBeHoisted(const Node& node) {
+    if (!IsPure(node)) {
+        return false;
+    }
+
+    for (const Value* output : node.outputs()) {
+        if (output->IsNull()) {
+            continue;
+        }
+        // Sequences may be modified in-place in the loop.
+        if (output->IsOutput() || output->type().kind() != Type::Kind::kTensor) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns true if `loop` runs its body at least once.
+bool RunsAtLeastOnce(const Node& loop) {
+    const Value* max_trip_count = loop.input(0);
+    const Value* cond = loop.input(1);
+    if (!cond->IsNull()) {
+        return false;
+    }
+    if (max_trip_count->IsNull()) {
+        return true;
+    }
+    const Tensor* tensor = max_trip_count->initializer();
+    if (!tensor && max_trip_count->producer() && max_trip_count->producer()->op_type() == Node::kConstant) {
+        tensor = max_trip_count->producer()->tensor_value().get();
+    }
+    if (!tensor || !tensor->IsArray() || tensor->NumElements() != 1) {
+        return false;
+    }
+    switch (tensor->dtype()) {
+        case Dtype::kInt32:
+            return tensor->Get<int32_t>(0) > 0;
+        case Dtype::kInt64:
+            return tensor->Get<int64_t>(0) > 0;
+        default:
+            return false;
+    }
+}
+
+class LoopInvariantHoister {
+public:
+    LoopInvariantHoister(Graph* graph, Node* loop)
+        : graph_(graph), loop_(loop), body_(loop->body().get()), runs_at_least_once_(RunsAtLeastOnce(*loop)) {
+    }
+
+    int Run() {
+        FindInvariantStates();
+
+        std::vector<Node*> hoisted;
+        std::vector<Value*> temps;
+        for (Node* node : body_->GetTopologicallySortedNodes()) {
+            if (!AreAllInputsInvariant(*node)) {
+                continue;
+            }
+            if (node->op_type() == Node::kIdentity) {
+                outer_of_.emplace(node->output(0), outer_of_[node->input(0)]);
+                continue;
+            }
+            if (!CanBeHoisted(*node)) {
+                continue;
+            }
+            // Hoisted nodes run even if the loop runs no iteration.
+            if (!runs_at_least_once_ && MayFail(*node)) {
+                continue;
+            }
+            hoisted.push_back(node);
+            for (Value* output : node->outputs()) {
+                if (output->IsNull()) continue;
+                outer_of_.emplace(output, output);
+                temps.push_back(output);
+            }
+        }
+        if (hoisted.empty()) {
+            return 0;
+        }
+
+        const std::set<Node*> hoisted_set(hoisted.begin(), hoisted.end());
+        for (Node* node : hoisted) {
+            const std::set<Value*> inputs(node->inputs().begin(), node->inputs().end());
+            for (Value* input : inputs) {
+                if (input->IsNull()) continue;
+                Value* outer = outer_of_[input];
+                if (outer != input) {
+                    node->ReplaceInput(input, outer);
+                }
+            }
+        }
+        body_->MigrateNodes(hoisted, temps, graph_);
+
+        for (Value* value : temps) {
+            std::vector<Node*> users;
+            for (Node* user : value->users()) {
+                if (!hoisted_set.count(user)) users.push_back(user);
+            }
+            if (users.empty()) {
+                continue;
+            }
+            Value* body_in = AddLoopState(value);
+            for (Node* user : users) {
+                user->ReplaceInput(value, body_in);
+            }
+        }
+        return hoisted.size();
+    }
+
+private:
+    // A loop state is invariant if the body passes it to the next
+    // iteration as is.
+    void FindInvariantStates() {
+        const std::vector<Value*>& body_inputs = body_->input_values();
+        const std::vector<Value*>& body_outputs = body_->output_values();
+        const int num_states = loop_->inputs().size() - 2;
+        for (int i = 0; i < num_states; ++i) {
+            Value* outer = loop_->input(i + 2);
+            Value* body_in = body_inputs[i + 2];
+            Value* body_out = body_outputs[i + 1];
+            if (outer->IsNull()) {
+                continue;
+            }
+            const Node* producer = body_out->producer();
+            if (body_out == body_in || (producer && producer->op_type() == Node::kIdentity && producer->input(0) == body_in)) {
+                outer_of_.emplace(body_in, outer);
+            }
+        }
+    }
+
+    bool AreAllInputsInvariant(const Node& node) const {
+        bool has_input = false;
+        for (Value* input : node.inputs()) {
+            if (input->IsNull()) continue;
+            if (!outer_of_.count(input)) return false;
+            has_input = true;
+        }
+        return has_input;
+    }
+
+    // Adds a loop state which passes `value` through iterations and
+    // returns the corresponding input of the body.
+    Value* AddLoopState(Value* value) {
+        const int index = body_->input_values().size() - 2;
+        Value* body_in = body_->AddInputValue("LoopInvariantIn@" + value->name(), value->type());
+        Value* body_out = body_->AddOutputValue("LoopInvariantOut@" + value->name(), value->type(), index + 1);
+        body_->AddNode(Node::kIdentity, {body_in}, {body_out}, "LoopInvariant");
+        loop_->AddInput(value);
+        Value* unused = graph_->AddValue("LoopInvariantUnusedOut@" + value->name());
+        loop_->AddOutput(unused, index);
+        return body_in;
+    }
+
+    Graph* graph_;
+    Node* loop_;
+    Graph* body_;
+    const bool runs_at_least_once_;
+    // Invariant values in the body to the values in `graph_` which
+    // have the same contents.
+    std::map<Value*, Value*> outer_of_;
+};
+
+int HoistLoopInvariantsImpl(Graph* graph) {
+    int num_hoisted = 0;
+    for (Node* node : graph->GetLiveNodes()) {
+        for (Graph* subgraph : node->GetSubGraphs()) {
+            num_hoisted += HoistLoopInvariantsImpl(subgraph);
+        }
+        if (node->op_type() == Node::kLoop) {
+            LoopInvariantHoister hoister(graph, node);
+            num_hoisted += hoister.Run();
+        }
+    }
+    return num_hoisted;
+}
+
+}  // namespace
+
+int HoistLoopInvariants(Graph* graph) {
+    int num_hoisted = HoistLoopInvariantsImpl(graph);
+    CLOG() << "Loop invariants: " << num_hoisted << " nodes were hoisted" << std::endl;
+    return num_hoisted;
+}
+
+}  // namespace chainer_compiler
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Graph;
+
+// Moves nodes in Loop bodies whose inputs do not change across
+// iterations (e.g., Transpose of a weight) to the graph which owns the
+// Loop. Their outputs are passed to the body as new loop states which
+// are not updated in the body. Nested loops are processed from the
+// innermost one so invariant nodes can move out of several loops.
+// Must be run after `CanonicalizeSubGraphs`. Nodes in If branches are
+// not moved as they may not be executed. Returns the number of moved
+// nodes.
+int HoistLoopInvariants(Graph* graph);
+
+}  // namespace chainer_compiler
@@ -0,0 +1,193 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <common/strutil.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/loop_invariant.h>
+#include <compiler/node.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+TEST(LoopInvariantTest, TransposedWeight) {
+    const Type type(Dtype::kFloat32, {3, 3});
+    Graph graph("test");
+    Value* trip_count = graph.AddInputValue("trip_count", Type(Dtype::kInt64, {}));
+    Value* h0 = graph.AddInputValue("h0", type);
+    Value* w = graph.AddInputValue("w", type);
+    Value* output = graph.AddOutputValue("output", type);
+
+    Graph* body = new Graph("body");
+    {
+        body->AddInputValue("iter", Type(Dtype::kInt64, {}));
+        Value* cond = body->AddInputValue("cond", Type(Dtype::kBool, {}));
+        Value* h = body->AddInputValue("h", type);
+        Value* w_in = body->AddInputValue("w_in", type);
+        Value* cond_out = body->AddOutputValue("cond_out", Type(Dtype::kBool, {}));
+        Value* h_out = body->AddOutputValue("h_out", type);
+        Value* w_out = body->AddOutputValue("w_out", type);
+
+        GraphBuilder gb(body, "body", h_out);
+        gb.Op(Node::kIdentity, {cond}, cond_out);
+        gb.Op(Node::kIdentity, {w_in}, w_out);
+        Value* wt = gb.Op(Node::kTranspose, {w_in});
+        gb.Op(Node::kMatMul, {h, wt}, h_out);
+    }
+
+    {
+        GraphBuilder gb(&graph, "test", output);
+        Node* loop = gb.MOp(Node::kLoop, {trip_count, gb.Null(), h0, w}, {output, gb.Temp(type)});
+        loop->set_body(body);
+    }
+
+    EXPECT_EQ(1, HoistLoopInvariants(&graph));
+    graph.CheckSanity("hoisted");
+    body->CheckSanity("hoisted");
+
+    Node* transpose = nullptr;
+    Node* loop = nullptr;
+    for (Node* node : graph.GetTopologicallySortedNodes()) {
+        if (node->op_type() == Node::kTranspose) transpose = node;
+        if (node->op_type() == Node::kLoop) loop = node;
+    }
+    ASSERT_TRUE(transpose);
+    ASSERT_TRUE(loop);
+    EXPECT_EQ(w, transpose->input(0));
+
+    // The transposed weight is passed as a new loop state.
+    ASSERT_EQ(5, loop->inputs().size());
+    EXPECT_EQ(transpose->output(0), loop->input(4));
+    ASSERT_EQ(3, loop->outputs().size());
+    ASSERT_EQ(5, body->input_values().size());
+    ASSERT_EQ(4, body->output_values().size());
+
+    for (Node* node : body->GetTopologicallySortedNodes()) {
+        EXPECT_NE(Node::kTranspose, node->op_type());
+        if (node->op_type() == Node::kMatMul) {
+            EXPECT_EQ(body->input_values()[4], node->input(1));
+        }
+    }
+}
+
+// Builds a loop whose body adds `d / d` of an invariant integer
+// `d` to its state and returns the number of hoisted nodes.
+int HoistIntegerDivision(bool constant_trip_count) {
+    const Type type(Dtype::kInt64, {3});
+    Graph graph("test");
+    Value* x0 = graph.AddInputValue("x0", type);
+    Value* d = graph.AddInputValue("d", type);
+    Value* output = graph.AddOutputValue("output", type);
+
+    Graph* body = new Graph("body");
+    {
+        body->AddInputValue("iter", Type(Dtype::kInt64, {}));
+        Value* cond = body->AddInputValue("cond", Type(Dtype::kBool, {}));
+        Value* x = body->AddInputValue("x", type);
+        Value* d_in = body->AddInputValue("d_in", type);
+        Value* cond_out = body->AddOutputValue("cond_out", Type(Dtype::kBool, {}));
+        Value* x_out = body->AddOutputValue("x_out", type);
+        Value* d_out = body->AddOutputValue("d_out", type);
+
+        GraphBuilder gb(body, "body", x_out);
+        gb.Op(Node::kIdentity, {cond}, cond_out);
+        gb.Op(Node::kIdentity, {d_in}, d_out);
+        Value* dd = gb.Op(Node::kDiv, {d_in, d_in}, gb.Temp(type));
+        gb.Op(Node::kAdd, {x, dd}, x_out);
+    }
+
+    {
+        GraphBuilder gb(&graph, "test", output);
+        Value* trip_count = constant_trip_count ? gb.Const(Type(Dtype::kInt64, {}), {3})
+                                                : graph.AddInputValue("trip_count", Type(Dtype::kInt64, {}));
+        Node* loop = gb.MOp(Node::kLoop, {trip_count, gb.Null(), x0, d}, {output, gb.Temp(type)});
+        loop->set_body(body);
+    }
+
+    const int num_hoisted = HoistLoopInvariants(&graph);
+    graph.CheckSanity("hoisted");
+    body->CheckSanity("hoisted");
+    return num_hoisted;
+}
+
+TEST(LoopInvariantTest, MayFailWithoutIteration) {
+    // The division by zero must not happen when the loop runs no
+    // iteration.
+    EXPECT_EQ(0, HoistIntegerDivision(false));
+    EXPECT_EQ(1, HoistIntegerDivision(true));
+}
+
+// Builds a loop whose body adds `op_type` of invariant inputs to its
+// state and returns the number of hoisted nodes.
+int HoistInvariantOp(Node::OpType op_type, const std::vector<const Type*>& input_types, bool constant_trip_count) {
+    const Type type(Dtype::kFloat32, {2, 3});
+    Graph graph("test");
+    Value* x0 = graph.AddInputValue("x0", type);
+    std::vector<Value*> loop_inputs = {nullptr, nullptr, x0};
+    for (size_t i = 0; i < input_types.size(); ++i) {
+        loop_inputs.push_back(graph.AddInputValue(StrCat("a", i), *input_types[i]));
+    }
+    Value* output = graph.AddOutputValue("output", type);
+
+    Graph* body = new Graph("body");
+    {
+        body->AddInputValue("iter", Type(Dtype::kInt64, {}));
+        Value* cond = body->AddInputValue("cond", Type(Dtype::kBool, {}));
+        Value* x = body->AddInputValue("x", type);
+        std::vector<Value*> ins;
+        for (size_t i = 0; i < input_types.size(); ++i) {
+            ins.push_back(body->AddInputValue(StrCat("a_in", i), *input_types[i]));
+        }
+        Value* cond_out = body->AddOutputValue("cond_out", Type(Dtype::kBool, {}));
+        Value* x_out = body->AddOutputValue("x_out", type);
+        GraphBuilder gb(body, "body", x_out);
+        gb.Op(Node::kIdentity, {cond}, cond_out);
+        for (size_t i = 0; i < input_types.size(); ++i) {
+            gb.Op(Node::kIdentity, {ins[i]}, body->AddOutputValue(StrCat("a_out", i), *input_types[i]));
+        }
+        Value* y = gb.Op(op_type, ins, gb.Temp(type));
+        gb.Op(Node::kAdd, {x, y}, x_out);
+    }
+
+    {
+        GraphBuilder gb(&graph, "test", output);
+        loop_inputs[0] = constant_trip_count ? gb.Const(Type(Dtype::kInt64, {}), {3})
+                                             : graph.AddInputValue("trip_count", Type(Dtype::kInt64, {}));
+        loop_inputs[1] = gb.Null();
+        std::vector<Value*> loop_outputs = {output};
+        for (const Type* input_type : input_types) loop_outputs.push_back(gb.Temp(*input_type));
+        Node* loop = gb.MOp(Node::kLoop, loop_inputs, loop_outputs);
+        loop->set_body(body);
+    }
+
+    const int num_hoisted = HoistLoopInvariants(&graph);
+    graph.CheckSanity("hoisted");
+    body->CheckSanity("hoisted");
+    return num_hoisted;
+}
+
+TEST(LoopInvariantTest, ShapeMismatchWithoutIteration) {
+    const Type a_type(Dtype::kFloat32, {2, 3});
+    const Type b_type(Dtype::kFloat32, {3, 3});
+    const Type row_type(Dtype::kFloat32, {2});
+    const Type unknown_type(Dtype::kFloat32);
+    EXPECT_EQ(1, HoistInvariantOp(Node::kMatMul, {&a_type, &b_type}, false));
+    // MatMul of incompatible shapes must not fail when the loop runs
+    // no iteration.
+    EXPECT_EQ(0, HoistInvariantOp(Node::kMatMul, {&a_type, &a_type}, false));
+    EXPECT_EQ(1, HoistInvariantOp(Node::kMatMul, {&a_type, &a_type}, true));
+    EXPECT_EQ(0, HoistInvariantOp(Node::kAdd, {&a_type, &row_type}, false));
+    EXPECT_EQ(0, HoistInvariantOp(Node::kAdd, {&a_type, &unknown_type}, false));
+}
+
+TEST(LoopInvariantTest, Random) {
+    // Each iteration draws new values.
+    const Type type(Dtype::kFloat32, {2, 3});
+    EXPECT_EQ(0, HoistInvariantOp(Node::kRandomNormalLike, {&type}, true));
+}
+
+}  // namespace
+}  // namespace chainer_compiler
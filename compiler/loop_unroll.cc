@@ -0,0 +1,168 @@
+#include "compiler/loop_unroll.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <common/log.h>
+#include <common/strutil.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+bool GetConstantTripCount(const Value* value, int64_t* trip_count) {
+    const Tensor* tensor = value->initializer();
+    if (!tensor && value->producer() && value->producer()->op_type() == Node::kConstant) {
+        tensor = value->producer()->tensor_value().get();
+    }
+    if (!tensor || !tensor->IsArray() || tensor->NumElements() != 1) {
+        return false;
+    }
+    switch (tensor->dtype()) {
+        case Dtype::kInt32:
+            *trip_count = tensor->Get<int32_t>(0);
+            return true;
+        case Dtype::kInt64:
+            *trip_count = tensor->Get<int64_t>(0);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool CanBeUnrolled(const Node& loop, int max_nodes, int64_t* trip_count) {
+    if (!loop.input(1)->IsNull() || !GetConstantTripCount(loop.input(0), trip_count) || *trip_count <= 0) {
+        return false;
+    }
+    const std::vector<Node*> nodes = loop.body()->GetLiveNodes();
+    for (const Node* node : nodes) {
+        if (!node->GetSubGraphs().empty()) {
+            return false;
+        }
+    }
+    return *trip_count * nodes.size() <= max_nodes;
+}
+
+void UnrollLoop(Graph* graph, Node* loop, int64_t trip_count) {
+    Graph* body = loop->body().get();
+    const std::vector<Value*>& body_inputs = body->input_values();
+    const std::vector<Value*>& body_outputs = body->output_values();
+    const int num_states = loop->inputs().size() - 2;
+    const int num_scans = body_outputs.size() - 1 - num_states;
+    const std::vector<Node*> nodes = body->GetTopologicallySortedNodes();
+    GraphBuilder gb(graph, "UnrollLoop", loop->output(0));
+
+    std::vector<Value*> states;
+    for (int i = 0; i < num_states; ++i) {
+        states.push_back(loop->input(i + 2));
+    }
+    std::vector<std::vector<Value*>> scans(num_scans);
+
+    for (int64_t t = 0; t < trip_count; ++t) {
+        // Body values to their copies in `graph`.
+        std::map<Value*, Value*> copies;
+        if (!body_inputs[0]->users().empty()) {
+            copies[body_inputs[0]] = gb.Const(Type(Dtype::kInt64, {}), {t});
+        }
+        if (!body_inputs[1]->users().empty()) {
+            copies[body_inputs[1]] = gb.Const(Type(Dtype::kBool, {}), {1});
+        }
+        for (int i = 0; i < num_states; ++i) {
+            copies[body_inputs[i + 2]] = states[i];
+        }
+
+        for (Node* node : nodes) {
+            std::vector<Value*> inputs;
+            for (Value* input : node->inputs()) {
+                if (input->IsNull()) {
+                    inputs.push_back(gb.Null());
+                    continue;
+                }
+                auto found = copies.find(input);
+                CHECK(found != copies.end()) << "Unknown input in loop body: " << input->DebugString();
+                inputs.push_back(found->second);
+            }
+            std::vector<Value*> outputs;
+            for (Value* output : node->outputs()) {
+                if (output->IsNull()) {
+                    outputs.push_back(gb.Null());
+                    continue;
+                }
+                Value* copy = graph->AddValue(StrCat(output->name(), "@unroll", t), output->type());
+                copies.emplace(output, copy);
+                outputs.push_back(copy);
+            }
+            onnx::NodeProto xnode;
+            node->ToONNX(&xnode);
+            xnode.set_name(StrCat(node->name(), "@unroll", t));
+            graph->AddNodeImpl(std::unique_ptr<Node>(new Node(xnode, inputs, outputs)), inputs, outputs);
+        }
+
+        auto get_copy = [&copies](Value* value) {
+            auto found = copies.find(value);
+            CHECK(found != copies.end()) << "Loop body output is not computed: " << value->DebugString();
+            return found->second;
+        };
+        for (int i = 0; i < num_states; ++i) {
+            states[i] = get_copy(body_outputs[i + 1]);
+        }
+        for (int i = 0; i < num_scans; ++i) {
+            scans[i].push_back(get_copy(body_outputs[i + num_states + 1]));
+        }
+    }
+
+    for (int i = 0; i < num_states; ++i) {
+        Value* output = loop->output(i);
+        if (!output->IsNull()) {
+            gb.Op(Node::kIdentity, {states[i]}, output);
+        }
+    }
+    for (int i = 0; i < num_scans; ++i) {
+        Value* output = loop->output(i + num_states);
+        if (output->IsNull()) {
+            continue;
+        }
+        const int axis = loop->chainer_stack_axis();
+        std::vector<Value*> unsqueezed;
+        for (Value* value : scans[i]) {
+            unsqueezed.push_back(gb.Op(Node::kUnsqueeze, {value}));
+            unsqueezed.back()->producer()->set_axes({axis});
+        }
+        gb.Op(Node::kConcat, unsqueezed, output)->producer()->set_axis(axis);
+    }
+
+    graph->DetachNode(loop);
+}
+
+int UnrollLoopsImpl(Graph* graph, int max_nodes) {
+    int num_unrolled = 0;
+    for (Node* node : graph->GetLiveNodes()) {
+        for (Graph* subgraph : node->GetSubGraphs()) {
+            num_unrolled += UnrollLoopsImpl(subgraph, max_nodes);
+        }
+        int64_t trip_count;
+        if (node->op_type() == Node::kLoop && CanBeUnrolled(*node, max_nodes, &trip_count)) {
+            UnrollLoop(graph, node, trip_count);
+            ++num_unrolled;
+        }
+    }
+    return num_unrolled;
+}
+
+}  // namespace
+
+int UnrollLoops(Graph* graph, int max_nodes) {
+    int num_unrolled = UnrollLoopsImpl(graph, max_nodes);
+    CLOG() << "Loop unrolling: " << num_unrolled << " loops were unrolled" << std::endl;
+    return num_unrolled;
+}
+
+}  // namespace chainer_compiler
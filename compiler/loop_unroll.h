@@ -0,0 +1,16 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Graph;
+
+// Replaces Loop nodes which have a constant trip count and no
+// terminal condition with copies of their bodies, so later passes
+// (e.g., constant propagation and fusion) can optimize across
+// iterations. A loop is unrolled only if the unrolled nodes are at
+// most `max_nodes` and its body has no subgraphs. Scan outputs are
+// stacked by Unsqueeze and Concat. Must be run after
+// `CanonicalizeSubGraphs`. Returns the number of unrolled loops.
+int UnrollLoops(Graph* graph, int max_nodes);
+
+}  // namespace chainer_compiler
@@ -0,0 +1,63 @@
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/loop_unroll.h>
+#include <compiler/node.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+TEST(LoopUnrollTest, StateAndScan) {
+    const Type type(Dtype::kFloat32, {2});
+    Graph graph("test");
+    Value* h0 = graph.AddInputValue("h0", type);
+    Value* h_final = graph.AddOutputValue("h_final", type);
+    Value* scanned = graph.AddOutputValue("scanned", Type(Dtype::kFloat32, {3, 2}));
+
+    Graph* body = new Graph("body");
+    {
+        body->AddInputValue("iter", Type(Dtype::kInt64, {}));
+        Value* cond = body->AddInputValue("cond", Type(Dtype::kBool, {}));
+        Value* h = body->AddInputValue("h", type);
+        Value* cond_out = body->AddOutputValue("cond_out", Type(Dtype::kBool, {}));
+        Value* h_out = body->AddOutputValue("h_out", type);
+        Value* scan_out = body->AddOutputValue("scan_out", type);
+
+        GraphBuilder gb(body, "body", h_out);
+        gb.Op(Node::kIdentity, {cond}, cond_out);
+        gb.Op(Node::kAdd, {h, h}, h_out);
+        gb.Op(Node::kNeg, {h}, scan_out);
+    }
+
+    {
+        GraphBuilder gb(&graph, "test", h_final);
+        Value* trip_count = gb.Const(Type(Dtype::kInt64, {}), {3});
+        Node* loop = gb.MOp(Node::kLoop, {trip_count, gb.Null(), h0}, {h_final, scanned});
+        loop->set_body(body);
+    }
+
+    // Too many nodes.
+    EXPECT_EQ(0, UnrollLoops(&graph, 8));
+    EXPECT_EQ(1, UnrollLoops(&graph, 9));
+    graph.DeleteDetached();
+    graph.CheckSanity("unrolled");
+
+    std::map<Node::OpType, int> counts;
+    for (const Node* node : graph.GetTopologicallySortedNodes()) {
+        ++counts[node->op_type()];
+    }
+    EXPECT_EQ(0, counts[Node::kLoop]);
+    EXPECT_EQ(3, counts[Node::kAdd]);
+    EXPECT_EQ(3, counts[Node::kNeg]);
+    EXPECT_EQ(3, counts[Node::kUnsqueeze]);
+    EXPECT_EQ(1, counts[Node::kConcat]);
+    EXPECT_EQ(Node::kIdentity, h_final->producer()->op_type());
+    EXPECT_EQ(Node::kConcat, scanned->producer()->op_type());
+}
+
+}  // namespace
+}  // namespace chainer_compiler
@@ -5,18 +5,33 @@
 
 #include <common/log.h>
 #include <common/strutil.h>
+#include <compiler/flags.h>
 #include <compiler/graph.h>
 #include <compiler/log.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
 
 namespace chainer_compiler {
 
+namespace {
+
+int64_t EstimateNBytes(const Value* value) {
+    const int64_t nbytes = value->GetNBytes();
+    if (nbytes >= 0 || g_symbolic_dim_size <= 0 || value->IsNull() || value->type().kind() != Type::Kind::kTensor) {
+        return nbytes;
+    }
+    return value->type().EstimateNBytes(g_symbolic_dim_size);
+}
+
+}  // namespace
+
 SimulatedMemoryUsage SimulateMemoryUsage(const Graph& graph) {
     std::map<const Value*, int> num_users;
     SimulatedMemoryUsage usage{};
     int64_t mem = 0;
 
     auto alloc = [&usage, &mem](const Value* value) {
-        const int64_t increase = value->GetNBytes();
+        const int64_t increase = EstimateNBytes(value);
         usage.num_values++;
         if (increase < 0) {
             CLOG() << "Unknown " << value->type().kind() << " shape: " << value->name()
@@ -32,7 +47,7 @@ SimulatedMemoryUsage SimulateMemoryUsage(const Graph& graph) {
     for (const Value* value : graph.GetNecessaryValues()) {
         int nu = value->users().size();
         if (value->IsInput()) {
-            int64_t bytes = value->GetNBytes();
+            int64_t bytes = EstimateNBytes(value);
             if (value->initializer()) {
                 usage.param += bytes >= 0 ? bytes : 0;
                 // We assume parameters will never be freed.
@@ -52,7 +67,7 @@ SimulatedMemoryUsage SimulateMemoryUsage(const Graph& graph) {
             auto found = num_users.find(value);
             if (found == num_users.end()) continue;
             if (--found->second == 0) {
-                mem -= value->GetNBytes();
+                mem -= EstimateNBytes(value);
             }
         }
     }
@@ -129,7 +129,7 @@ bool MaybeMergeConvBN(Graph* graph, Node* conv) {
         return false;
     }
     Node* bn = conv_bn->user(0);
-    if (bn->input(0) != conv_bn || bn->op_type() != Node::kBatchNormalization || bn->outputs().size() != 1) {
+    if (bn->input(0) != conv_bn || bn->op_type() != Node::kBatchNormalization || bn->outputs().size() != 1 || bn->chainer_fuse_relu()) {
         return false;
     }
 
@@ -184,6 +184,28 @@ bool MaybeMergeConvBN(Graph* graph, Node* conv) {
     return true;
 }
 
+// Fuses ReLU into the preceding BatchNormalization for training,
+// where MergeConvBN cannot be applied. The runtime applies ReLU to
+// the output of BatchNormalization and masks the output gradient by
+// the output, so the intermediate value of BatchNormalization does
+// not need to be kept for backprop.
+bool MaybeMergeBatchNormalizationRelu(Graph* graph, Node* bn) {
+    Value* bn_relu = bn->output(0);
+    if (bn_relu->users().size() != 1 || bn_relu->IsOutput() || bn->chainer_fuse_relu() || bn->chainer_channels_last()) {
+        return false;
+    }
+    Node* relu = bn_relu->user(0);
+    if (relu->op_type() != Node::kRelu) {
+        return false;
+    }
+
+    Value* relu_output = relu->output(0);
+    graph->DetachNode(relu);
+    bn->ReplaceOutput(bn_relu, relu_output);
+    bn->set_chainer_fuse_relu(true);
+    return true;
+}
+
 bool MaybeMergeTransposeGemm(Graph* graph, Node* trans) {
     Value* trans_gemm = trans->output(0);
     if (trans_gemm->users().size() != 1) {
@@ -337,6 +359,14 @@ void MergeOperations(const std::set<std::string>& merger_names, Graph* graph, bo
         return MaybeMergeConvBN(graph, target);
     });
 
+    register_merger(Node::kBatchNormalization, "MergeBatchNormalizationRelu", [gen_backprop](Graph* graph, Node* target) {
+        // For inference, MergeConvBN folds BatchNormalization instead.
+        if (!gen_backprop) {
+            return false;
+        }
+        return MaybeMergeBatchNormalizationRelu(graph, target);
+    });
+
     // Check for non-registered merger
     for (const std::string& name : merger_names) {
         CHECK_EQ(1, all_merger_names.count(name)) << name << "not registerd";
@@ -205,5 +205,39 @@ TEST(MergeTest, ConvAdd) {
     graph.CheckSanity("merged");
 }
 
+TEST(MergeTest, BatchNormalizationRelu) {
+    Type type(Dtype::kFloat32, {2, 3, 4, 4});
+    Type param_type(Dtype::kFloat32, {3});
+    Graph graph("test");
+    Value* input = graph.AddInputValue("input", type);
+    std::vector<Value*> params;
+    for (const char* name : {"scale", "b", "mean", "var"}) {
+        params.push_back(graph.AddInputValue(name, param_type));
+    }
+    Value* output = graph.AddOutputValue("output", type);
+
+    {
+        GraphBuilder gb(&graph, "test", input);
+        std::vector<Value*> bn_inputs = {input};
+        bn_inputs.insert(bn_inputs.end(), params.begin(), params.end());
+        gb.Op(Node::kRelu, {gb.Op(Node::kBatchNormalization, bn_inputs)}, output);
+    }
+
+    // Only for training.
+    MergeOperations({"MergeBatchNormalizationRelu"}, &graph, false);
+    graph.DeleteDetached();
+    EXPECT_EQ(2, graph.nodes().size());
+
+    MergeOperations({"MergeBatchNormalizationRelu"}, &graph, true);
+    graph.DeleteDetached();
+    ASSERT_EQ(1, graph.nodes().size());
+    const Node& node = *graph.nodes()[0];
+    EXPECT_EQ(Node::kBatchNormalization, node.op_type());
+    EXPECT_TRUE(node.chainer_fuse_relu());
+    EXPECT_EQ(input, node.input(0));
+    EXPECT_EQ(output, node.output(0));
+    graph.CheckSanity("merged");
+}
+
 }  // namespace
 }  // namespace chainer_compiler
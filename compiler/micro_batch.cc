@@ -0,0 +1,239 @@
+#include "compiler/micro_batch.h"
+
+#include <algorithm>
+#include <iostream>
+#include <queue>
+#include <set>
+#include <vector>
+
+#include <common/log.h>
+#include <common/strutil.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/node.h>
+#include <compiler/topology.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+bool ShouldSlice(const Value& value) {
+    if (value.initializer()) return false;
+    const Type& type = value.type();
+    if (type.kind() != Type::Kind::kTensor) return false;
+    // Scalars such as the batch size for one-hot are passed as-is.
+    return !type.HasKnownShape() || type.ndim() != 0;
+}
+
+bool IsGradient(const Value& value) {
+    return HasPrefix(value.name(), "grad_out@");
+}
+
+}  // namespace
+
+void SplitIntoMicroBatches(Graph* graph, int num_micro_batches) {
+    CHECK_LT(1, num_micro_batches);
+    const std::vector<Node*> nodes = graph->GetLiveNodes();
+    if (nodes.empty()) {
+        return;
+    }
+    const std::set<Node*> node_set(nodes.begin(), nodes.end());
+
+    std::vector<Value*> inputs;
+    std::vector<Value*> outputs;
+    std::vector<Value*> temps;
+    ClassifyValues(nodes, &inputs, &outputs, &temps);
+    auto is_null = [](const Value* value) { return value->IsNull(); };
+    inputs.erase(std::remove_if(inputs.begin(), inputs.end(), is_null), inputs.end());
+    temps.erase(std::remove_if(temps.begin(), temps.end(), is_null), temps.end());
+    for (Value* value : outputs) {
+        CHECK(value->IsOutput()) << "Unexpected output of micro-batch loop: " << value->DebugString();
+    }
+    if (outputs.empty()) {
+        return;
+    }
+
+    // Scalar outputs (i.e., the loss) and gradients are accumulated
+    // over micro-batches. Other outputs have the batch dimension and
+    // are concatenated along it as scan outputs of the loop.
+    std::vector<Value*> acc_outputs;
+    std::vector<Value*> scan_outputs;
+    for (Value* value : outputs) {
+        if (IsGradient(*value)) {
+            acc_outputs.push_back(value);
+            continue;
+        }
+        const Type& type = value->type();
+        CHECK(type.kind() == Type::Kind::kTensor && type.HasKnownShape())
+                << "Output of micro-batch loop must have a known shape: " << value->DebugString();
+        if (type.ndim() == 0) {
+            acc_outputs.push_back(value);
+            if (Node* producer = value->producer()) {
+                if (producer->op_type() == Node::kReduceSum || producer->op_type() == Node::kReduceSumSquare) {
+                    WARN_ONCE(StrCat(
+                            "Loss ",
+                            value->name(),
+                            " looks reduced by sum but is averaged over micro-batches. "
+                            "The loss and gradients will be 1/",
+                            num_micro_batches,
+                            " of the ones for the whole batch"));
+                }
+            }
+        } else {
+            CHECK_EQ(0, type.dims()[0] % num_micro_batches)
+                    << "Batch size of " << value->name() << " (" << type.dims()[0] << ") is not divisible by " << num_micro_batches;
+            scan_outputs.push_back(value);
+        }
+    }
+    // The gradients of a non-scalar loss are the ones of its sum, so
+    // they are simply summed over micro-batches.
+    const bool average_gradients = scan_outputs.empty();
+
+    auto replace_value = [&node_set](Value* value, Value* new_value) {
+        if (Node* node = value->producer()) {
+            if (node_set.count(node)) {
+                node->ReplaceOutput(value, new_value);
+            }
+        }
+
+        const std::vector<Node*> users(value->users());  // Take a copy.
+        for (Node* node : users) {
+            if (node_set.count(node)) {
+                node->ReplaceInput(value, new_value);
+            }
+        }
+    };
+
+    // Loop(max_trips, cond, inputs..., accs...) -> (inputs..., accs...)
+    //  body(iter, cond, inputs..., accs...) -> (cond, inputs..., accs...)
+    Graph* body = new Graph(StrCat(graph->name(), "_MicroBatch"));
+    Value* iter = body->AddInputValue("micro_batch_iter", Type(Dtype::kInt64, {}));
+    Value* cond = body->AddInputValue("micro_batch_cond", Type(Dtype::kBool, {}));
+    Value* cond_out = body->AddOutputValue("micro_batch_cond_out", cond->type());
+
+    std::vector<Value*> sliced_values;
+    {
+        GraphBuilder gb(body, "MicroBatch", iter);
+        gb.Op(Node::kIdentity, {cond}, cond_out);
+
+        Value* starts = nullptr;
+        Value* ends = nullptr;
+        Value* axes = gb.Const(Type(Dtype::kInt64, {1}), {0});
+        for (Value* value : inputs) {
+            Value* body_in = body->AddInputValue(StrCat("micro_batch_in_", value->name()), value->type());
+            Value* body_out = body->AddOutputValue(StrCat("micro_batch_out_", value->name()), value->type());
+            gb.Op(Node::kIdentity, {body_in}, body_out);
+
+            if (!ShouldSlice(*value)) {
+                replace_value(value, body_in);
+                continue;
+            }
+
+            if (value->type().HasKnownShape()) {
+                const int64_t batch_size = value->type().dims()[0];
+                CHECK_EQ(0, batch_size % num_micro_batches)
+                        << "Batch size of " << value->name() << " (" << batch_size << ") is not divisible by " << num_micro_batches;
+            }
+
+            if (!starts) {
+                Value* shape = gb.Op(Node::kShape, {body_in});
+                Value* batch_size = gb.Op(Node::kGather, {shape, gb.Const(Type(Dtype::kInt64, {}), {0})});
+                Value* micro_batch_size = gb.Op(Node::kDiv, {batch_size, gb.Const(Type(Dtype::kInt64, {}), {num_micro_batches})});
+                Value* start = gb.Op(Node::kMul, {iter, micro_batch_size});
+                Value* end = gb.Op(Node::kAdd, {start, micro_batch_size});
+                starts = gb.Op(Node::kUnsqueeze, {start});
+                starts->producer()->set_axes({0});
+                ends = gb.Op(Node::kUnsqueeze, {end});
+                ends->producer()->set_axes({0});
+            }
+
+            Value* sliced = gb.Op(Node::kDynamicSlice, {body_in, starts, ends, axes});
+            replace_value(value, sliced);
+            sliced_values.push_back(sliced);
+        }
+        CHECK(!sliced_values.empty()) << "No input to be split into micro-batches";
+    }
+
+    {
+        GraphBuilder gb(body, "MicroBatchAcc", iter);
+        for (Value* value : acc_outputs) {
+            Value* acc_in = body->AddInputValue(StrCat("micro_batch_acc_in_", value->name()), value->type());
+            Value* acc_out = body->AddOutputValue(StrCat("micro_batch_acc_out_", value->name()), value->type());
+            Value* result = gb.Temp(value->type());
+            replace_value(value, result);
+            gb.Op(Node::kChainerGenericAccumulateGrad, {acc_in, result}, acc_out);
+        }
+        for (Value* value : scan_outputs) {
+            Value* scan_out = body->AddOutputValue(StrCat("micro_batch_scan_out_", value->name()), Type(value->type().dtype()));
+            Value* result = gb.Temp(value->type());
+            replace_value(value, result);
+            gb.Op(Node::kIdentity, {result}, scan_out);
+        }
+    }
+
+    graph->MigrateNodes(nodes, temps, body);
+
+    // Shapes of values computed from sliced inputs no longer match
+    // the types inferred for the whole batch.
+    {
+        std::set<Value*> seen(sliced_values.begin(), sliced_values.end());
+        std::queue<Value*> q;
+        for (Value* value : sliced_values) q.push(value);
+        while (!q.empty()) {
+            Value* value = q.front();
+            q.pop();
+            value->set_type(new Type(value->type().dtype()));
+            for (Node* user : value->users()) {
+                if (user->op_type() == Node::kChainerGenericAccumulateGrad) continue;
+                for (Value* output : user->outputs()) {
+                    if (output->IsNull() || !seen.emplace(output).second) continue;
+                    q.push(output);
+                }
+            }
+        }
+    }
+
+    GraphBuilder gb(graph, "MicroBatch", outputs.front());
+    std::vector<Value*> loop_inputs = {gb.Const(Type(Dtype::kInt64, {}), {num_micro_batches}), gb.Null()};
+    std::vector<Value*> loop_outputs;
+    for (Value* value : inputs) {
+        loop_inputs.push_back(value);
+        loop_outputs.push_back(gb.Null());
+    }
+    std::vector<Value*> accs;
+    for (Value* value : acc_outputs) {
+        loop_inputs.push_back(gb.Op(Node::kChainerNullConstant, {}));
+        Value* acc = gb.Temp(value->type());
+        loop_outputs.push_back(acc);
+        accs.push_back(acc);
+    }
+    std::vector<Value*> scans;
+    for (Value* value : scan_outputs) {
+        Value* scan = gb.Temp();
+        loop_outputs.push_back(scan);
+        scans.push_back(scan);
+    }
+
+    Node* loop = gb.MOp(Node::kLoop, loop_inputs, loop_outputs);
+    loop->set_body(body);
+
+    for (size_t i = 0; i < acc_outputs.size(); ++i) {
+        Value* value = acc_outputs[i];
+        if (IsGradient(*value) && !average_gradients) {
+            gb.Op(Node::kIdentity, {accs[i]}, value);
+            continue;
+        }
+        Value* divisor = gb.Const(Type(value->type().dtype(), {}), {num_micro_batches});
+        gb.Op(Node::kDiv, {accs[i], divisor}, value);
+    }
+    // Scan outputs are stacked as (num_micro_batches, micro_batch_size, ...).
+    for (size_t i = 0; i < scan_outputs.size(); ++i) {
+        Value* value = scan_outputs[i];
+        const std::vector<int64_t>& dims = value->type().dims();
+        Value* shape = gb.Const(Type(Dtype::kInt64, {static_cast<int64_t>(dims.size())}), dims);
+        gb.Op(Node::kReshape, {scans[i], shape}, value);
+    }
+}
+
+}  // namespace chainer_compiler
@@ -0,0 +1,23 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Graph;
+
+// Wraps the whole training graph into a Loop which runs the forward
+// and backward computation for `num_micro_batches` slices of the
+// batch dimension. A scalar loss and `grad_out@` values are
+// accumulated over iterations and divided by the number of
+// micro-batches so the result matches the single-batch computation
+// for losses reduced by mean. A warning is shown for losses reduced
+// by sum. Other outputs are concatenated along the batch dimension,
+// and the gradients of such a non-scalar loss are summed instead.
+// Activations of a micro-batch are freed before the next one starts.
+//
+// Only non-initializer inputs whose rank is not zero are sliced, and
+// their batch size must be divisible by `num_micro_batches`. Batch
+// dependent statistics (e.g., BatchNormalization) are computed per
+// micro-batch.
+void SplitIntoMicroBatches(Graph* graph, int num_micro_batches);
+
+}  // namespace chainer_compiler
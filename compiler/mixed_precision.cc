@@ -0,0 +1,256 @@
+#include "compiler/mixed_precision.h"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <common/log.h>
+#include <common/strutil.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+// The initial loss scale. Same as the default of Chainer's
+// DynamicLossScaling.
+constexpr float kInitialLossScale = 32768;
+// The loss scale is doubled after this number of steps without
+// overflow.
+constexpr int kLossScaleGrowthInterval = 2000;
+
+enum class Precision {
+    // Computed in float16.
+    kHalf,
+    // Computed in float16 if one of inputs is float16.
+    kFollow,
+    // Computed in float32.
+    kFloat,
+    // Does not depend on the dtype of inputs.
+    kAny,
+};
+
+Precision GetPrecision(const Node& node) {
+    if (!node.GetSubGraphs().empty()) {
+        return Precision::kFloat;
+    }
+
+    switch (node.op_type()) {
+        case Node::kConv:
+        case Node::kConvTranspose:
+        case Node::kMatMul:
+        case Node::kGemm:
+        case Node::kChainerLinear:
+            return Precision::kHalf;
+
+        case Node::kAdd:
+        case Node::kSub:
+        case Node::kMul:
+        case Node::kDiv:
+        case Node::kNeg:
+        case Node::kRelu:
+        case Node::kLeakyRelu:
+        case Node::kSigmoid:
+        case Node::kTanh:
+        case Node::kMaxPool:
+        case Node::kAveragePool:
+        case Node::kIdentity:
+        case Node::kDropout:
+        case Node::kReshape:
+        case Node::kFlatten:
+        case Node::kSqueeze:
+        case Node::kUnsqueeze:
+        case Node::kTranspose:
+        case Node::kConcat:
+        case Node::kSplit:
+        case Node::kExpand:
+        case Node::kPad:
+        case Node::kMax:
+        case Node::kMin:
+        case Node::kClip:
+        case Node::kGather:
+        case Node::kDynamicSlice:
+            return Precision::kFollow;
+
+        case Node::kShape:
+        case Node::kSize:
+            return Precision::kAny;
+
+        // Reductions, softmax, normalizations, and unknown ops.
+        default:
+            return Precision::kFloat;
+    }
+}
+
+class MixedPrecisionConverter {
+public:
+    explicit MixedPrecisionConverter(Graph* graph) : graph_(graph) {
+    }
+
+    void Run() {
+        for (Node* node : graph_->GetTopologicallySortedNodes()) {
+            Convert(node);
+        }
+        CLOG() << "Mixed precision: " << num_converted_ << " values are float16 (" << saved_bytes_ / 1000 / 1000 << "MB saved)"
+               << std::endl;
+    }
+
+private:
+    void Convert(Node* node) {
+        Precision precision = GetPrecision(*node);
+        if (precision == Precision::kAny) {
+            return;
+        }
+        if (precision == Precision::kFollow) {
+            precision = Precision::kFloat;
+            for (Value* input : node->inputs()) {
+                if (halves_.count(input)) precision = Precision::kHalf;
+            }
+        }
+
+        if (precision == Precision::kFloat) {
+            for (Value* input : node->inputs()) {
+                if (halves_.count(input)) node->ReplaceInput(input, ToFloat(input));
+            }
+            return;
+        }
+
+        for (Value* input : node->inputs()) {
+            if (!input->IsNull() && input->type().dtype() == Dtype::kFloat32) node->ReplaceInput(input, ToHalf(input));
+        }
+        for (Value* output : node->outputs()) {
+            if (output->IsNull() || output->type().dtype() != Dtype::kFloat32) continue;
+            if (output->IsOutput()) {
+                // Graph outputs are kept in float32.
+                GraphBuilder gb(graph_, "MixedPrecision", output);
+                Type type(output->type());
+                type.set_dtype(Dtype::kFloat16);
+                Value* half = gb.Temp(type);
+                node->ReplaceOutput(output, half);
+                gb.Op(Node::kCast, {half}, output)->producer()->set_to(Dtype::kFloat32);
+                halves_.emplace(half);
+                floats_.emplace(half, output);
+            } else {
+                const int64_t nbytes = output->GetNBytes();
+                if (nbytes > 0) saved_bytes_ += nbytes / 2;
+                output->mutable_type()->set_dtype(Dtype::kFloat16);
+                halves_.emplace(output);
+            }
+            ++num_converted_;
+        }
+    }
+
+    Value* ToHalf(Value* value) {
+        auto found = halves_of_.find(value);
+        if (found != halves_of_.end()) {
+            return found->second;
+        }
+        GraphBuilder gb(graph_, "MixedPrecision", value);
+        Value* half = gb.Op(Node::kCast, {value});
+        half->producer()->set_to(Dtype::kFloat16);
+        halves_of_.emplace(value, half);
+        halves_.emplace(half);
+        floats_.emplace(half, value);
+        return half;
+    }
+
+    Value* ToFloat(Value* value) {
+        auto found = floats_.find(value);
+        if (found != floats_.end()) {
+            return found->second;
+        }
+        GraphBuilder gb(graph_, "MixedPrecision", value);
+        Value* single = gb.Op(Node::kCast, {value});
+        single->producer()->set_to(Dtype::kFloat32);
+        floats_.emplace(value, single);
+        return single;
+    }
+
+    Graph* graph_;
+    // Values converted to float16 by this pass.
+    std::set<Value*> halves_;
+    // Float32 values to their float16 counterparts.
+    std::map<Value*, Value*> halves_of_;
+    // Float16 values to their float32 counterparts.
+    std::map<Value*, Value*> floats_;
+    int num_converted_{0};
+    int64_t saved_bytes_{0};
+};
+
+Value* AddFloatParam(Graph* graph, const std::string& name, float value) {
+    Value* param = graph->AddInputValue(name, Type(Dtype::kFloat32, {}));
+    param->ResetInitializer(std::make_unique<Tensor>(param->name(), Dtype::kFloat32, std::vector<int64_t>{}, std::vector<float>{value}));
+    return param;
+}
+
+}  // namespace
+
+void ConvertToMixedPrecision(Graph* graph) {
+    MixedPrecisionConverter converter(graph);
+    converter.Run();
+}
+
+Value* AddLossScaleParam(Graph* graph) {
+    return AddFloatParam(graph, "chainer_loss_scale", kInitialLossScale);
+}
+
+void AddDynamicLossScaling(Graph* graph, Value* loss_scale) {
+    std::vector<Value*> grads;
+    for (Value* value : graph->output_values()) {
+        if (HasPrefix(value->name(), "grad_out@")) grads.push_back(value);
+    }
+    if (grads.empty()) {
+        return;
+    }
+
+    Value* good_steps = AddFloatParam(graph, "chainer_loss_scale_good_steps", 0);
+    GraphBuilder gb(graph, "LossScaling", loss_scale);
+    Value* zero = gb.Const(Type(Dtype::kFloat32, {}), {0.0});
+    Value* one = gb.Const(Type(Dtype::kFloat32, {}), {1.0});
+
+    std::vector<Value*> scaled_grads;
+    Value* total = nullptr;
+    for (Value* grad : grads) {
+        CHECK_EQ(Dtype::kFloat32, grad->type().dtype()) << grad->ToString();
+        Value* scaled = gb.Temp(grad->type());
+        grad->producer()->ReplaceOutput(grad, scaled);
+        scaled_grads.push_back(scaled);
+        Value* sum = gb.Op(Node::kReduceSum, {scaled});
+        sum->producer()->set_keepdims(false);
+        total = total ? gb.Op(Node::kAdd, {total, sum}) : sum;
+    }
+
+    // The sum of gradients is not finite iff any gradient overflowed.
+    // NaN and infinities are not less than infinity.
+    Value* inf = gb.Const(Type(Dtype::kFloat32, {}), {std::numeric_limits<float>::infinity()});
+    Value* ok = gb.Op(Node::kGreater, {inf, gb.Op(Node::kAbs, {total})});
+
+    Value* inv_scale = gb.Op(Node::kDiv, {one, loss_scale});
+    for (size_t i = 0; i < grads.size(); ++i) {
+        Value* unscaled = gb.Op(Node::kMul, {scaled_grads[i], inv_scale});
+        gb.Op(Node::kWhere, {ok, unscaled, zero}, grads[i]);
+    }
+
+    Value* steps = gb.Op(Node::kAdd, {good_steps, one});
+    Value* grow = gb.Op(Node::kGreater, {steps, gb.Const(Type(Dtype::kFloat32, {}), {kLossScaleGrowthInterval - 0.5})});
+    Value* grown_scale = gb.Op(Node::kMul, {loss_scale, gb.Const(Type(Dtype::kFloat32, {}), {2.0})});
+    Value* halved_scale = gb.Op(Node::kMul, {loss_scale, gb.Const(Type(Dtype::kFloat32, {}), {0.5})});
+    Value* ok_scale = gb.Op(Node::kWhere, {grow, grown_scale, loss_scale});
+    Value* ok_steps = gb.Op(Node::kWhere, {grow, zero, steps});
+
+    Value* new_scale = graph->AddOutputValue("state_out@" + loss_scale->name(), loss_scale->type());
+    gb.Op(Node::kWhere, {ok, ok_scale, halved_scale}, new_scale);
+    Value* new_steps = graph->AddOutputValue("state_out@" + good_steps->name(), good_steps->type());
+    gb.Op(Node::kWhere, {ok, ok_steps, zero}, new_steps);
+}
+
+}  // namespace chainer_compiler
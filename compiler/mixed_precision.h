@@ -0,0 +1,26 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Graph;
+class Value;
+
+// Rewrites a float32 graph so compute bound operations (Conv, MatMul,
+// Gemm, ...) and cheap elementwise operations around them run in
+// float16. Reductions, softmax, BatchNormalization and graph outputs
+// stay in float32. Parameters are kept in float32 and casted to
+// float16 where they are used, so their gradients are float32, too.
+void ConvertToMixedPrecision(Graph* graph);
+
+// Adds a float32 scalar parameter which holds the current loss
+// scale. Pass the returned value to `AddGradientNodesForTraining`.
+Value* AddLossScaleParam(Graph* graph);
+
+// Unscales `grad_out@` outputs generated with `loss_scale`. When any
+// gradient is not finite, all gradients become zero and the loss
+// scale is halved. The loss scale is doubled after a number of
+// successful steps. Updated states are exposed as `state_out@<name>`
+// outputs which should be fed back to the inputs with `<name>`.
+void AddDynamicLossScaling(Graph* graph, Value* loss_scale);
+
+}  // namespace chainer_compiler
@@ -0,0 +1,119 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <chainerx/testing/context_session.h>
+
+#include <common/log.h>
+#include <compiler/evaluator.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/mixed_precision.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+struct LossScalingResult {
+    std::vector<float> grad;
+    float scale;
+    float good_steps;
+};
+
+// Runs one step of the dynamic loss scaling for a gradient `grad`
+// computed with `scale`.
+LossScalingResult RunLossScaling(const std::vector<float>& grad, float scale, float good_steps) {
+    const Type type(Dtype::kFloat32, {static_cast<int64_t>(grad.size())});
+    Graph graph("test");
+    Value* g = graph.AddInputValue("g", type);
+    Value* grad_out = graph.AddOutputValue("grad_out@w", type);
+    {
+        GraphBuilder gb(&graph, "test", grad_out);
+        gb.Op(Node::kIdentity, {g}, grad_out);
+    }
+    Value* loss_scale = AddLossScaleParam(&graph);
+    AddDynamicLossScaling(&graph, loss_scale);
+
+    std::vector<std::unique_ptr<Tensor>> tensors;
+    std::vector<std::pair<Value*, Tensor*>> feeds;
+    for (Value* input : graph.input_values()) {
+        if (input->name() == "g") {
+            tensors.emplace_back(new Tensor("g", Dtype::kFloat32, type.dims(), grad));
+        } else if (input->name() == "chainer_loss_scale") {
+            tensors.emplace_back(new Tensor(input->name(), Dtype::kFloat32, std::vector<int64_t>{}, std::vector<float>{scale}));
+        } else if (input->name() == "chainer_loss_scale_good_steps") {
+            tensors.emplace_back(new Tensor(input->name(), Dtype::kFloat32, std::vector<int64_t>{}, std::vector<float>{good_steps}));
+        } else {
+            continue;
+        }
+        feeds.emplace_back(input, tensors.back().get());
+    }
+    EXPECT_EQ(3, feeds.size());
+
+    Value* new_scale = nullptr;
+    Value* new_steps = nullptr;
+    for (Value* output : graph.output_values()) {
+        if (output->name() == "state_out@chainer_loss_scale") new_scale = output;
+        if (output->name() == "state_out@chainer_loss_scale_good_steps") new_steps = output;
+    }
+    CHECK(new_scale);
+    CHECK(new_steps);
+
+    std::vector<std::unique_ptr<EvaluatedValue>> outputs;
+    Eval(graph.GetTopologicallySortedNodes(), feeds, {grad_out, new_scale, new_steps}, &outputs);
+    CHECK_EQ(3, outputs.size());
+    std::unique_ptr<Tensor> grad_t(outputs[0]->ReleaseTensor());
+    std::unique_ptr<Tensor> scale_t(outputs[1]->ReleaseTensor());
+    std::unique_ptr<Tensor> steps_t(outputs[2]->ReleaseTensor());
+
+    LossScalingResult result;
+    for (int64_t i = 0; i < grad_t->NumElements(); ++i) {
+        result.grad.push_back(grad_t->Get<float>(i));
+    }
+    result.scale = scale_t->Get<float>(0);
+    result.good_steps = steps_t->Get<float>(0);
+    return result;
+}
+
+TEST(MixedPrecisionTest, LossScalingUnscales) {
+    chainerx::testing::ContextSession sess;
+
+    LossScalingResult r = RunLossScaling({2, 4}, 4, 3);
+    EXPECT_EQ(std::vector<float>({0.5, 1}), r.grad);
+    EXPECT_EQ(4, r.scale);
+    EXPECT_EQ(4, r.good_steps);
+}
+
+TEST(MixedPrecisionTest, LossScalingOverflow) {
+    chainerx::testing::ContextSession sess;
+
+    // The step is skipped with zero gradients and the scale is halved.
+    for (float bad : {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()}) {
+        LossScalingResult r = RunLossScaling({2, bad}, 1024, 10);
+        EXPECT_EQ(std::vector<float>({0, 0}), r.grad) << bad;
+        EXPECT_EQ(512, r.scale) << bad;
+        EXPECT_EQ(0, r.good_steps) << bad;
+    }
+}
+
+TEST(MixedPrecisionTest, LossScalingRegrowth) {
+    chainerx::testing::ContextSession sess;
+
+    // The scale is doubled after 2000 good steps.
+    LossScalingResult r = RunLossScaling({2, 4}, 512, 1998);
+    EXPECT_EQ(512, r.scale);
+    EXPECT_EQ(1999, r.good_steps);
+    r = RunLossScaling({2, 4}, 512, 1999);
+    EXPECT_EQ(1024, r.scale);
+    EXPECT_EQ(0, r.good_steps);
+    EXPECT_EQ(std::vector<float>({1.0f / 256, 1.0f / 128}), r.grad);
+}
+
+}  // namespace
+}  // namespace chainer_compiler
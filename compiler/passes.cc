@@ -14,8 +14,15 @@
 #include <compiler/gradient.h>
 #include <compiler/gradient_with_order.h>
 #include <compiler/graph.h>
+#include <compiler/if_conversion.h>
+#include <compiler/layout.h>
+#include <compiler/log.h>
+#include <compiler/loop_invariant.h>
+#include <compiler/loop_unroll.h>
 #include <compiler/memory_simulator.h>
 #include <compiler/merge.h>
+#include <compiler/micro_batch.h>
+#include <compiler/mixed_precision.h>
 #include <compiler/model.h>
 #include <compiler/quantize.h>
 #include <compiler/scheduler.h>
@@ -118,16 +125,42 @@ void RunDefaultPasses(Graph* graph, bool gen_backprop, bool skip_scheduling) {
 
         if (g_quantize) {
             QuantizationOptions q_opts;
+            if (!g_quantization_params.empty()) {
+                LoadQuantizationParams(g_quantization_params, &q_opts);
+            }
             Recursively([q_opts](Graph* graph) { Quantize(q_opts, graph); }, graph);
+            int num_eliminated = 0;
+            Recursively([&num_eliminated](Graph* graph) { num_eliminated += FuseQuantizedOps(graph); }, graph);
+            CLOG() << "Quantization: " << num_eliminated << " float tensors were eliminated" << std::endl;
+        }
+
+        if (g_unroll_loops_max_nodes > 0) {
+            UnrollLoops(graph, g_unroll_loops_max_nodes);
+        }
+
+        if (g_if_to_where_max_flops > 0 && !gen_backprop) {
+            ConvertIfToWhere(graph, g_if_to_where_max_flops);
+        }
+
+        if (g_mixed_precision) {
+            ConvertToMixedPrecision(graph);
         }
 
         Recursively(
                 [gen_backprop, &backend_config](Graph* graph) { MergeOperations(backend_config->GetMerge(), graph, gen_backprop); }, graph);
 
+        if (g_channels_last && !gen_backprop) {
+            Recursively(PropagateChannelsLast, graph);
+        }
+
         Recursively(PropagateConstants, graph);
 
         Recursively(EvaluateShapes, graph);
 
+        if (!gen_backprop) {
+            HoistLoopInvariants(graph);
+        }
+
         Recursively([](Graph* g) { g->DeleteDetached(); }, graph);
 
         dump_onnx(g_dump_after_simplification, "after simplification");
@@ -140,7 +173,14 @@ void RunDefaultPasses(Graph* graph, bool gen_backprop, bool skip_scheduling) {
 
         if (g_computation_order.empty()) {
             // normal computation order
-            AddGradientNodesForTraining(graph);
+            Value* loss_scale = g_mixed_precision ? AddLossScaleParam(graph) : nullptr;
+            AddGradientNodesForTraining(graph, loss_scale);
+            if (g_num_micro_batches > 1) {
+                SplitIntoMicroBatches(graph, g_num_micro_batches);
+            }
+            if (loss_scale) {
+                AddDynamicLossScaling(graph, loss_scale);
+            }
         } else {
             // specified computation order
             skip_scheduling = true;
@@ -210,4 +250,24 @@ void RunDefaultPassesBeforeGradient(Graph* graph) {
     Recursively(*backend_config, graph, CheckAllOpsSupported);
 }
 
+void RunCalibrationPasses(Graph* graph) {
+    std::unique_ptr<BackendConfig> backend_config(BackendConfig::FromName(g_backend_name));
+    if (!g_skip_inference) {
+        graph->InferShapes();
+        InferAllDtype(graph);
+    }
+    CanonicalizeSubGraphs(graph);
+    // Values at this point are the ones `Quantize` in
+    // `RunDefaultPasses` looks up. Passes which remove or rename
+    // values (e.g., MergeOperations and FuseOperations) must not run.
+    Recursively(*backend_config, graph, [](const BackendConfig& bc, Graph* graph) { Simplify(bc.GetSimplifyPreproc(), graph, false); });
+    Recursively(*backend_config, graph, [](const BackendConfig& bc, Graph* graph) { Simplify(bc.GetSimplify(), graph, false); });
+    Recursively(PropagateConstants, graph);
+    Recursively([](Graph* g) { g->DeleteDetached(); }, graph);
+    int64_t order = 0;
+    Recursively([&order](Graph* g) { order = ScheduleComputation(*g, order); }, graph);
+    Recursively(CollectGarbageNode, graph);
+    Recursively(*backend_config, graph, CheckAllOpsSupported);
+}
+
 }  // namespace chainer_compiler
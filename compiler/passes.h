@@ -16,4 +16,9 @@ void RunLoopBodyPasses(Node* loop, const std::vector<Node*>& refs);
 
 void RunDefaultPassesBeforeGradient(Graph* graph);
 
+// Prepares `graph` to observe ranges of values for static
+// quantization. Unlike `RunDefaultPasses`, values are kept as they
+// are when `Quantize` runs so calibrated parameters can be found.
+void RunCalibrationPasses(Graph* graph);
+
 }  // namespace chainer_compiler
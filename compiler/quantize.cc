@@ -1,10 +1,18 @@
 #include <compiler/quantize.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
 #include <chainerx/routines/creation.h>
 #include <chainerx/routines/manipulation.h>
 #include <chainerx/routines/statistics.h>
 #include <compiler/graph.h>
 #include <compiler/graph_builder.h>
+#include <compiler/log.h>
+#include <compiler/node.h>
+#include <compiler/tensor.h>
 #include <compiler/value.h>
 #include <runtime/chainerx_util.h>
 
@@ -130,7 +138,7 @@ QuantizedInput QuantizeWeightConvolution(const QuantizationContext& ctx, GraphBu
 
 QuantizedOutput QuantizeOutput(const QuantizationOptions& ctx, GraphBuilder* gb, Value* output) {
     auto it = ctx.output_quantization_params.find(output->name());
-    CHECK(it != ctx.output_quantization_params.end());
+    CHECK(it != ctx.output_quantization_params.end()) << "No quantization params for " << output->name();
 
     const QuantizationParams& param = it->second;
 
@@ -139,6 +147,45 @@ QuantizedOutput QuantizeOutput(const QuantizationOptions& ctx, GraphBuilder* gb,
     return {output, scale, zero_point, {}, {}};
 }
 
+// Static quantization needs the range of outputs, which can be
+// calculated only by calibration.
+bool HasOutputQuantizationParams(const QuantizationOptions& ctx, const Value* output) {
+    return ctx.output_quantization_params.count(output->name());
+}
+
+// Adds nodes which calculate the scale and the zero point from the
+// range of `input` at runtime.
+void QuantizeDynamically(GraphBuilder* gb, Value* input, Dtype qType, Value** scale, Value** zero_point) {
+    DataMode mode = ModeForDataType(qType);
+
+    Value* rmin = gb->Op(Node::kReduceMin, {input});
+    rmin->producer()->set_keepdims(0);
+    Value* rmax = gb->Op(Node::kReduceMax, {input});
+    rmax->producer()->set_keepdims(0);
+
+    Value* fixed_qrange_scaled = gb->Const(runtime::MakeScalarArray(QRangeForQtype(qType)));
+
+    if (mode == DataMode::Linear_Scaled) {
+        Value* abs_rmin = gb->Op(Node::kAbs, {rmin});
+        Value* abs_rmax = gb->Op(Node::kAbs, {rmax});
+        Value* abs_max = gb->Op(Node::kMax, {abs_rmin, abs_rmax});
+        *scale = gb->Op(Node::kDiv, {abs_max, fixed_qrange_scaled});
+
+        *zero_point = gb->Const(runtime::MakeScalarArray(0.f).AsType(qType.chx()));
+    } else {
+        CHECK_EQ(DataMode::Linear_NonScaled, mode);
+
+        Value* scale_sub = gb->Op(Node::kSub, {rmax, rmin});
+        *scale = gb->Op(Node::kDiv, {scale_sub, fixed_qrange_scaled});
+
+        Value* zp_sub = gb->Op(Node::kSub, {gb->Const(runtime::MakeScalarArray(0.f)), rmin});
+        Value* zp_div = gb->Op(Node::kDiv, {zp_sub, *scale});
+        Value* zp_floor = gb->Op(Node::kFloor, {zp_div});
+        *zero_point = gb->Op(Node::kCast, {zp_floor});
+        (*zero_point)->producer()->set_to(qType);
+    }
+}
+
 std::vector<QuantizedInput> QuantizeInputs(
         const QuantizationContext& ctx, GraphBuilder* gb, Node* node, const std::vector<int64_t>& indices, int64_t weight_index) {
     CHECK(node->op_type() == Node::kConv || node->op_type() == Node::kMatMul);
@@ -163,42 +210,16 @@ std::vector<QuantizedInput> QuantizeInputs(
             // Add QuantizeLiner
             Value* scale;
             Value* zero_point;
-            if (ctx.is_static) {
-                auto it = ctx.input_quantization_params.find(node_input->name());
-                CHECK(it != ctx.input_quantization_params.end());
+            auto it = ctx.input_quantization_params.find(node_input->name());
+            if (ctx.is_static && it != ctx.input_quantization_params.end()) {
                 const QuantizationParams& param = it->second;
                 scale = gb->Const(runtime::MakeScalarArray(param.scale));
                 zero_point = gb->Const(runtime::MakeDtypeScalarArray(qType.chx(), param.zero_point));
             } else {
-                // Graph for dynamic quantize parameter
-                DataMode mode = ModeForDataType(qType);
-
-                Value* rmin = gb->Op(Node::kReduceMin, {node_input});
-                rmin->producer()->set_keepdims(0);
-                Value* rmax = gb->Op(Node::kReduceMax, {node_input});
-                rmax->producer()->set_keepdims(0);
-
-                Value* fixed_qrange_scaled = gb->Const(runtime::MakeScalarArray(QRangeForQtype(qType)));
-
-                if (mode == DataMode::Linear_Scaled) {
-                    Value* abs_rmin = gb->Op(Node::kAbs, {rmin});
-                    Value* abs_rmax = gb->Op(Node::kAbs, {rmax});
-                    Value* abs_max = gb->Op(Node::kMax, {abs_rmin, abs_rmax});
-                    scale = gb->Op(Node::kDiv, {abs_max, fixed_qrange_scaled});
-
-                    zero_point = gb->Const(runtime::MakeScalarArray(0.f).AsType(qType.chx()));
-                } else {
-                    CHECK_EQ(DataMode::Linear_NonScaled, mode);
-
-                    Value* scale_sub = gb->Op(Node::kSub, {rmax, rmin});
-                    scale = gb->Op(Node::kDiv, {scale_sub, fixed_qrange_scaled});
-
-                    Value* zp_sub = gb->Op(Node::kSub, {gb->Const(runtime::MakeScalarArray(0.f)), rmin});
-                    Value* zp_div = gb->Op(Node::kDiv, {zp_sub, scale});
-                    Value* zp_floor = gb->Op(Node::kFloor, {zp_div});
-                    zero_point = gb->Op(Node::kCast, {zp_floor});
-                    zero_point->producer()->set_to(qType);
+                if (ctx.is_static) {
+                    CLOG() << "Quantize " << node_input->name() << " dynamically as it was not calibrated" << std::endl;
                 }
+                QuantizeDynamically(gb, node_input, qType, &scale, &zero_point);
             }
 
             Value* qlinear_out = gb->Op(Node::kQuantizeLinear, {node_input, scale, zero_point});
@@ -353,6 +374,10 @@ bool QuantizeConvolution(const QuantizationContext& ctx, Node* conv) {
     }
 
     CHECK_EQ(QuantizationMode::QLinearOps, ctx.mode);
+    if (!HasOutputQuantizationParams(ctx, conv->output(0))) {
+        CLOG() << "Quantize " << conv->output(0)->name() << " with integer ops as it was not calibrated" << std::endl;
+        return QuantizeConvolutionInteger(ctx, conv);
+    }
     return QuantizeConvolutionQLinear(ctx, conv);
 }
 
@@ -364,6 +389,10 @@ bool QuantizeMatMul(const QuantizationContext& ctx, Node* matmul) {
     }
 
     CHECK_EQ(QuantizationMode::QLinearOps, ctx.mode);
+    if (!HasOutputQuantizationParams(ctx, matmul->output(0))) {
+        CLOG() << "Quantize " << matmul->output(0)->name() << " with integer ops as it was not calibrated" << std::endl;
+        return QuantizeMatMulInteger(ctx, matmul);
+    }
     return QuantizeMatMulQLinear(ctx, matmul);
 }
 
@@ -392,8 +421,150 @@ bool QuantizeModel(const QuantizationContext& ctx) {
     return result;
 }
 
+// Scale and zero point of QuantizeLinear or DequantizeLinear.
+struct LinearQuantization {
+    double scale;
+    double zero_point;
+    Dtype dtype;
+};
+
+bool GetScalarConst(const Value* value, double* out) {
+    const Tensor* tensor = value->GetConstTensor();
+    if (!tensor || tensor->NumElements() != 1) {
+        return false;
+    }
+    *out = static_cast<double>(chainerx::AsScalar(tensor->chx().Reshape({})));
+    return true;
+}
+
+bool GetLinearQuantization(const Node& node, LinearQuantization* q) {
+    if (node.inputs().size() != 3) {
+        return false;
+    }
+    q->dtype = node.input(2)->type().dtype();
+    return GetScalarConst(node.input(1), &q->scale) && GetScalarConst(node.input(2), &q->zero_point);
+}
+
+bool FuseDequantizeQuantize(Graph* graph, Node* quantize, int* num_eliminated) {
+    LinearQuantization q_params;
+    if (!GetLinearQuantization(*quantize, &q_params)) {
+        return false;
+    }
+
+    // Walk up Relu and Clip between DequantizeLinear and QuantizeLinear.
+    std::vector<Node*> chain = {quantize};
+    double lower = -std::numeric_limits<double>::infinity();
+    double upper = std::numeric_limits<double>::infinity();
+    Node* node = quantize->input(0)->producer();
+    while (node && (node->op_type() == Node::kRelu || node->op_type() == Node::kClip)) {
+        if (node->op_type() == Node::kRelu) {
+            lower = std::max(lower, 0.0);
+        } else {
+            if (node->inputs().size() != 1) {
+                return false;
+            }
+            lower = std::max<double>(lower, node->min());
+            upper = std::min<double>(upper, node->max());
+        }
+        chain.push_back(node);
+        node = node->input(0)->producer();
+    }
+    if (!node || node->op_type() != Node::kDequantizeLinear) {
+        return false;
+    }
+    Node* dequantize = node;
+    chain.push_back(dequantize);
+    LinearQuantization dq_params;
+    if (!GetLinearQuantization(*dequantize, &dq_params) || dq_params.dtype != q_params.dtype) {
+        return false;
+    }
+
+    // The activations are no-ops if the range of quantized values is
+    // within their range.
+    double qmin, qmax;
+    if (q_params.dtype == Dtype::kUInt8) {
+        qmin = std::numeric_limits<uint8_t>::min();
+        qmax = std::numeric_limits<uint8_t>::max();
+    } else if (q_params.dtype == Dtype::kInt8) {
+        qmin = std::numeric_limits<int8_t>::min();
+        qmax = std::numeric_limits<int8_t>::max();
+    } else {
+        return false;
+    }
+    if (q_params.scale * (qmin - q_params.zero_point) < lower || q_params.scale * (qmax - q_params.zero_point) > upper) {
+        return false;
+    }
+
+    // Values which are used only by the chain will be dead.
+    auto count_eliminated = [&chain]() {
+        int num = 0;
+        for (size_t i = 1; i < chain.size(); ++i) {
+            if (chain[i]->output(0)->users().size() != 1 || chain[i]->output(0)->IsOutput()) break;
+            ++num;
+        }
+        return num;
+    };
+
+    Value* quantized = dequantize->input(0);
+    if (q_params.scale == dq_params.scale && q_params.zero_point == dq_params.zero_point) {
+        *num_eliminated += count_eliminated();
+        GraphBuilder gb(graph, "FuseQuantizedOps", quantize->output(0));
+        gb.Op(Node::kIdentity, {quantized}, quantize->output(0));
+        graph->DetachNode(quantize);
+        return true;
+    }
+
+    // Requantize the output of the preceding op with the parameters
+    // of QuantizeLinear. This is possible only when nobody else sees
+    // the original output.
+    Node* producer = quantized->producer();
+    if (!producer || (producer->op_type() != Node::kQLinearConv && producer->op_type() != Node::kQLinearMatMul) ||
+        quantized->users().size() != 1 || quantized->IsOutput()) {
+        return false;
+    }
+    for (size_t i = 1; i < chain.size(); ++i) {
+        if (chain[i]->output(0)->users().size() != 1 || chain[i]->output(0)->IsOutput()) {
+            return false;
+        }
+    }
+    *num_eliminated += count_eliminated();
+
+    GraphBuilder gb(graph, "FuseQuantizedOps", quantize->output(0));
+    std::vector<Value*> inputs = producer->inputs();
+    inputs[6] = quantize->input(1);
+    inputs[7] = quantize->input(2);
+    Node* fused = gb.MOp(producer->op_type(), inputs, {quantize->output(0)});
+    if (producer->op_type() == Node::kQLinearConv) {
+        fused->set_dilations(producer->dilations())
+                ->set_group(producer->group())
+                ->set_kernel_shape(producer->kernel_shape())
+                ->set_strides(producer->strides())
+                ->set_auto_pad(producer->auto_pad())
+                ->set_pads(producer->pads());
+    }
+    graph->DetachNode(producer);
+    for (Node* chained : chain) {
+        graph->DetachNode(chained);
+    }
+    return true;
+}
+
 }  // namespace
 
+int FuseQuantizedOps(Graph* graph) {
+    int num_eliminated = 0;
+    bool replaced = true;
+    while (replaced) {
+        replaced = false;
+        for (Node* node : graph->GetLiveNodes()) {
+            if (node->op_type() == Node::kQuantizeLinear && FuseDequantizeQuantize(graph, node, &num_eliminated)) {
+                replaced = true;
+            }
+        }
+    }
+    return num_eliminated;
+}
+
 bool Quantize(const QuantizationOptions& opts, Graph* graph) {
     CHECK_EQ(8, opts.nbits);
     CHECK_EQ(QuantizationMethod::OnnxRuntime, opts.method);
@@ -405,6 +576,39 @@ bool Quantize(const QuantizationOptions& opts, Graph* graph) {
     return QuantizeModel(ctx);
 }
 
+QuantizationParams CalculateQuantizationParams(float rmin, float rmax, Dtype dtype) {
+    CHECK_EQ(Dtype::kUInt8, dtype) << "Only uint8 is supported for activations";
+    rmin = std::min(rmin, 0.f);
+    rmax = std::max(rmax, 0.f);
+    const float scale = rmin != rmax ? (rmax - rmin) / QRangeForQtype(dtype) : 1.f;
+    const float zero_point = std::rint((0 - rmin) / scale);
+    return {dtype, zero_point, scale};
+}
+
+void LoadQuantizationParams(const std::string& filename, QuantizationOptions* opts) {
+    std::ifstream ifs(filename);
+    CHECK(ifs) << "Failed to open quantization params: " << filename;
+    std::string name;
+    float zero_point, scale;
+    while (ifs >> name >> zero_point >> scale) {
+        const QuantizationParams params{Dtype::kUInt8, zero_point, scale};
+        opts->input_quantization_params[name] = params;
+        opts->output_quantization_params[name] = params;
+    }
+    opts->is_static = true;
+    opts->mode = QuantizationMode::QLinearOps;
+}
+
+void SaveQuantizationParams(const std::string& filename, const std::map<std::string, QuantizationParams>& params) {
+    std::ofstream ofs(filename);
+    CHECK(ofs) << "Failed to open output quantization params: " << filename;
+    // Keep enough digits so scales are restored exactly.
+    ofs << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for (const auto& p : params) {
+        ofs << p.first << ' ' << p.second.zero_point << ' ' << p.second.scale << '\n';
+    }
+}
+
 std::ostream& operator<<(std::ostream& os, QuantizationMode mode) {
     switch (mode) {
         case QuantizationMode::IntegerOps:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <unordered_map>
 
@@ -42,6 +43,28 @@ struct QuantizationOptions {
 
 bool Quantize(const QuantizationOptions& opts, Graph* graph);
 
+// Removes DequantizeLinear -> QuantizeLinear round trips so quantized
+// ops consume the outputs of preceding quantized ops directly. Relu
+// and Clip between them are folded into the saturation of the
+// requantization when the quantized range does not exceed theirs.
+// When the scale or the zero point of the pair differ, the output of
+// the preceding QLinearConv or QLinearMatMul is requantized with the
+// parameters of QuantizeLinear instead. Returns the number of float
+// tensors eliminated.
+int FuseQuantizedOps(Graph* graph);
+
+// Calculates asymmetric quantization parameters which cover the
+// range [rmin, rmax] observed during calibration.
+QuantizationParams CalculateQuantizationParams(float rmin, float rmax, Dtype dtype = Dtype::kUInt8);
+
+// Loads static quantization parameters generated by calibration
+// (e.g., run_onnx --calibrate_quantization) into `opts`. Each line of
+// the file consists of a value name, a zero point, and a scale.
+void LoadQuantizationParams(const std::string& filename, QuantizationOptions* opts);
+
+// Writes `params` in the format read by `LoadQuantizationParams`.
+void SaveQuantizationParams(const std::string& filename, const std::map<std::string, QuantizationParams>& params);
+
 std::ostream& operator<<(std::ostream& os, QuantizationMode mode);
 std::ostream& operator<<(std::ostream& os, QuantizationMethod meth);
 
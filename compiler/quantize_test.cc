@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <chainerx/testing/context_session.h>
+
+#include <compiler/evaluator.h>
+#include <compiler/flags.h>
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/node.h>
+#include <compiler/passes.h>
+#include <compiler/quantize.h>
+#include <compiler/tensor.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+TEST(QuantizeTest, FuseDequantizeReluQuantize) {
+    chainerx::testing::ContextSession sess;
+
+    Graph graph("test");
+    Value* input = graph.AddInputValue("input", Type(Dtype::kUInt8, {2, 3}));
+    Value* output = graph.AddOutputValue("output", Type(Dtype::kUInt8, {2, 3}));
+    {
+        GraphBuilder gb(&graph, "test", input);
+        Value* scale = gb.Const(Type(Dtype::kFloat32, {}), {0.5});
+        Value* zero_point = gb.Const(Type(Dtype::kUInt8, {}), {0});
+        Value* x = gb.Op(Node::kDequantizeLinear, {input, scale, zero_point});
+        x = gb.Op(Node::kRelu, {x});
+        gb.Op(Node::kQuantizeLinear, {x, scale, zero_point}, output);
+    }
+
+    EXPECT_EQ(2, FuseQuantizedOps(&graph));
+    EXPECT_EQ(Node::kIdentity, output->producer()->op_type());
+    EXPECT_EQ(input, output->producer()->input(0));
+}
+
+TEST(QuantizeTest, DoNotFuseReluWithNonZeroMinimum) {
+    chainerx::testing::ContextSession sess;
+
+    Graph graph("test");
+    Value* input = graph.AddInputValue("input", Type(Dtype::kUInt8, {2, 3}));
+    Value* output = graph.AddOutputValue("output", Type(Dtype::kUInt8, {2, 3}));
+    {
+        GraphBuilder gb(&graph, "test", input);
+        Value* scale = gb.Const(Type(Dtype::kFloat32, {}), {0.5});
+        Value* zero_point = gb.Const(Type(Dtype::kUInt8, {}), {128});
+        Value* x = gb.Op(Node::kDequantizeLinear, {input, scale, zero_point});
+        x = gb.Op(Node::kRelu, {x});
+        gb.Op(Node::kQuantizeLinear, {x, scale, zero_point}, output);
+    }
+
+    EXPECT_EQ(0, FuseQuantizedOps(&graph));
+    EXPECT_EQ(Node::kQuantizeLinear, output->producer()->op_type());
+}
+
+TEST(QuantizeTest, RequantizeQLinearMatMul) {
+    chainerx::testing::ContextSession sess;
+
+    Graph graph("test");
+    Value* a = graph.AddInputValue("a", Type(Dtype::kUInt8, {2, 3}));
+    Value* b = graph.AddInputValue("b", Type(Dtype::kUInt8, {3, 4}));
+    Value* output = graph.AddOutputValue("output", Type(Dtype::kUInt8, {2, 4}));
+    Value* new_scale;
+    Value* new_zero_point;
+    {
+        GraphBuilder gb(&graph, "test", a);
+        Value* scale = gb.Const(Type(Dtype::kFloat32, {}), {0.5});
+        Value* zero_point = gb.Const(Type(Dtype::kUInt8, {}), {128});
+        new_scale = gb.Const(Type(Dtype::kFloat32, {}), {0.25});
+        new_zero_point = gb.Const(Type(Dtype::kUInt8, {}), {0});
+        Value* y = gb.Op(Node::kQLinearMatMul, {a, scale, zero_point, b, scale, zero_point, scale, zero_point});
+        Value* x = gb.Op(Node::kDequantizeLinear, {y, scale, zero_point});
+        x = gb.Op(Node::kRelu, {x});
+        gb.Op(Node::kQuantizeLinear, {x, new_scale, new_zero_point}, output);
+    }
+
+    EXPECT_EQ(2, FuseQuantizedOps(&graph));
+    const Node& node = *output->producer();
+    EXPECT_EQ(Node::kQLinearMatMul, node.op_type());
+    EXPECT_EQ(a, node.input(0));
+    EXPECT_EQ(new_scale, node.input(6));
+    EXPECT_EQ(new_zero_point, node.input(7));
+    graph.DeleteDetached();
+    graph.CheckSanity("fused");
+}
+
+// Returns the quantized value of `x` before saturation.
+float QuantizeValue(const QuantizationParams& params, float x) {
+    return std::rint(x / params.scale) + params.zero_point;
+}
+
+TEST(QuantizeTest, CalculateAsymmetricParams) {
+    const QuantizationParams params = CalculateQuantizationParams(-1.f, 3.f);
+    EXPECT_EQ(Dtype::kUInt8, params.zero_point_dtype);
+    EXPECT_FLOAT_EQ(4.f / 255, params.scale);
+    EXPECT_EQ(64, params.zero_point);
+    EXPECT_EQ(0, QuantizeValue(params, -1.f));
+    EXPECT_EQ(255, QuantizeValue(params, 3.f));
+    EXPECT_EQ(params.zero_point, QuantizeValue(params, 0.f));
+}
+
+TEST(QuantizeTest, CalculateParamsForRangesWithoutZero) {
+    // The range is extended so 0 is representable exactly.
+    const QuantizationParams positive = CalculateQuantizationParams(2.f, 6.f);
+    EXPECT_FLOAT_EQ(6.f / 255, positive.scale);
+    EXPECT_EQ(0, positive.zero_point);
+    EXPECT_EQ(255, QuantizeValue(positive, 6.f));
+
+    const QuantizationParams negative = CalculateQuantizationParams(-6.f, -2.f);
+    EXPECT_FLOAT_EQ(6.f / 255, negative.scale);
+    EXPECT_EQ(255, negative.zero_point);
+    EXPECT_EQ(0, QuantizeValue(negative, -6.f));
+
+    const QuantizationParams zero = CalculateQuantizationParams(0.f, 0.f);
+    EXPECT_EQ(1.f, zero.scale);
+    EXPECT_EQ(0, zero.zero_point);
+}
+
+TEST(QuantizeTest, SaveAndLoadParams) {
+    const std::string filename = ::testing::TempDir() + "quantize_test_params.txt";
+    std::map<std::string, QuantizationParams> params;
+    params.emplace("x", CalculateQuantizationParams(-1.f, 3.f));
+    params.emplace("y", CalculateQuantizationParams(0.1f, 0.7f));
+    SaveQuantizationParams(filename, params);
+
+    QuantizationOptions opts;
+    LoadQuantizationParams(filename, &opts);
+    std::remove(filename.c_str());
+    EXPECT_TRUE(opts.is_static);
+    EXPECT_EQ(QuantizationMode::QLinearOps, opts.mode);
+    ASSERT_EQ(2UL, opts.input_quantization_params.size());
+    ASSERT_EQ(2UL, opts.output_quantization_params.size());
+    for (const auto& p : params) {
+        const QuantizationParams& loaded = opts.input_quantization_params.at(p.first);
+        EXPECT_EQ(Dtype::kUInt8, loaded.zero_point_dtype);
+        EXPECT_EQ(p.second.zero_point, loaded.zero_point);
+        // Scales must be restored exactly.
+        EXPECT_EQ(p.second.scale, loaded.scale);
+        EXPECT_EQ(p.second.scale, opts.output_quantization_params.at(p.first).scale);
+    }
+}
+
+// Builds Conv followed by BatchNormalization, which is merged into
+// the Conv by `RunDefaultPasses` unless the Conv is quantized.
+void MakeConvBN(Graph* graph) {
+    Value* input = graph->AddInputValue("input", Type(Dtype::kFloat32, {1, 2, 4, 4}));
+    Value* output = graph->AddOutputValue("output", Type(Dtype::kFloat32, {1, 3, 4, 4}));
+    Value* conv_out = graph->AddValue("conv_out");
+
+    std::vector<float> w;
+    for (int i = 0; i < 3 * 2 * 3 * 3; ++i) {
+        w.push_back((i % 5 - 2) / 10.f);
+    }
+
+    GraphBuilder gb(graph, "test", input);
+    gb.Op(Node::kConv, {input, gb.Const(Type(Dtype::kFloat32, {3, 2, 3, 3}), w)}, conv_out)
+            ->producer()
+            ->set_kernel_shape({3, 3})
+            ->set_pads({1, 1, 1, 1});
+    const Type param_type(Dtype::kFloat32, {3});
+    gb.Op(Node::kBatchNormalization,
+          {conv_out,
+           gb.Const(param_type, {1.5, 0.5, 1.0}),
+           gb.Const(param_type, {0.1, -0.2, 0.3}),
+           gb.Const(param_type, {0.05, 0.0, -0.05}),
+           gb.Const(param_type, {1.0, 2.0, 0.5})},
+          output);
+}
+
+// Runs `graph` for `input` and returns `fetches`.
+std::vector<std::unique_ptr<Tensor>> RunGraph(const Graph& graph, Tensor* input, const std::vector<Value*>& fetches) {
+    CHECK_EQ(1, graph.input_values().size());
+    std::vector<std::unique_ptr<EvaluatedValue>> outputs;
+    Eval(graph.GetTopologicallySortedNodes(), {{graph.input_values()[0], input}}, fetches, &outputs);
+    std::vector<std::unique_ptr<Tensor>> tensors;
+    for (const std::unique_ptr<EvaluatedValue>& output : outputs) {
+        tensors.emplace_back(output->ReleaseTensor());
+    }
+    return tensors;
+}
+
+TEST(QuantizeTest, CalibrateAndQuantizeConvBN) {
+    chainerx::testing::ContextSession sess;
+
+    std::vector<float> x;
+    for (int i = 0; i < 2 * 4 * 4; ++i) {
+        x.push_back((i % 7) / 7.f);
+    }
+    Tensor input("input", Dtype::kFloat32, {1, 2, 4, 4}, x);
+
+    // Observe ranges of values as run_onnx --calibrate_quantization.
+    Graph calib_graph("calib");
+    MakeConvBN(&calib_graph);
+    RunCalibrationPasses(&calib_graph);
+    std::vector<Value*> fetches;
+    for (Node* node : calib_graph.GetTopologicallySortedNodes()) {
+        if (node->op_type() == Node::kConstant) {
+            continue;
+        }
+        for (Value* value : node->outputs()) {
+            if (!value->IsNull() && value->type().dtype() == Dtype::kFloat32) {
+                fetches.push_back(value);
+            }
+        }
+    }
+    std::vector<std::unique_ptr<Tensor>> observed = RunGraph(calib_graph, &input, fetches);
+
+    std::map<std::string, QuantizationParams> params;
+    params.emplace("input", CalculateQuantizationParams(*std::min_element(x.begin(), x.end()), *std::max_element(x.begin(), x.end())));
+    std::vector<float> expected;
+    for (size_t i = 0; i < fetches.size(); ++i) {
+        const chainerx::Array& a = observed[i]->chx();
+        const float rmin = static_cast<float>(chainerx::AsScalar(a.Min()));
+        const float rmax = static_cast<float>(chainerx::AsScalar(a.Max()));
+        params.emplace(fetches[i]->name(), CalculateQuantizationParams(rmin, rmax));
+        if (fetches[i]->IsOutput()) {
+            for (int64_t j = 0; j < observed[i]->NumElements(); ++j) {
+                expected.push_back(observed[i]->Get<float>(j));
+            }
+        }
+    }
+    // The output of Conv is lost once it is merged with BN.
+    ASSERT_TRUE(params.count("conv_out"));
+    ASSERT_FALSE(expected.empty());
+
+    const std::string filename = ::testing::TempDir() + "quantize_test_conv_bn_params.txt";
+    SaveQuantizationParams(filename, params);
+
+    Graph graph("quantized");
+    MakeConvBN(&graph);
+    g_quantize = true;
+    g_quantization_params = filename;
+    RunDefaultPasses(&graph);
+    g_quantize = false;
+    g_quantization_params.clear();
+    std::remove(filename.c_str());
+
+    int num_qlinear_convs = 0;
+    for (Node* node : graph.GetLiveNodes()) {
+        EXPECT_NE(Node::kConvInteger, node->op_type());
+        num_qlinear_convs += node->op_type() == Node::kQLinearConv;
+    }
+    EXPECT_EQ(1, num_qlinear_convs);
+
+    std::vector<std::unique_ptr<Tensor>> actual = RunGraph(graph, &input, {graph.output_values()[0]});
+    ASSERT_EQ(static_cast<int64_t>(expected.size()), actual[0]->NumElements());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], actual[0]->Get<float>(i), 0.1) << i;
+    }
+}
+
+TEST(QuantizeTest, QuantizeDynamicallyWithoutParams) {
+    chainerx::testing::ContextSession sess;
+
+    const std::string filename = ::testing::TempDir() + "quantize_test_empty_params.txt";
+    SaveQuantizationParams(filename, {});
+    QuantizationOptions opts;
+    LoadQuantizationParams(filename, &opts);
+    std::remove(filename.c_str());
+
+    Graph graph("test");
+    MakeConvBN(&graph);
+    graph.InferShapes();
+    EXPECT_TRUE(Quantize(opts, &graph));
+    graph.DeleteDetached();
+
+    // Neither the input nor the output was calibrated.
+    std::map<Node::OpType, int> ops;
+    for (Node* node : graph.nodes()) {
+        ++ops[node->op_type()];
+    }
+    EXPECT_EQ(1, ops[Node::kConvInteger]);
+    EXPECT_EQ(0, ops[Node::kQLinearConv]);
+    EXPECT_EQ(1, ops[Node::kReduceMin]);
+    graph.CheckSanity("quantized");
+}
+
+}  // namespace
+}  // namespace chainer_compiler
@@ -0,0 +1,200 @@
+#include "compiler/speculation.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <compiler/node.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+
+namespace {
+
+bool IsConstant(const Value* value) {
+    return value->initializer() || (value->producer() && value->producer()->op_type() == Node::kConstant);
+}
+
+// Returns the dims of `value` or nullptr if they are unknown.
+const std::vector<int64_t>* GetKnownDims(const Value* value) {
+    const Type& type = value->type();
+    if (type.kind() != Type::Kind::kTensor || !type.HasKnownShape()) {
+        return nullptr;
+    }
+    return &type.dims();
+}
+
+// Returns true if `dims_list` are known to be broadcastable to each
+// other by numpy's rule.
+bool AreBroadcastable(const std::vector<std::vector<int64_t>>& dims_list) {
+    std::vector<int64_t> result;
+    for (const std::vector<int64_t>& dims : dims_list) {
+        if (result.size() < dims.size()) result.insert(result.begin(), dims.size() - result.size(), 1);
+        for (size_t i = 0; i < dims.size(); ++i) {
+            int64_t& r = result[result.size() - dims.size() + i];
+            const int64_t d = dims[i];
+            if (r == 1) {
+                r = d;
+            } else if (d != 1 && d != r) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool AreInputsBroadcastable(const Node& node) {
+    std::vector<std::vector<int64_t>> dims_list;
+    for (const Value* input : node.inputs()) {
+        if (input->IsNull()) continue;
+        const std::vector<int64_t>* dims = GetKnownDims(input);
+        if (!dims) return false;
+        dims_list.push_back(*dims);
+    }
+    return AreBroadcastable(dims_list);
+}
+
+bool IsValidMatMul(const Node& node) {
+    const std::vector<int64_t>* a = GetKnownDims(node.input(0));
+    const std::vector<int64_t>* b = GetKnownDims(node.input(1));
+    if (!a || !b || a->empty() || b->empty()) {
+        return false;
+    }
+    const int64_t k = b->size() == 1 ? (*b)[0] : (*b)[b->size() - 2];
+    if (a->back() != k) {
+        return false;
+    }
+    // Batch dimensions.
+    std::vector<int64_t> ab(a->begin(), a->end() - std::min<size_t>(a->size(), 2));
+    std::vector<int64_t> bb(b->begin(), b->end() - std::min<size_t>(b->size(), 2));
+    return AreBroadcastable({ab, bb});
+}
+
+bool IsValidGemm(const Node& node) {
+    const std::vector<int64_t>* a = GetKnownDims(node.input(0));
+    const std::vector<int64_t>* b = GetKnownDims(node.input(1));
+    if (!a || !b || a->size() != 2 || b->size() != 2) {
+        return false;
+    }
+    const int64_t m = (*a)[node.trans_a() ? 1 : 0];
+    const int64_t ka = (*a)[node.trans_a() ? 0 : 1];
+    const int64_t kb = (*b)[node.trans_b() ? 1 : 0];
+    const int64_t n = (*b)[node.trans_b() ? 0 : 1];
+    if (ka != kb) {
+        return false;
+    }
+    if (node.input(2)->IsNull()) {
+        return true;
+    }
+    // C is broadcast to (M, N) but the output is never larger.
+    const std::vector<int64_t>* c = GetKnownDims(node.input(2));
+    if (!c || c->size() > 2) {
+        return false;
+    }
+    const int64_t y[] = {n, m};
+    for (size_t i = 0; i < c->size(); ++i) {
+        const int64_t d = (*c)[c->size() - i - 1];
+        if (d != 1 && d != y[i]) return false;
+    }
+    return true;
+}
+
+bool IsValidConcat(const Node& node) {
+    const std::vector<int64_t>* first = nullptr;
+    for (const Value* input : node.inputs()) {
+        const std::vector<int64_t>* dims = GetKnownDims(input);
+        if (!dims) return false;
+        if (!first) first = dims;
+        if (dims->size() != first->size()) return false;
+        const int64_t ndim = dims->size();
+        const int64_t axis = node.axis() < 0 ? node.axis() + ndim : node.axis();
+        if (axis < 0 || axis >= ndim) return false;
+        for (int64_t i = 0; i < ndim; ++i) {
+            if (i != axis && (*dims)[i] != (*first)[i]) return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+bool IsPure(const Node& node) {
+    if (!node.GetSubGraphs().empty()) {
+        return false;
+    }
+
+    switch (node.op_type()) {
+        // Random.
+        case Node::kDropout:
+        case Node::kRandomNormal:
+        case Node::kRandomUniform:
+        case Node::kRandomNormalLike:
+        case Node::kRandomUniformLike:
+        case Node::kMultinomial:
+        // Having side effects.
+        case Node::kChainerPrint:
+        case Node::kChainerDoSomething:
+            return false;
+        default:
+            return true;
+    }
+}
+
+bool MayFail(const Node& node) {
+    switch (node.op_type()) {
+        // Integer division by zero.
+        case Node::kDiv:
+            if (!node.output(0)->type().dtype().IsFloat()) return true;
+            return !AreInputsBroadcastable(node);
+        // Out-of-range indices.
+        case Node::kGather:
+        case Node::kOneHot:
+        case Node::kChainerGetItem:
+        case Node::kChainerSelectItem:
+            return true;
+        // Shapes or indices which may be incompatible with the data.
+        case Node::kReshape:
+        case Node::kExpand:
+        case Node::kSlice:
+        case Node::kDynamicSlice:
+        case Node::kConstantOfShape:
+            for (size_t i = node.op_type() == Node::kConstantOfShape ? 0 : 1; i < node.inputs().size(); ++i) {
+                const Value* input = node.input(i);
+                if (!input->IsNull() && !IsConstant(input)) return true;
+            }
+            return false;
+        // Shapes which may not be broadcastable.
+        case Node::kAdd:
+        case Node::kSub:
+        case Node::kMul:
+        case Node::kPow:
+        case Node::kEqual:
+        case Node::kGreater:
+        case Node::kLess:
+        case Node::kAnd:
+        case Node::kOr:
+        case Node::kXor:
+        case Node::kBitShift:
+        case Node::kSum:
+        case Node::kMean:
+        case Node::kMax:
+        case Node::kMin:
+        case Node::kWhere:
+            return !AreInputsBroadcastable(node);
+        // Shapes which may not match.
+        case Node::kMatMul:
+            return !IsValidMatMul(node);
+        case Node::kGemm:
+            return !IsValidGemm(node);
+        case Node::kConcat:
+            return !IsValidConcat(node);
+        default:
+            return false;
+    }
+}
+
+bool CanBeSpeculated(const Node& node) {
+    return IsPure(node) && !MayFail(node);
+}
+
+}  // namespace chainer_compiler
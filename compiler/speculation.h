@@ -0,0 +1,21 @@
+#pragma once
+
+namespace chainer_compiler {
+
+class Node;
+
+// Returns true if `node` is deterministic and has no side effects so
+// it gives the same result however many times it runs.
+bool IsPure(const Node& node);
+
+// Returns true if `node` may fail for some values or shapes of its
+// inputs, e.g., integer division by zero or MatMul of incompatible
+// shapes. Shapes are checked only by the inferred types.
+bool MayFail(const Node& node);
+
+// Returns true if `node` can run even when the original program would
+// not run it, e.g., in the untaken branch of If or before a Loop which
+// runs no iteration.
+bool CanBeSpeculated(const Node& node);
+
+}  // namespace chainer_compiler
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <compiler/graph.h>
+#include <compiler/graph_builder.h>
+#include <compiler/node.h>
+#include <compiler/speculation.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+
+namespace chainer_compiler {
+namespace {
+
+TEST(SpeculationTest, Random) {
+    Graph graph("test");
+    Value* x = graph.AddInputValue("x", Type(Dtype::kFloat32, {2, 3}));
+    GraphBuilder gb(&graph, "test", x);
+    for (Node::OpType op_type : {Node::kDropout, Node::kRandomNormalLike, Node::kRandomUniformLike, Node::kMultinomial}) {
+        const Node& node = *gb.Op(op_type, {x})->producer();
+        EXPECT_FALSE(IsPure(node)) << node.ToString();
+        EXPECT_FALSE(CanBeSpeculated(node)) << node.ToString();
+    }
+    for (Node::OpType op_type : {Node::kRandomNormal, Node::kRandomUniform}) {
+        const Node& node = *gb.Op(op_type, {})->producer();
+        EXPECT_FALSE(CanBeSpeculated(node)) << node.ToString();
+    }
+    EXPECT_TRUE(CanBeSpeculated(*gb.Op(Node::kRelu, {x})->producer()));
+}
+
+TEST(SpeculationTest, Broadcast) {
+    Graph graph("test");
+    Value* x = graph.AddInputValue("x", Type(Dtype::kFloat32, {2, 3}));
+    Value* row = graph.AddInputValue("row", Type(Dtype::kFloat32, {3}));
+    Value* col = graph.AddInputValue("col", Type(Dtype::kFloat32, {2, 1}));
+    Value* bad = graph.AddInputValue("bad", Type(Dtype::kFloat32, {2}));
+    Value* unknown = graph.AddInputValue("unknown", Type(Dtype::kFloat32));
+    GraphBuilder gb(&graph, "test", x);
+
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kAdd, {x, row})->producer()));
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kMul, {row, col})->producer()));
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kSum, {x, row, col})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kAdd, {x, bad})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kSub, {x, unknown})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kMax, {x, row, bad})->producer()));
+
+    Value* fdiv = graph.AddValue("fdiv", Type(Dtype::kFloat32, {2, 3}));
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kDiv, {x, row}, fdiv)->producer()));
+    Value* fdiv_bad = graph.AddValue("fdiv_bad", Type(Dtype::kFloat32, {2, 3}));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kDiv, {x, bad}, fdiv_bad)->producer()));
+}
+
+TEST(SpeculationTest, MatMul) {
+    Graph graph("test");
+    Value* a = graph.AddInputValue("a", Type(Dtype::kFloat32, {4, 2, 3}));
+    Value* b = graph.AddInputValue("b", Type(Dtype::kFloat32, {3, 5}));
+    Value* v = graph.AddInputValue("v", Type(Dtype::kFloat32, {3}));
+    Value* c = graph.AddInputValue("c", Type(Dtype::kFloat32, {5}));
+    Value* unknown = graph.AddInputValue("unknown", Type(Dtype::kFloat32));
+    GraphBuilder gb(&graph, "test", a);
+
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kMatMul, {a, b})->producer()));
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kMatMul, {a, v})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kMatMul, {b, a})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kMatMul, {a, unknown})->producer()));
+
+    Value* a2 = graph.AddInputValue("a2", Type(Dtype::kFloat32, {2, 3}));
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kGemm, {a2, b, c})->producer()));
+    Node* gemm = gb.Op(Node::kGemm, {a2, b, c})->producer();
+    gemm->set_trans_a(true);
+    EXPECT_TRUE(MayFail(*gemm));
+}
+
+TEST(SpeculationTest, Reshape) {
+    Graph graph("test");
+    Value* x = graph.AddInputValue("x", Type(Dtype::kFloat32, {2, 3}));
+    Value* shape = graph.AddInputValue("shape", Type(Dtype::kInt64, {2}));
+    GraphBuilder gb(&graph, "test", x);
+
+    EXPECT_FALSE(MayFail(*gb.Op(Node::kReshape, {x, gb.Const(Type(Dtype::kInt64, {2}), {3, 2})})->producer()));
+    EXPECT_TRUE(MayFail(*gb.Op(Node::kReshape, {x, shape})->producer()));
+}
+
+}  // namespace
+}  // namespace chainer_compiler
@@ -119,7 +119,17 @@ std::string Type::ToString() const {
         case Kind::kTensor: {
             std::string shape_str;
             if (has_known_shape_) {
-                shape_str = JoinString(MapToString(dims_, [](int64_t d) { return d < 0 ? "?" : StrCat(d); }), ",");
+                std::vector<std::string> dim_strs;
+                for (size_t i = 0; i < dims_.size(); ++i) {
+                    if (dims_[i] >= 0) {
+                        dim_strs.push_back(StrCat(dims_[i]));
+                    } else if (!dim_param(i).empty()) {
+                        dim_strs.push_back(dim_param(i));
+                    } else {
+                        dim_strs.push_back("?");
+                    }
+                }
+                shape_str = JoinString(dim_strs, ",");
             } else {
                 shape_str = "UNKNOWN";
             }
@@ -177,6 +187,28 @@ bool Type::HasKnownShape() const {
     return true;
 }
 
+const std::string& Type::dim_param(size_t i) const {
+    static const std::string kEmpty;
+    return i < dim_params_.size() ? dim_params_[i] : kEmpty;
+}
+
+bool Type::HasSymbolicShape() const {
+    if (!has_known_shape_ || kind_ != Kind::kTensor) return false;
+    for (size_t i = 0; i < dims_.size(); ++i) {
+        if (dims_[i] < 0 && dim_param(i).empty()) return false;
+    }
+    return true;
+}
+
+int64_t Type::EstimateNBytes(int64_t symbolic_dim_size) const {
+    if (dtype_ == Dtype::kUnknown || !HasSymbolicShape()) return -1;
+    int64_t num = 1;
+    for (int64_t d : dims_) {
+        num *= d < 0 ? symbolic_dim_size : d;
+    }
+    return num * dtype_.SizeOf();
+}
+
 std::ostream& operator<<(std::ostream& os, const Type::Kind& kind) {
     static const char* kNames[] = {"Tensor", "Sequence", "Map", "Opaque"};
     int k = static_cast<int>(kind);
@@ -47,6 +47,13 @@ public:
         return dims_;
     }
 
+    // Names of symbolic dimensions (e.g., "batch"). An empty string
+    // means the dimension has no name. May be shorter than `dims()`.
+    const std::vector<std::string>& dim_params() const {
+        return dim_params_;
+    }
+    const std::string& dim_param(size_t i) const;
+
     const std::string& denotation() const {
         return denotation_;
     }
@@ -60,6 +67,14 @@ public:
 
     bool HasKnownShape() const;
 
+    // Returns true if the rank is known and all unknown dimensions
+    // have names.
+    bool HasSymbolicShape() const;
+
+    // Same as `GetNBytes` but symbolic dimensions are assumed to be
+    // `symbolic_dim_size`.
+    int64_t EstimateNBytes(int64_t symbolic_dim_size) const;
+
 private:
     Kind kind_{Kind::kTensor};
     Dtype dtype_{Dtype::kUnknown};
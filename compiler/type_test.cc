@@ -0,0 +1,61 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <compiler/onnx.h>
+
+#include <compiler/dtype.h>
+#include <compiler/type.h>
+
+namespace chainer_compiler {
+namespace {
+
+// Makes an ONNX float tensor type. Negative values in `dims` are
+// unknown dimensions named by `dim_params`.
+onnx::TypeProto MakeTypeProto(const std::vector<int64_t>& dims, const std::vector<std::string>& dim_params) {
+    onnx::TypeProto xtype;
+    onnx::TypeProto::Tensor* tensor_type = xtype.mutable_tensor_type();
+    tensor_type->set_elem_type(onnx::TensorProto::FLOAT);
+    onnx::TensorShapeProto* shape = tensor_type->mutable_shape();
+    for (size_t i = 0; i < dims.size(); ++i) {
+        onnx::TensorShapeProto::Dimension* dim = shape->add_dim();
+        if (dims[i] >= 0) {
+            dim->set_dim_value(dims[i]);
+        } else if (!dim_params[i].empty()) {
+            dim->set_dim_param(dim_params[i]);
+        }
+    }
+    return xtype;
+}
+
+TEST(TypeTest, HasSymbolicShape) {
+    {
+        Type type(MakeTypeProto({-1, 3}, {"batch", ""}));
+        EXPECT_FALSE(type.HasKnownShape());
+        EXPECT_TRUE(type.HasSymbolicShape());
+        EXPECT_EQ("batch", type.dim_param(0));
+        EXPECT_EQ(-1, type.dims()[0]);
+        EXPECT_EQ(3, type.dims()[1]);
+        EXPECT_EQ(2 * 3 * 4, type.EstimateNBytes(2));
+    }
+    {
+        // An unnamed unknown dimension.
+        Type type(MakeTypeProto({-1, 3}, {"", ""}));
+        EXPECT_FALSE(type.HasSymbolicShape());
+        EXPECT_EQ(-1, type.EstimateNBytes(2));
+    }
+    {
+        Type type(Dtype::kFloat32, {2, 3});
+        EXPECT_TRUE(type.HasKnownShape());
+        EXPECT_TRUE(type.HasSymbolicShape());
+    }
+    {
+        // Unknown rank.
+        Type type(Dtype::kFloat32);
+        EXPECT_FALSE(type.HasSymbolicShape());
+    }
+}
+
+}  // namespace
+}  // namespace chainer_compiler
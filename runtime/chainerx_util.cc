@@ -92,6 +92,49 @@ std::vector<chainerx::Array> SplitByLengths(const chainerx::Array& input, int ax
     return results;
 }
 
+namespace {
+
+// Returns true if all `inputs` are on the native device and have the
+// same dtype, so they can be gathered by `GatherOnHost`.
+bool CanGatherOnHost(const std::vector<chainerx::Array>& inputs) {
+    if (inputs.empty()) {
+        return false;
+    }
+    for (const chainerx::Array& input : inputs) {
+        if (!IsNativeDevice(&input.device()) || input.dtype() != inputs[0].dtype()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Copies `inputs[i]` to `offsets[i]` bytes from the beginning of
+// `out`, which must be contiguous. The offsets are computed up front
+// so all copies can run in parallel.
+void GatherOnHost(const std::vector<chainerx::Array>& inputs, const std::vector<int64_t>& offsets, const chainerx::Array& out) {
+    CHECK(out.IsContiguous());
+    CHECK_EQ(inputs.size(), offsets.size());
+    std::vector<chainerx::Array> srcs;
+    srcs.reserve(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const chainerx::Array& input = inputs[i];
+        CHECK_LE(offsets[i] + input.GetNBytes(), out.GetNBytes());
+        srcs.push_back(input.IsContiguous() ? input : chainerx::AsContiguous(input));
+    }
+    uint8_t* dst = RawPtr<uint8_t>(out);
+    const int64_t num_inputs = srcs.size();
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t i = 0; i < num_inputs; ++i) {
+        // Splits of a sequence are contiguous views with offsets.
+        std::memcpy(dst + offsets[i], RawPtr<const uint8_t>(srcs[i]), srcs[i].GetNBytes());
+    }
+}
+
+}  // namespace
+
 chainerx::Array PadSequence(const std::vector<chainerx::Array>& inputs, int64_t length, chainerx::Scalar padding) {
     // TODO(hamaji): Move this logic to ChainerX.
     CHECK_LT(0, inputs.size());
@@ -114,6 +157,15 @@ chainerx::Array PadSequence(const std::vector<chainerx::Array>& inputs, int64_t
     shape.insert(shape.begin(), inputs.size());
     shape[1] = length;
     chainerx::Array result = chainerx::Full(shape, padding, inputs[0].dtype(), inputs[0].device());
+    if (CanGatherOnHost(inputs)) {
+        std::vector<int64_t> offsets;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            offsets.push_back(i * result.strides()[0]);
+        }
+        GatherOnHost(inputs, offsets, result);
+        return result;
+    }
+
     std::vector<chainerx::ArrayIndex> indices(shape.ndim(), chainerx::Slice());
     for (size_t i = 0; i < inputs.size(); ++i) {
         const chainerx::Array& input = inputs[i];
@@ -124,6 +176,47 @@ chainerx::Array PadSequence(const std::vector<chainerx::Array>& inputs, int64_t
     return result;
 }
 
+chainerx::Array StackSequence(const std::vector<chainerx::Array>& inputs, int axis) {
+    if (axis != 0 || !CanGatherOnHost(inputs)) {
+        return chainerx::Stack(inputs, axis);
+    }
+    for (const chainerx::Array& input : inputs) {
+        CHECK_EQ(inputs[0].shape(), input.shape()) << "Shapes of stacked arrays must be the same";
+    }
+    chainerx::Shape shape = inputs[0].shape();
+    shape.insert(shape.begin(), inputs.size());
+    chainerx::Array result = chainerx::Empty(shape, inputs[0].dtype(), inputs[0].device());
+    std::vector<int64_t> offsets;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        offsets.push_back(i * inputs[0].GetNBytes());
+    }
+    GatherOnHost(inputs, offsets, result);
+    return result;
+}
+
+chainerx::Array ConcatSequence(const std::vector<chainerx::Array>& inputs, int axis) {
+    if (axis != 0 || !CanGatherOnHost(inputs)) {
+        return chainerx::Concatenate(inputs, axis);
+    }
+    chainerx::Shape shape = inputs[0].shape();
+    CHECK_LT(0, shape.ndim());
+    shape[0] = 0;
+    std::vector<int64_t> offsets;
+    int64_t offset = 0;
+    for (const chainerx::Array& input : inputs) {
+        CHECK_EQ(shape.ndim(), input.ndim());
+        for (int i = 1; i < shape.ndim(); ++i) {
+            CHECK_EQ(shape[i], input.shape()[i]) << "Shapes of concatenated arrays must be the same except the first axis";
+        }
+        shape[0] += input.shape()[0];
+        offsets.push_back(offset);
+        offset += input.GetNBytes();
+    }
+    chainerx::Array result = chainerx::Empty(shape, inputs[0].dtype(), inputs[0].device());
+    GatherOnHost(inputs, offsets, result);
+    return result;
+}
+
 namespace {
 
 uint32_t xorshift() {
@@ -163,6 +256,11 @@ chainerx::OptionalAxes GetChainerXAxes(chainerx::StackVector<int64_t, chainerx::
     return xc_axes;
 }
 
+bool IsSameArray(const chainerx::Array& a, const chainerx::Array& b) {
+    return a.data() == b.data() && a.offset() == b.offset() && a.dtype() == b.dtype() && a.shape() == b.shape() &&
+           a.strides() == b.strides();
+}
+
 bool IsNativeDevice(const chainerx::Device* device) {
     return dynamic_cast<const chainerx::native::NativeDevice*>(device) != nullptr;
 }
@@ -27,12 +27,28 @@ std::vector<chainerx::Array> SplitByLengths(const chainerx::Array& input, int ax
 
 chainerx::Array PadSequence(const std::vector<chainerx::Array>& inputs, int64_t length, chainerx::Scalar padding);
 
+// Same as chainerx::Stack and chainerx::Concatenate, but arrays on the
+// native device are copied into the output in a single parallel pass
+// instead of one ChainerX op per input.
+chainerx::Array StackSequence(const std::vector<chainerx::Array>& inputs, int axis);
+chainerx::Array ConcatSequence(const std::vector<chainerx::Array>& inputs, int axis);
+
 chainerx::Array SlowRandom(chainerx::Shape shape);
 
 chainerx::Array CastTo(const chainerx::Array& input, chainerx::Dtype dtype);
 
 chainerx::OptionalAxes GetChainerXAxes(chainerx::StackVector<int64_t, chainerx::kMaxNdim> axes);
 
+// Returns true if `a` and `b` are the same view of the same buffer.
+bool IsSameArray(const chainerx::Array& a, const chainerx::Array& b);
+
+// Returns the pointer to the first element of `a`. Unlike
+// `raw_data()`, this takes the offset of views into account.
+template <typename T>
+T* RawPtr(const chainerx::Array& a) {
+    return reinterpret_cast<T*>(static_cast<char*>(a.raw_data()) + a.offset());
+}
+
 bool IsNativeDevice(const chainerx::Device* device);
 bool IsCudaDevice(const chainerx::Device* device);
 
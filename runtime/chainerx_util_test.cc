@@ -0,0 +1,35 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <chainerx/array.h>
+#include <chainerx/testing/array.h>
+#include <chainerx/testing/array_check.h>
+#include <chainerx/testing/context_session.h>
+
+#include <runtime/chainerx_util.h>
+
+namespace chainer_compiler {
+namespace runtime {
+namespace {
+
+TEST(ChainerXUtilTest, GatherSplitSequence) {
+    chainerx::testing::ContextSession sess;
+
+    chainerx::Array x = chainerx::testing::BuildArray({3, 4}).WithData<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    // Splits along the first axis are contiguous views with offsets.
+    std::vector<chainerx::Array> rows = SplitByLengths(x, 0, {1, 1, 1});
+    ASSERT_TRUE(rows[2].IsContiguous());
+    ASSERT_NE(0, rows[2].offset());
+
+    EXPECT_ARRAY_EQ(x.Reshape({3, 1, 4}), StackSequence(rows, 0));
+    EXPECT_ARRAY_EQ(x, ConcatSequence(rows, 0));
+
+    std::vector<chainerx::Array> xs = SplitByLengths(x, 0, {1, 2});
+    chainerx::Array e = chainerx::testing::BuildArray({2, 2, 4}).WithData<float>({0, 1, 2, 3, -1, -1, -1, -1, 4, 5, 6, 7, 8, 9, 10, 11});
+    EXPECT_ARRAY_EQ(e, PadSequence(xs, 0, -1.0f));
+}
+
+}  // namespace
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -1,14 +1,20 @@
 #include "runtime/chxvm.h"
 
 #include <iomanip>
+#include <map>
 #include <numeric>
+#include <set>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #ifdef CHAINER_COMPILER_ENABLE_NVTX
 #include <nvToolsExt.h>
 #endif  // CHAINER_COMPILER_ENABLE_NVTX
 
 #include <chainerx/array.h>
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/manipulation.h>
 
 #include <common/log.h>
 #include <common/strutil.h>
@@ -26,21 +32,68 @@ namespace chainer_compiler {
 namespace runtime {
 
 struct ChxVMInputDesc {
-    ChxVMInputDesc(const std::string& n, chainerx::Dtype d, chainerx::Shape s) : name(n), dtype(d), shape(s) {
+    ChxVMInputDesc(const std::string& n, chainerx::Dtype d, const ChxVMTypeProto& t) : name(n), dtype(d), type(t) {
     }
     const std::string name;
     const chainerx::Dtype dtype;
-    const chainerx::Shape shape;
+    const ChxVMTypeProto type;
 };
 
+struct ChxVMPrepackedInput {
+    ChxVMPrepackedInput(const std::string& n, const chainerx::Array& o, const chainerx::Array& p) : name(n), original(o), prepacked(p) {
+    }
+    const std::string name;
+    const chainerx::Array original;
+    const chainerx::Array prepacked;
+};
+
+bool MatchesShape(const ChxVMTypeProto& type, const chainerx::Shape& shape, std::map<std::string, int64_t>* bindings) {
+    if (type.shape_size() != shape.ndim()) {
+        return false;
+    }
+    for (int i = 0; i < type.shape_size(); ++i) {
+        if (type.shape(i) >= 0) {
+            if (type.shape(i) != shape[i]) {
+                return false;
+            }
+            continue;
+        }
+        if (i >= type.dim_params_size() || type.dim_params(i).empty()) {
+            continue;
+        }
+        auto p = bindings->emplace(type.dim_params(i), shape[i]);
+        if (p.first->second != shape[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 namespace {
 
+std::string ShapeToString(const ChxVMTypeProto& type) {
+    std::vector<std::string> dims;
+    for (int i = 0; i < type.shape_size(); ++i) {
+        if (type.shape(i) >= 0) {
+            dims.push_back(StrCat(type.shape(i)));
+        } else if (i < type.dim_params_size() && !type.dim_params(i).empty()) {
+            dims.push_back(type.dim_params(i));
+        } else {
+            dims.push_back("?");
+        }
+    }
+    return StrCat("(", JoinString(dims, ", "), ")");
+}
+
 void CheckType(ChxVMState* st, const ChxVMOp* op) {
     const ChxVMInstructionProto& inst = op->instruction();
     if (inst.output_names().empty()) {
         return;
     }
     CHECK_EQ(inst.outputs().size(), inst.output_types().size()) << inst.DebugString();
+    // Symbolic dimensions which are not bound by the inputs may have
+    // different sizes in different iterations of loops.
+    std::map<std::string, int64_t> bindings = st->input_bindings();
     for (size_t i = 0; i < inst.outputs().size(); ++i) {
         const ChxVMTypeProto& type = inst.output_types(i);
         if (type.dtype() == 0) {
@@ -58,9 +111,48 @@ void CheckType(ChxVMState* st, const ChxVMOp* op) {
         const chainerx::Array& a = st->GetArray(id);
         CHECK_EQ(static_cast<chainerx::Dtype>(type.dtype()), a.dtype())
                 << "Dtype check failed in output #" << i << ": " << op->debug_info();
-        CHECK_EQ(chainerx::Shape(type.shape().begin(), type.shape().end()), a.shape())
-                << "Shape check failed in output #" << i << ": " << op->debug_info();
+        CHECK(MatchesShape(type, a.shape(), &bindings))
+                << "Shape check failed in output #" << i << ": " << ShapeToString(type) << " vs " << a.shape() << ": " << op->debug_info();
+    }
+}
+
+// How an op wants a constant input to be laid out in memory.
+enum class WeightLayout {
+    // Anything is OK, or the input is used in an unknown way.
+    kAny,
+    // The last two axes are stored in the transposed order, i.e.,
+    // `Transpose` of the input is contiguous.
+    kTransposed,
+};
+
+// Only layouts consumed by native kernels are listed. Ops which pass
+// weights to chainerx::Dot (e.g., Linear and Gemm) are not, as Dot
+// handles transposed operands by itself and prepacking would only
+// double the memory for weights.
+WeightLayout GetPreferredLayout(const ChxVMInstructionProto& inst, int index) {
+    switch (inst.op()) {
+        case ChxVMInstructionProto::RNN:
+        case ChxVMInstructionProto::LSTM:
+            // The native kernels run the recurrent GEMM with a
+            // contiguous `R^T` of each direction, which is copied for
+            // each run unless `R` is prepacked. GRU is not listed as
+            // it slices `R` by gates.
+            return index == 2 ? WeightLayout::kTransposed : WeightLayout::kAny;
+        default:
+            return WeightLayout::kAny;
+    }
+}
+
+// Returns an array which has the same values as `a` but the last two
+// axes are stored in the transposed order.
+chainerx::Array LayOutTransposed(const chainerx::Array& a) {
+    chainerx::Axes axes;
+    for (int i = 0; i < a.ndim() - 2; ++i) {
+        axes.push_back(i);
     }
+    axes.push_back(a.ndim() - 1);
+    axes.push_back(a.ndim() - 2);
+    return chainerx::Transpose(chainerx::AsContiguous(chainerx::Transpose(a, axes)), axes);
 }
 
 int64_t InMbs(int64_t bytes) {
@@ -91,6 +183,33 @@ void DumpOutput(ChxVMState* st, const ChxVMOp* op, const std::string& output_dir
     }
 }
 
+// Returns the number of array inputs of `op` which are views with
+// non-contiguous strides or nonzero offsets.
+int CountStridedInputs(ChxVMState* st, const ChxVMOp* op) {
+    int count = 0;
+    auto check = [st, &count](int id) {
+        if (id < 0) return;
+        ChxVMVar* var = st->GetVar(id);
+        if (!var->IsArray()) return;
+        const chainerx::Array& a = var->GetArray();
+        if (!a.IsContiguous() || a.offset() != 0) ++count;
+    };
+    for (const ChxVMValueProto& input : op->instruction().inputs()) {
+        switch (input.type()) {
+            case ChxVMValueProto::ARRAY:
+            case ChxVMValueProto::OPTIONAL_ARRAY:
+                check(input.array());
+                break;
+            case ChxVMValueProto::ARRAY_LIST:
+                for (int id : input.array_list()) check(id);
+                break;
+            default:
+                break;
+        }
+    }
+    return count;
+}
+
 }  // namespace
 
 ChxVMOptions::ChxVMOptions() {
@@ -101,7 +220,7 @@ ChxVMOptions::ChxVMOptions() {
     verbose_ops.resize(num_ops);
 }
 
-ChxVM::ChxVM(const ChxVMProgramProto& program) {
+ChxVM::ChxVM(const ChxVMProgramProto& program, const InOuts& params) {
     num_variables_ = 0;
     for (const ChxVMInstructionProto& inst : program.instructions()) {
         for (int output : inst.outputs()) {
@@ -119,8 +238,64 @@ ChxVM::ChxVM(const ChxVMProgramProto& program) {
         const std::string& name = program.input_names(i);
         const ChxVMTypeProto& type = program.input_types(i);
         chainerx::Dtype dtype = static_cast<chainerx::Dtype>(type.dtype());
-        chainerx::Shape shape(type.shape().begin(), type.shape().end());
-        input_descs_.emplace_back(new ChxVMInputDesc(name, dtype, shape));
+        input_descs_.emplace_back(new ChxVMInputDesc(name, dtype, type));
+    }
+
+    if (params.empty()) {
+        return;
+    }
+
+    // Find the variables which hold constant arrays and the layouts
+    // requested by their users. A variable is prepacked only when all
+    // of its users agree on the layout.
+    std::map<int, std::string> param_names;
+    for (const ChxVMInstructionProto& inst : program.instructions()) {
+        if (inst.op() == ChxVMInstructionProto::In) {
+            const std::string& name = inst.inputs(0).s();
+            auto found = params.find(name);
+            if (found != params.end() && found->second->IsArray() && found->second->GetArray().ndim() >= 2) {
+                param_names.emplace(inst.outputs(0), name);
+            }
+        }
+    }
+    std::map<int, WeightLayout> layouts;
+    std::set<int> rejected;
+    for (const ChxVMInstructionProto& inst : program.instructions()) {
+        if (inst.op() == ChxVMInstructionProto::In) {
+            continue;
+        }
+        for (int output : inst.outputs()) {
+            rejected.insert(output);
+        }
+        for (int i = 0; i < inst.inputs_size(); ++i) {
+            const ChxVMValueProto& value = inst.inputs(i);
+            std::vector<int> ids;
+            if (value.type() == ChxVMValueProto::ARRAY || value.type() == ChxVMValueProto::OPTIONAL_ARRAY) {
+                ids.push_back(value.array());
+            } else if (value.type() == ChxVMValueProto::ARRAY_LIST) {
+                ids.assign(value.array_list().begin(), value.array_list().end());
+            }
+            for (int id : ids) {
+                if (!param_names.count(id)) {
+                    continue;
+                }
+                const WeightLayout layout = ids.size() == 1 ? GetPreferredLayout(inst, i) : WeightLayout::kAny;
+                auto p = layouts.emplace(id, layout);
+                if (layout == WeightLayout::kAny || p.first->second != layout) {
+                    rejected.insert(id);
+                }
+            }
+        }
+    }
+
+    for (const auto& p : layouts) {
+        if (rejected.count(p.first)) {
+            continue;
+        }
+        CHECK(p.second == WeightLayout::kTransposed);
+        const std::string& name = param_names[p.first];
+        const chainerx::Array& original = params.find(name)->second->GetArray();
+        prepacked_inputs_.emplace_back(new ChxVMPrepackedInput(name, original, LayOutTransposed(original)));
     }
 }
 
@@ -128,6 +303,8 @@ ChxVM::~ChxVM() {
 }
 
 std::unique_ptr<ChxVMState> ChxVM::Prepare(const InOuts& program_inputs, const ChxVMOptions& options) {
+    // Sizes of symbolic dimensions (e.g., batch) bound by the inputs.
+    std::map<std::string, int64_t> bindings;
     for (const std::unique_ptr<ChxVMInputDesc>& input : input_descs_) {
         auto found = program_inputs.find(input->name);
         CHECK(found != program_inputs.end()) << "Input '" << input->name << "' not found";
@@ -138,12 +315,28 @@ std::unique_ptr<ChxVMState> ChxVM::Prepare(const InOuts& program_inputs, const C
                 continue;
             }
             CHECK_EQ(input->dtype, a.dtype()) << "Input '" << input->name << "' has an unexpected dtype";
-            CHECK_EQ(input->shape, a.shape()) << "Input '" << input->name << "' has an unexpected shape";
+            CHECK(MatchesShape(input->type, a.shape(), &bindings))
+                    << "Input '" << input->name << "' has an unexpected shape: expected=" << ShapeToString(input->type) << " actual=" << a.shape();
         } else {
             CHECK_EQ(static_cast<int>(input->dtype), 0) << "Input '" << input->name << "' must be a tensor";
         }
     }
-    return std::make_unique<ChxVMState>(options, num_variables_, program_inputs);
+
+    std::unique_ptr<ChxVMState> state;
+    if (prepacked_inputs_.empty()) {
+        state = std::make_unique<ChxVMState>(options, num_variables_, program_inputs);
+    } else {
+        InOuts inputs(program_inputs);
+        for (const std::unique_ptr<ChxVMPrepackedInput>& input : prepacked_inputs_) {
+            auto found = inputs.find(input->name);
+            if (found != inputs.end() && found->second->IsArray() && IsSameArray(input->original, found->second->GetArray())) {
+                found->second = std::make_shared<ChxVMVar>(input->prepacked);
+            }
+        }
+        state = std::make_unique<ChxVMState>(options, num_variables_, inputs);
+    }
+    state->set_input_bindings(bindings);
+    return state;
 }
 
 InOuts ChxVM::Run(const InOuts& program_inputs, const ChxVMOptions& options) {
@@ -156,6 +349,9 @@ void ChxVM::Run(ChxVMState* state) {
     state->SetProgram(&program_);
     const ChxVMOptions& options = state->options();
     int64_t peak_used_mbs = 0, peak_total_mbs = 0;
+    // Views passed to ops as they are, and ones copied for ops which
+    // need contiguous inputs.
+    int64_t num_views_passed = 0, num_views_copied = 0;
 
     while (true) {
         int pc = state->pc();
@@ -163,6 +359,15 @@ void ChxVM::Run(ChxVMState* state) {
 
         ChxVMOp* op = program_[pc].get();
 
+        if (options.dump_memory_usage >= 1) {
+            int num_strided = CountStridedInputs(state, op);
+            if (AcceptsStridedInputs(op->op())) {
+                num_views_passed += num_strided;
+            } else {
+                num_views_copied += num_strided;
+            }
+        }
+
         {
             ChromeTracingEmitter::ScopedEvent se(options.chrome_tracing, "ChxVM", op->name(), pc, op->instruction().flops());
 #ifdef CHAINER_COMPILER_ENABLE_NVTX
@@ -193,6 +398,10 @@ void ChxVM::Run(ChxVMState* state) {
             DumpOutput(state, op, options.dump_outputs_dir);
         }
 
+        if (options.after_op_hook) {
+            options.after_op_hook(state, *op);
+        }
+
         if (options.dump_memory_usage >= 1) {
             int64_t used_mbs = InMbs(state->GetTotalVariableSize());
             peak_used_mbs = std::max(used_mbs, peak_used_mbs);
@@ -219,6 +428,7 @@ void ChxVM::Run(ChxVMState* state) {
         }
         report = StrCat(report, " Peak monitored by Chx hook=", InMbs(GetPeakMemory()), "MB)");
         std::cerr << report << std::endl;
+        std::cerr << "Views: " << num_views_passed << " passed as is, " << num_views_copied << " made contiguous" << std::endl;
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -59,13 +60,21 @@ public:
     std::string dump_outputs_dir;
 
     std::map<std::string, CustomOpFunc> custom_op_funcs;
+
+    // Called after each op is executed, e.g., to observe values.
+    std::function<void(ChxVMState*, const ChxVMOp&)> after_op_hook;
 };
 
 struct ChxVMInputDesc;
+struct ChxVMPrepackedInput;
 
 class ChxVM {
 public:
-    explicit ChxVM(const ChxVMProgramProto& program);
+    // Constant weights in `params` (e.g., initializers) are laid out
+    // for the ops which use them once here, and the prepacked arrays
+    // are fed instead when the same arrays are given to `Run`. Arrays
+    // in `params` must not be updated in-place after construction.
+    explicit ChxVM(const ChxVMProgramProto& program, const InOuts& params = InOuts());
     ~ChxVM();
 
     std::unique_ptr<ChxVMState> Prepare(const InOuts& program_inputs, const ChxVMOptions& options);
@@ -82,8 +91,15 @@ private:
 
     std::vector<std::unique_ptr<ChxVMOp>> program_;
     std::vector<std::unique_ptr<ChxVMInputDesc>> input_descs_;
+    std::vector<std::unique_ptr<ChxVMPrepackedInput>> prepacked_inputs_;
     int num_variables_;
 };
 
+// Checks if `shape` matches `type`. Negative dimensions in `type` are
+// symbolic and match any size, but dimensions with the same name must
+// have the same size. The sizes of named dimensions are recorded to
+// `bindings`.
+bool MatchesShape(const ChxVMTypeProto& type, const chainerx::Shape& shape, std::map<std::string, int64_t>* bindings);
+
 }  // namespace runtime
 }  // namespace chainer_compiler
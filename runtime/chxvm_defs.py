@@ -291,8 +291,8 @@ CHX_OPS = [
 
     ('Dropout', [Array('data'), Float('ratio')], ['output', 'mask']),
 
-    ('Resize', [Array('x'), Array('scales')], ['y']),
-    ('ResizeGrad', [Array('x'), Array('scales')], ['y']),
+    ('Resize', [Array('x'), Array('scales'), String('mode')], ['y']),
+    ('ResizeGrad', [Array('x'), Array('scales'), Shape('x_shape')], ['y']),
     ('Pad', [Array('data'), Ints('pads'), Float('value')], ['output']),
     ('MaxPool',
      [Array('x'), Ints('kernel_shape'), Ints('strides'), Ints('pads'),
@@ -325,6 +325,28 @@ CHX_OPS = [
      [Array('x'), Array('rois'), Array('roi_indices'),
       Ints('output_shape'), Float('spatial_scale'), Ints('sampling_ratio')],
      ['y']),
+    ('ROIMaxPool2DGrad',
+     [Array('gy'), Array('x'), Array('rois'), Array('roi_indices'),
+      Ints('output_shape'), Float('spatial_scale')],
+     ['gx']),
+    ('ROIAveragePool2DGrad',
+     [Array('gy'), Array('x'), Array('rois'), Array('roi_indices'),
+      Ints('output_shape'), Float('spatial_scale')],
+     ['gx']),
+    ('ROIMaxAlign2DGrad',
+     [Array('gy'), Array('x'), Array('rois'), Array('roi_indices'),
+      Ints('output_shape'), Float('spatial_scale'), Ints('sampling_ratio')],
+     ['gx']),
+    ('ROIAverageAlign2DGrad',
+     [Array('gy'), Array('x'), Array('rois'), Array('roi_indices'),
+      Ints('output_shape'), Float('spatial_scale'), Ints('sampling_ratio')],
+     ['gx']),
+    ('NonMaxSuppression',
+     [Array('boxes'), Array('scores'),
+      OptionalScalar('max_output_boxes_per_class'),
+      OptionalScalar('iou_threshold'), OptionalScalar('score_threshold'),
+      Int('center_point_box')],
+     ['selected_indices']),
     ('ResizeImages',
      [Array('x'), Ints('output_shape')],
      ['y']),
@@ -362,15 +384,30 @@ CHX_OPS = [
      ['y', 'y_h', 'y_c', Opaque('ctx')]),
     ('LSTMGrad',
      [Array('gy'), Opaque('ctx')],
-     ['gx', 'gw', 'gr', 'gb']),
+     ['gx', 'gw', 'gr', 'gb', 'gp']),
 
     ('BatchNormalization',
      [Array('x'), Array('s'), Array('bias'), Array('mean'), Array('var'),
-      Float('epsilon'), Float('decay'), Int('in_recomputing')],
+      Float('epsilon'), Float('decay'), Int('in_recomputing'),
+      Int('fuse_relu')],
      ['y', Opaque('ctx'),
       OptionalArray('running_mean'), OptionalArray('running_var'),
       OptionalArray('saved_mean'), OptionalArray('saved_var')]),
     ('FixedBatchNormalization',
+     [Array('x'), Array('s'), Array('bias'), Array('mean'), Array('var'),
+      Float('epsilon'), Int('fuse_relu')],
+     ['y']),
+    # Inference only ops for NHWC inputs. See compiler/layout.h.
+    ('ConvNHWC',
+     [Array('x'), Array('w'), OptionalArray('b'),
+      Ints('strides'), Ints('pads')], ['y']),
+    ('MaxPoolNHWC',
+     [Array('x'), Ints('kernel_shape'), Ints('strides'), Ints('pads'),
+      Int('cover_all')], ['y']),
+    ('AveragePoolNHWC',
+     [Array('x'), Ints('kernel_shape'), Ints('strides'), Ints('pads'),
+      Int('count_include_pad')], ['y']),
+    ('FixedBatchNormalizationNHWC',
      [Array('x'), Array('s'), Array('bias'), Array('mean'), Array('var'),
       Float('epsilon')],
      ['y']),
@@ -402,10 +439,13 @@ CHX_OPS = [
      [Array('indices'), Scalar('depth'), Array('values'), Int('axis')],
      ['output']),
     ('EyeLike', [Array('input'), Int('dtype'), Int('k')], ['output']),
+    ('ScanOutputCreate',
+     [Scalar('trip_count'), Ints('shape'), Int('dtype')], ['output']),
 
     ('Jmp', [Int('pc')], []),
     ('JmpTrue', [Scalar('cond'), Int('pc')], []),
     ('JmpFalse', [Scalar('cond'), Int('pc')], []),
+    ('ScalarGreater', [Scalar('a'), Scalar('b')], [Scalar('c')]),
 
     ('ElementWiseNvrtc',
      [ArrayList('inputs'), Int('num_outputs'),
@@ -424,11 +464,6 @@ CHX_OPS = [
     ('DequantizeLinear',
      [Array('x'), Scalar('x_scale'), OptionalScalar('x_zero_point')],
      [Array('y')]),
-    ('QLinearConv',
-     [Array('x'), Scalar('x_scale'), Scalar('x_zero_point'),
-      Array('w'), Array('w_scale'), Array('w_zero_point'),
-      Scalar('y_scale'), Scalar('y_zero_point'), OptionalArray('b'),
-      Ints('strides'), Ints('pads'), Int('group'), String('auto_pad')], ['y']),
     ('MatMulInteger',
      [Array('a'), Array('b'),
       OptionalArray('a_zero_point'), OptionalArray('b_zero_point')],
@@ -462,6 +497,16 @@ CHX_CUSTOM_FIELD_OPS = [
      [ArrayList('inputs'), Strings('input_names'),
       String('model_data'), String('device')],
      [ArrayList('outputs')]),
+    # Packed weights are cached in the impl.
+    ('QLinearConv',
+     [Array('x'), Scalar('x_scale'), Scalar('x_zero_point'),
+      Array('w'), Array('w_scale'), Array('w_zero_point'),
+      Scalar('y_scale'), Scalar('y_zero_point'), OptionalArray('b'),
+      Ints('strides'), Ints('pads'), Int('group'), String('auto_pad')], ['y']),
+    ('QLinearMatMul',
+     [Array('a'), Scalar('a_scale'), Scalar('a_zero_point'),
+      Array('b'), Array('b_scale'), Array('b_zero_point'),
+      Scalar('y_scale'), Scalar('y_zero_point')], ['y']),
 ]
 
 CHX_SEQ_OPS = [
@@ -494,7 +539,6 @@ CHX_SEQ_OPS = [
      [Sequence('output')]),
     ('SequenceSize', [Sequence('seq')], ['output']),
     ('SequenceLengths', [Sequence('seq')], [Sequence('output')]),
-    ('SequenceCopy', [Sequence('seq')], [Sequence('output')]),
 ]
 
 # Ops which modify the input in-place.
@@ -502,8 +546,19 @@ CHX_SEQ_OPS_UNTYPED = [
     ('SequenceClear', [Sequence('seq')], []),
     ('SequenceAppend', [Sequence('seq'), Array('value')],
      []),
+    ('ScanOutputSet', [Array('output'), Scalar('index'), Array('value')],
+     []),
     ('SequencePop', [Sequence('seq')], ['output']),
     ('SequenceMove', [Sequence('seq')], [Sequence('output')]),
+    # Shares the contents with `seq` until either of them is modified.
+    ('SequenceCopy', [Sequence('seq')], [Sequence('output')]),
+]
+
+# Ops which update scalar registers in-place. Used for bookkeeping of
+# control flow such as loop counters.
+CHX_SCALAR_OPS_UNTYPED = [
+    ('ScalarIncrement', [Scalar('x')], []),
+    ('ScalarAnd', [Scalar('x'), Scalar('y')], []),
 ]
 
 CHX_GENERIC_OPS = [
@@ -527,6 +582,46 @@ CHX_GENERIC_OPS = [
 ]
 
 
+# Ops which read raw buffers of their array inputs or make them
+# contiguous anyway. Strided inputs and views with offsets are copied
+# before they run. Other ops take views such as outputs of Transpose
+# and Slice as they are. RNN and LSTM are not listed so that `R`
+# prepacked by ChxVM reaches their native kernels as is. The kernels
+# make the other inputs contiguous by themselves.
+CHX_CONTIGUOUS_INPUT_OPS = set([
+    'ROIMaxPool2D',
+    'ROIAveragePool2D',
+    'ROIMaxAlign2D',
+    'ROIAverageAlign2D',
+    'ROIMaxPool2DGrad',
+    'ROIAveragePool2DGrad',
+    'ROIMaxAlign2DGrad',
+    'ROIAverageAlign2DGrad',
+    'NonMaxSuppression',
+    'Resize',
+    'ResizeGrad',
+    'ResizeImages',
+    'GRU',
+    'LSTMGrad',
+    'BatchNormalization',
+    'FixedBatchNormalization',
+    'BatchNormalizationGrad',
+    'ConvNHWC',
+    'MaxPoolNHWC',
+    'AveragePoolNHWC',
+    'FixedBatchNormalizationNHWC',
+    'QLinearConv',
+    'QLinearMatMul',
+    'MatMulInteger',
+    'ConvInteger',
+    'TVM',
+    'NGraph',
+    'Dldt',
+    'SnpeDlc',
+    'ElementWiseNvrtc',
+])
+
+
 class Op(object):
     def __init__(self, name, inputs, outputs,
                  typed=True,
@@ -544,10 +639,15 @@ class Op(object):
                 self.output_names.append(output)
         self.typed = typed
         self.has_custom_field = has_custom_field
+        self.accepts_strided = name not in CHX_CONTIGUOUS_INPUT_OPS
 
 
 CHX_ALL_OPS = [Op(*op) for op in CHX_OPS]
 CHX_ALL_OPS += [Op(*op, has_custom_field=True) for op in CHX_CUSTOM_FIELD_OPS]
 CHX_ALL_OPS += [Op(*op) for op in CHX_SEQ_OPS]
 CHX_ALL_OPS += [Op(*op, typed=False) for op in CHX_SEQ_OPS_UNTYPED]
+CHX_ALL_OPS += [Op(*op, typed=False) for op in CHX_SCALAR_OPS_UNTYPED]
 CHX_ALL_OPS += [Op(*op, typed=False) for op in CHX_GENERIC_OPS]
+
+for op in CHX_CONTIGUOUS_INPUT_OPS:
+    assert op in [o.name for o in CHX_ALL_OPS], op
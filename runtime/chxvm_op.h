@@ -46,6 +46,9 @@ protected:
 
 ChxVMOp* MakeChxVMOp(const ChxVMInstructionProto& inst);
 
+// Returns false if `op` needs contiguous arrays as its inputs.
+bool AcceptsStridedInputs(ChxVMInstructionProto::Op op);
+
 inline std::ostream& operator<<(std::ostream& os, ChxVMInstructionProto::Op op) {
     return os << ChxVMInstructionProto::Op_Name(op);
 }
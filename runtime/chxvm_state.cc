@@ -45,6 +45,24 @@ void ChxVMState::SetArrayList(const std::vector<int>& index, const std::vector<c
     for (size_t i = 0; i < index.size(); ++i) SetArray(index[i], vars[i]);
 }
 
+chainerx::Array ChxVMState::GetContiguousArray(int index) {
+    chainerx::Array a = GetArray(index);
+    if (a.IsContiguous() && a.offset() == 0) return a;
+    // AsContiguous returns contiguous views with offsets as they are.
+    return a.Copy();
+}
+
+absl::optional<chainerx::Array> ChxVMState::GetOptionalContiguousArray(int index) {
+    if (index < 0) return absl::nullopt;
+    return GetContiguousArray(index);
+}
+
+std::vector<chainerx::Array> ChxVMState::GetContiguousArrayList(const std::vector<int>& index) {
+    std::vector<chainerx::Array> vars;
+    for (int i : index) vars.push_back(GetContiguousArray(i));
+    return vars;
+}
+
 ChxVMSequence* ChxVMState::CreateSequence(int index) {
     CHECK_LE(0, index) << index;
     CHECK_GT(variables_.size(), index) << index;
@@ -59,6 +77,13 @@ ChxVMSequence* ChxVMState::GetSequence(int index) {
     return variables_[index]->GetSequence();
 }
 
+ChxVMSequence* ChxVMState::GetMutableSequence(int index) {
+    CHECK_LE(0, index) << index;
+    CHECK_GT(variables_.size(), index) << index;
+    CHECK(variables_[index].get());
+    return variables_[index]->GetMutableSequence();
+}
+
 const ChxVMOpaque& ChxVMState::GetOpaque(int index) {
     CHECK_LE(0, index) << index;
     CHECK_GT(variables_.size(), index) << index;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <stack>
 #include <string>
 #include <vector>
@@ -38,8 +39,16 @@ public:
     std::vector<chainerx::Array> GetArrayList(const std::vector<int>& index);
     void SetArrayList(const std::vector<int>& index, const std::vector<chainerx::Array>& vars);
 
+    // Same as above but views such as outputs of Transpose are copied
+    // to contiguous arrays. Used by ops which read raw buffers.
+    chainerx::Array GetContiguousArray(int index);
+    absl::optional<chainerx::Array> GetOptionalContiguousArray(int index);
+    std::vector<chainerx::Array> GetContiguousArrayList(const std::vector<int>& index);
+
     ChxVMSequence* CreateSequence(int index);
     ChxVMSequence* GetSequence(int index);
+    // Returns the sequence which is not shared with other variables.
+    ChxVMSequence* GetMutableSequence(int index);
 
     const ChxVMOpaque& GetOpaque(int index);
     void SetOpaque(int index, ChxVMOpaque* opaque);
@@ -94,6 +103,14 @@ public:
 
     int64_t GetTotalVariableSize() const;
 
+    // Sizes of symbolic dimensions bound by the program inputs.
+    const std::map<std::string, int64_t>& input_bindings() const {
+        return input_bindings_;
+    }
+    void set_input_bindings(const std::map<std::string, int64_t>& bindings) {
+        input_bindings_ = bindings;
+    }
+
 private:
     void ReportInvalidInOuts(const std::vector<int>& inputs, const std::vector<int>& outputs);
 
@@ -103,6 +120,7 @@ private:
     InOuts outputs_;
     ChxVMOptions options_;
     const std::vector<std::unique_ptr<ChxVMOp>>* program_;
+    std::map<std::string, int64_t> input_bindings_;
 };
 
 }  // namespace runtime
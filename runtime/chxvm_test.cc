@@ -1,10 +1,14 @@
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <string>
 
 #include <gtest/gtest.h>
 
 #include <chainerx/array.h>
 #include <chainerx/numeric.h>
 #include <chainerx/routines/creation.h>
+#include <chainerx/routines/manipulation.h>
 #include <chainerx/testing/array.h>
 #include <chainerx/testing/array_check.h>
 #include <chainerx/testing/context_session.h>
@@ -13,6 +17,8 @@
 #include <compiler/gen_chxvm_codegen.h>
 #include <runtime/chxvm.h>
 #include <runtime/chxvm.pb.h>
+#include <runtime/chxvm_op.h>
+#include <runtime/chxvm_state.h>
 #include <runtime/chxvm_var.h>
 
 namespace chainer_compiler {
@@ -40,6 +46,149 @@ TEST(ChxVMTest, Run) {
     EXPECT_ARRAY_EQ(e, outputs["out"]->GetArray());
 }
 
+TEST(ChxVMTest, RunWithPrepackedWeight) {
+    chainerx::testing::ContextSession sess;
+
+    ChxVMProgramProto program;
+    chxvm::AddInOp(&program, chxvm::ChxVMValue(0), "x");
+    chxvm::AddInOp(&program, chxvm::ChxVMValue(1), "w");
+    chxvm::AddInOp(&program, chxvm::ChxVMValue(2), "r");
+    chxvm::AddRNNOp(&program, chxvm::ChxVMValue(3), chxvm::ChxVMValue(4), 0, 1, 2, -1, -1, -1, 2, 0);
+    chxvm::AddOutOp(&program, "y_h", 4);
+
+    InOuts params;
+    chainerx::Array w = chainerx::testing::BuildArray({1, 2, 2}).WithData<float>({1, 0, 0, 1});
+    chainerx::Array r = chainerx::testing::BuildArray({1, 2, 2}).WithData<float>({0, 1, 0, 0});
+    params.emplace("w", std::shared_ptr<ChxVMVar>(new ChxVMVar(w)));
+    params.emplace("r", std::shared_ptr<ChxVMVar>(new ChxVMVar(r)));
+    ChxVM chxvm(program, params);
+
+    InOuts inputs(params);
+    chainerx::Array x = chainerx::testing::BuildArray({2, 1, 2}).WithData<float>({0.5, -0.5, 0, 0});
+    inputs.emplace("x", std::shared_ptr<ChxVMVar>(new ChxVMVar(x)));
+
+    // Only `R` is consumed by the native kernel in the transposed
+    // layout. `W` is passed to Dot as is.
+    int num_rnns = 0;
+    ChxVMOptions options;
+    options.after_op_hook = [&num_rnns](ChxVMState* st, const ChxVMOp& op) {
+        if (op.instruction().op() != ChxVMInstructionProto::RNN) {
+            return;
+        }
+        ++num_rnns;
+        const chainerx::Array& rv = st->GetVar(2)->GetArray();
+        EXPECT_FALSE(rv.IsContiguous());
+        EXPECT_TRUE(chainerx::Transpose(rv, {0, 2, 1}).IsContiguous());
+        EXPECT_TRUE(st->GetVar(1)->GetArray().IsContiguous());
+    };
+
+    // h1 = tanh(x1 * W^T), h2 = tanh(x2 * W^T + h1 * R^T).
+    const float t = std::tanh(0.5f);
+    chainerx::Array e = chainerx::testing::BuildArray({1, 1, 2}).WithData<float>({std::tanh(-t), 0});
+    for (int i = 0; i < 2; ++i) {
+        InOuts outputs = chxvm.Run(inputs, options);
+        ASSERT_EQ(1, outputs.count("y_h"));
+        EXPECT_ARRAY_EQ(e, outputs["y_h"]->GetArray());
+    }
+    EXPECT_EQ(2, num_rnns);
+    // The original weight is kept as is.
+    EXPECT_TRUE(inputs["r"]->GetArray().IsContiguous());
+}
+
+TEST(ChxVMTest, SequenceCopyOnWrite) {
+    chainerx::testing::ContextSession sess;
+
+    ChxVMProgramProto program;
+    chxvm::AddInOp(&program, chxvm::ChxVMValue(0), "seq");
+    chxvm::AddInOp(&program, chxvm::ChxVMValue(1), "x");
+    chxvm::AddSequenceCopyOp(&program, chxvm::ChxVMValue(2), 0);
+    chxvm::AddSequenceAppendOp(&program, 2, 1);
+    chxvm::AddOutOp(&program, "orig", 0);
+    chxvm::AddOutOp(&program, "copied", 2);
+
+    ChxVM chxvm(program);
+    InOuts inputs;
+    auto seq = std::make_shared<ChxVMSequence>();
+    seq->emplace_back(chainerx::Zeros({2}, chainerx::Dtype::kFloat32));
+    inputs.emplace("seq", std::shared_ptr<ChxVMVar>(new ChxVMVar(seq)));
+    inputs.emplace("x", std::shared_ptr<ChxVMVar>(new ChxVMVar(chainerx::Ones({2}, chainerx::Dtype::kFloat32))));
+    InOuts outputs = chxvm.Run(inputs, ChxVMOptions());
+    ASSERT_EQ(1, outputs.count("orig"));
+    ASSERT_EQ(1, outputs.count("copied"));
+    EXPECT_EQ(1, outputs["orig"]->GetSequence()->size());
+    EXPECT_EQ(2, outputs["copied"]->GetSequence()->size());
+    // The input given by the caller is not modified.
+    EXPECT_EQ(1, seq->size());
+    EXPECT_EQ(seq.get(), outputs["orig"]->GetSequence());
+}
+
+TEST(ChxVMTest, SequenceSliceAndExtendShareElements) {
+    chainerx::testing::ContextSession sess;
+
+    ChxVMSequence seq;
+    for (int i = 0; i < 4; ++i) seq.emplace_back(chainerx::Full({}, i, chainerx::Dtype::kInt64));
+
+    // A slice is a view of the same elements.
+    ChxVMSequence slice = seq.Slice(1, 3);
+    ASSERT_EQ(2, slice.size());
+    EXPECT_EQ(&seq[1], &slice[0]);
+    EXPECT_EQ(&seq[2], &slice.back());
+
+    // Extending the whole sequence appends to the shared buffer.
+    ChxVMSequence extended = seq;
+    extended.Extend(slice);
+    ASSERT_EQ(6, extended.size());
+    EXPECT_EQ(4, seq.size());
+    EXPECT_EQ(2, static_cast<int64_t>(chainerx::AsScalar(extended[5].GetArray())));
+
+    // Neither a write to a view nor an append to a view in the middle
+    // of the buffer is visible from the others.
+    slice[0] = ChxVMVar(chainerx::Full({}, 10, chainerx::Dtype::kInt64));
+    slice.push_back(ChxVMVar(chainerx::Full({}, 11, chainerx::Dtype::kInt64)));
+    seq.pop_back();
+    seq.push_back(ChxVMVar(chainerx::Full({}, 12, chainerx::Dtype::kInt64)));
+    ASSERT_EQ(3, slice.size());
+    EXPECT_EQ(10, static_cast<int64_t>(chainerx::AsScalar(slice[0].GetArray())));
+    EXPECT_EQ(11, static_cast<int64_t>(chainerx::AsScalar(slice[2].GetArray())));
+    EXPECT_EQ(1, static_cast<int64_t>(chainerx::AsScalar(seq[1].GetArray())));
+    EXPECT_EQ(12, static_cast<int64_t>(chainerx::AsScalar(seq[3].GetArray())));
+    EXPECT_EQ(3, static_cast<int64_t>(chainerx::AsScalar(extended[3].GetArray())));
+    EXPECT_EQ(1, static_cast<int64_t>(chainerx::AsScalar(extended[4].GetArray())));
+}
+
+TEST(ChxVMTest, MatchesShape) {
+    ChxVMTypeProto type;
+    type.add_shape(-1);
+    type.add_shape(3);
+    type.add_shape(-1);
+    type.add_dim_params("batch");
+    type.add_dim_params("");
+    type.add_dim_params("batch");
+
+    std::map<std::string, int64_t> bindings;
+    EXPECT_TRUE(MatchesShape(type, chainerx::Shape({2, 3, 2}), &bindings));
+    EXPECT_EQ(1, bindings.size());
+    EXPECT_EQ(2, bindings["batch"]);
+    // Dimensions with the same name must have the same size.
+    bindings.clear();
+    EXPECT_FALSE(MatchesShape(type, chainerx::Shape({2, 3, 4}), &bindings));
+    // A static dimension or the rank mismatches.
+    bindings.clear();
+    EXPECT_FALSE(MatchesShape(type, chainerx::Shape({2, 4, 2}), &bindings));
+    EXPECT_FALSE(MatchesShape(type, chainerx::Shape({2, 3}), &bindings));
+    // A size bound by another value.
+    bindings = {{"batch", 5}};
+    EXPECT_FALSE(MatchesShape(type, chainerx::Shape({2, 3, 2}), &bindings));
+    EXPECT_TRUE(MatchesShape(type, chainerx::Shape({5, 3, 5}), &bindings));
+
+    // Unnamed unknown dimensions match any size.
+    ChxVMTypeProto unnamed;
+    unnamed.add_shape(-1);
+    bindings.clear();
+    EXPECT_TRUE(MatchesShape(unnamed, chainerx::Shape({7}), &bindings));
+    EXPECT_TRUE(bindings.empty());
+}
+
 }  // namespace
 }  // namespace runtime
 }  // namespace chainer_compiler
@@ -63,6 +63,14 @@ ChxVMSequence* ChxVMVar::GetSequence() const {
     return absl::get<std::shared_ptr<ChxVMSequence>>(val_).get();
 }
 
+ChxVMSequence* ChxVMVar::GetMutableSequence() {
+    std::shared_ptr<ChxVMSequence>& seq = absl::get<std::shared_ptr<ChxVMSequence>>(val_);
+    if (seq.use_count() > 1) {
+        seq = std::make_shared<ChxVMSequence>(*seq);
+    }
+    return seq.get();
+}
+
 ChxVMOpaque* ChxVMVar::GetOpaque() const {
     return absl::get<std::shared_ptr<ChxVMOpaque>>(val_).get();
 }
@@ -199,6 +207,92 @@ bool ChxVMVar::IsArray() const {
     }
 }
 
+ChxVMSequence::ChxVMSequence() : buf_(std::make_shared<std::vector<ChxVMVar>>()) {
+}
+
+ChxVMSequence ChxVMSequence::Slice(size_t start, size_t end) const {
+    CHECK_LE(start, end);
+    CHECK_LE(end, size_);
+    ChxVMSequence seq(*this);
+    seq.offset_ = offset_ + start;
+    seq.size_ = end - start;
+    return seq;
+}
+
+ChxVMVar& ChxVMSequence::operator[](size_t i) {
+    PrepareWrite();
+    return (*buf_)[offset_ + i];
+}
+
+void ChxVMSequence::push_back(const ChxVMVar& v) {
+    // `v` may be an element of the buffer, which may be reallocated.
+    ChxVMVar copied(v);
+    emplace_back(copied);
+}
+
+void ChxVMSequence::pop_back() {
+    CHECK_LT(0, size_);
+    --size_;
+    if (buf_.use_count() == 1 && offset_ + size_ + 1 == buf_->size()) buf_->pop_back();
+}
+
+void ChxVMSequence::clear() {
+    if (buf_.use_count() == 1) {
+        buf_->clear();
+    } else {
+        buf_ = std::make_shared<std::vector<ChxVMVar>>();
+    }
+    offset_ = 0;
+    size_ = 0;
+}
+
+void ChxVMSequence::resize(size_t n) {
+    if (n <= size_) {
+        if (buf_.use_count() == 1 && offset_ + size_ == buf_->size()) buf_->resize(offset_ + n);
+        size_ = n;
+        return;
+    }
+    PrepareAppend();
+    buf_->resize(offset_ + n);
+    size_ = n;
+}
+
+void ChxVMSequence::reserve(size_t n) {
+    PrepareAppend();
+    buf_->reserve(offset_ + n);
+}
+
+void ChxVMSequence::Extend(const ChxVMSequence& other) {
+    if (empty()) {
+        *this = other;
+        return;
+    }
+    if (buf_ == other.buf_) {
+        // Elements of `other` may be invalidated by the reallocation of
+        // the buffer.
+        std::vector<ChxVMVar> elements(other.begin(), other.end());
+        PrepareAppend();
+        buf_->insert(buf_->end(), elements.begin(), elements.end());
+    } else {
+        PrepareAppend();
+        buf_->insert(buf_->end(), other.begin(), other.end());
+    }
+    size_ += other.size();
+}
+
+void ChxVMSequence::Detach() {
+    buf_ = std::make_shared<std::vector<ChxVMVar>>(begin(), end());
+    offset_ = 0;
+}
+
+void ChxVMSequence::PrepareWrite() {
+    if (buf_.use_count() > 1 || offset_ + size_ != buf_->size()) Detach();
+}
+
+void ChxVMSequence::PrepareAppend() {
+    if (offset_ + size_ != buf_->size()) Detach();
+}
+
 std::vector<chainerx::Array> NonOptional(const ChxVMSequence& seq) {
     std::vector<chainerx::Array> r;
     for (const ChxVMVar& v : seq) {
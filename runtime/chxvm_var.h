@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <absl/types/optional.h>
 #include <absl/types/variant.h>
 
@@ -10,9 +14,7 @@
 namespace chainer_compiler {
 namespace runtime {
 
-class ChxVMVar;
-
-typedef std::vector<ChxVMVar> ChxVMSequence;
+class ChxVMSequence;
 
 class ChxVMOpaque {
 public:
@@ -60,6 +62,7 @@ public:
 
     const chainerx::Array& GetArray() const;
     ChxVMSequence* GetSequence() const;
+    ChxVMSequence* GetMutableSequence();
     ChxVMOpaque* GetOpaque() const;
     const StrictScalar& GetScalar() const;
     const chainerx::Shape& GetShape() const;
@@ -94,6 +97,80 @@ private:
     mutable VarInternalType val_;
 };
 
+// A view of [offset, offset + size) of a buffer of ChxVMVar. Copies
+// and slices of a sequence share the buffer so they are O(1).
+//
+// Elements visible from a shared buffer are never modified. Writing
+// an element copies the view into a new buffer if the buffer is
+// shared. Appending to a view which ends at the end of the buffer
+// extends the buffer in-place even if it is shared, as no other view
+// can see the appended elements. Note appending may invalidate
+// iterators of other views of the same buffer.
+//
+// Copies of a ChxVMVar share the same sequence. Ops which modify a
+// sequence in-place must obtain it by `GetMutableSequence`, which
+// copies the sequence if it is shared (copy-on-write).
+class ChxVMSequence {
+public:
+    typedef std::vector<ChxVMVar>::const_iterator const_iterator;
+
+    ChxVMSequence();
+
+    // Returns a view of [start, end) which shares the buffer.
+    ChxVMSequence Slice(size_t start, size_t end) const;
+
+    size_t size() const {
+        return size_;
+    }
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    const_iterator begin() const {
+        return buf_->begin() + offset_;
+    }
+    const_iterator end() const {
+        return begin() + size_;
+    }
+
+    const ChxVMVar& operator[](size_t i) const {
+        return (*buf_)[offset_ + i];
+    }
+    const ChxVMVar& back() const {
+        return (*buf_)[offset_ + size_ - 1];
+    }
+
+    ChxVMVar& operator[](size_t i);
+
+    void push_back(const ChxVMVar& v);
+    template <class... Args>
+    void emplace_back(Args&&... args) {
+        PrepareAppend();
+        buf_->emplace_back(std::forward<Args>(args)...);
+        ++size_;
+    }
+    void pop_back();
+    void clear();
+    void resize(size_t n);
+    void reserve(size_t n);
+
+    // Appends elements of `other`. This shares the buffer of `other`
+    // if `this` is empty.
+    void Extend(const ChxVMSequence& other);
+
+private:
+    // Moves the elements of the view to a new buffer.
+    void Detach();
+    // Makes the buffer writable.
+    void PrepareWrite();
+    // Makes the view end at the end of the buffer.
+    void PrepareAppend();
+
+    std::shared_ptr<std::vector<ChxVMVar>> buf_;
+    size_t offset_{0};
+    size_t size_{0};
+};
+
 std::vector<chainerx::Array> NonOptional(const ChxVMSequence& seq);
 
 std::ostream& operator<<(std::ostream& os, const ChxVMVar::Kind& kind);
@@ -251,17 +251,20 @@ def gen_gen_chxvm_ops_cc():
                              op.name)
                 for typ, oname in op.outputs:
                     if typ in ARG_TYPES and typ != ARRAY_LIST:
-                        lines.append('st->SetVar(%s, ChxVMVar());' % oname)
+                        lines.append('if (%s >= 0) st->SetVar(%s, ChxVMVar());' %
+                                     (oname, oname))
                 lines.append('return;')
                 lines.append('}')
 
+            contiguous = '' if op.accepts_strided else 'Contiguous'
             for typ, name in op.inputs:
                 if typ == ARRAY:
-                    args.append('st->GetArray(%s)' % name)
+                    args.append('st->Get%sArray(%s)' % (contiguous, name))
                 elif typ == OPTIONAL_ARRAY:
-                    args.append('st->GetOptionalArray(%s)' % name)
+                    args.append('st->GetOptional%sArray(%s)' %
+                                (contiguous, name))
                 elif typ == ARRAY_LIST:
-                    args.append('st->GetArrayList(%s)' % name)
+                    args.append('st->Get%sArrayList(%s)' % (contiguous, name))
                 elif typ == SEQUENCE:
                     args.append('*st->GetSequence(%s)' % name)
                 elif typ == OPAQUE:
@@ -343,6 +346,17 @@ def gen_gen_chxvm_ops_cc():
     lines.append('}')
     lines.append('}')
 
+    lines.append('bool AcceptsStridedInputs(ChxVMInstructionProto::Op op) {')
+    lines.append('switch (op) {')
+    for op in CHX_ALL_OPS:
+        if not op.accepts_strided:
+            lines.append('case ChxVMInstructionProto::%s:' % (op.name))
+    lines.append('return false;')
+    lines.append('default:')
+    lines.append('return true;')
+    lines.append('}')
+    lines.append('}')
+
     with open(output_dir + '/gen_chxvm_ops.cc', 'w') as f:
         f.write(r'''// Auto-generated by gen_chxvm.py
 
@@ -1,3 +1,6 @@
+#include <chainerx/dtype.h>
+#include <chainerx/scalar.h>
+
 #include <common/log.h>
 #include <runtime/gen_chxvm_ops.h>
 
@@ -20,5 +23,28 @@ void JmpFalseOp::RunImpl(ChxVMState* st, const StrictScalar& cond) {
     }
 }
 
+StrictScalar ScalarGreaterOp::RunImpl(ChxVMState* st, const StrictScalar& a, const StrictScalar& b) {
+    bool c;
+    if (GetKind(a.dtype()) == chainerx::DtypeKind::kFloat || GetKind(b.dtype()) == chainerx::DtypeKind::kFloat) {
+        c = static_cast<double>(a) > static_cast<double>(b);
+    } else {
+        c = static_cast<int64_t>(a) > static_cast<int64_t>(b);
+    }
+    return StrictScalar(chainerx::Dtype::kBool, chainerx::Scalar(c), true);
+}
+
+void ScalarIncrementOp::RunImpl(ChxVMState* st) {
+    const StrictScalar v = st->GetScalar(x);
+    CHECK_NE(chainerx::DtypeKind::kFloat, GetKind(v.dtype())) << "Only integers can be incremented";
+    st->FreeVar(x);
+    st->SetScalar(x, StrictScalar(v.dtype(), chainerx::Scalar(static_cast<int64_t>(v) + 1), v.host()));
+}
+
+void ScalarAndOp::RunImpl(ChxVMState* st) {
+    const bool v = static_cast<bool>(st->GetScalar(x)) && static_cast<bool>(st->GetScalar(y));
+    st->FreeVar(x);
+    st->SetScalar(x, StrictScalar(chainerx::Dtype::kBool, chainerx::Scalar(v), true));
+}
+
 }  // namespace runtime
 }  // namespace chainer_compiler
@@ -133,7 +133,9 @@ void GenericGetSliceOp::RunImpl(ChxVMState* st) {
         case ChxVMVar::Kind::kSequence: {
             const ChxVMSequence& v = *var->GetSequence();
             ChxVMSequence* seq = st->CreateSequence(output);
-            if (step > 0) {
+            if (step == 1) {
+                *seq = v.Slice(start, std::max(start, end));
+            } else if (step > 0) {
                 for (int64_t i = start; i < end; i += step) {
                     CHECK_LE(0, i);
                     CHECK_LT(i, v.size());
@@ -171,7 +173,7 @@ void GenericAddOp::RunImpl(ChxVMState* st) {
     } else {
         ChxVMSequence* seq = st->CreateSequence(output);
         *seq = *var0->GetSequence();
-        for (const auto& a : *var1->GetSequence()) seq->push_back(a);
+        seq->Extend(*var1->GetSequence());
     }
 }
 
@@ -0,0 +1,447 @@
+#include "runtime/ops/native_rnn.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <vector>
+
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/linalg.h>
+#include <chainerx/routines/manipulation.h>
+
+#include <common/log.h>
+#include <runtime/chainerx_util.h>
+
+namespace chainer_compiler {
+namespace runtime {
+
+namespace {
+
+const chainerx::Array* OptionalPtr(const absl::optional<chainerx::Array>& a) {
+    return a.has_value() ? &*a : nullptr;
+}
+
+bool IsSupported(
+        const chainerx::Array& x,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        std::initializer_list<const chainerx::Array*> arrays) {
+    if (!IsNativeDevice(&x.device()) || x.dtype() != chainerx::Dtype::kFloat32 || x.ndim() != 3) {
+        return false;
+    }
+    if (sequence_lens.has_value() && &sequence_lens->device() != &x.device()) {
+        return false;
+    }
+    for (const chainerx::Array* a : arrays) {
+        if (a && (a->dtype() != chainerx::Dtype::kFloat32 || &a->device() != &x.device())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline float SigmoidScalar(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+// Computes `gates[i] += h[i] * rt` for each of `batch_size` rows,
+// where `h` is (batch_size, hidden_size), `rt` is (hidden_size, n),
+// and `gates` is (batch_size, n). Columns are processed in blocks so
+// a block of `rt` stays in cache while batch rows are swept. The
+// innermost loop is contiguous so it is vectorized.
+void AddRecurrentGemm(int64_t batch_size, int64_t hidden_size, int64_t n, const float* h, const float* rt, float* gates) {
+    constexpr int64_t kBlockN = 512;
+    for (int64_t j0 = 0; j0 < n; j0 += kBlockN) {
+        const int64_t j1 = std::min(n, j0 + kBlockN);
+        for (int64_t i = 0; i < batch_size; ++i) {
+            const float* hi = h + i * hidden_size;
+            float* gi = gates + i * n;
+            for (int64_t k = 0; k < hidden_size; ++k) {
+                const float hv = hi[k];
+                const float* rk = rt + k * n;
+                for (int64_t j = j0; j < j1; ++j) {
+                    gi[j] += hv * rk[j];
+                }
+            }
+        }
+    }
+}
+
+// Returns `b[d][begin:begin+size]` or zeros.
+std::vector<float> GetBias(const absl::optional<chainerx::Array>& b, int d, int64_t begin, int64_t size) {
+    std::vector<float> bias(size);
+    if (b.has_value()) {
+        chainerx::Array bs = chainerx::AsContiguous(b->At({d}));
+        const float* p = RawPtr<float>(bs) + begin;
+        std::copy(p, p + size, bias.begin());
+    }
+    return bias;
+}
+
+std::vector<float> AddBiases(std::vector<float> a, const std::vector<float>& b) {
+    CHECK_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] += b[i];
+    }
+    return a;
+}
+
+// Returns (hidden_size, size) `r[d][begin:begin+size]^T`. No copy is
+// made when `r` is prepacked by ChxVM and the whole `r[d]` is used.
+chainerx::Array GetRecurrentWeight(const chainerx::Array& r, int d, int64_t begin, int64_t size) {
+    return chainerx::AsContiguous(chainerx::Transpose(r.At({d}).At({chainerx::Slice(begin, begin + size)})));
+}
+
+// States and outputs shared by RNN, GRU, and LSTM. When
+// `sequence_lens` is specified, the batch is sorted by length in
+// descending order and only the rows which are still active are
+// computed at each timestep, like cuDNN's packed layout. `X * W^T` is
+// also computed only for the packed rows. Indices of rows in the
+// packed order are translated back when outputs are written.
+class FusedRNN {
+public:
+    FusedRNN(
+            const chainerx::Array& x,
+            const chainerx::Array& w,
+            const absl::optional<chainerx::Array>& sequence_lens,
+            int64_t hidden_size,
+            int direction)
+        : x_(x),
+          seq_length_(x.shape()[0]),
+          batch_size_(x.shape()[1]),
+          hidden_size_(hidden_size),
+          num_directions_(w.shape()[0]),
+          direction_(direction),
+          packed_(sequence_lens.has_value()) {
+        CHECK_EQ(direction == 2 ? 2 : 1, num_directions_);
+        order_.resize(batch_size_);
+        for (int64_t i = 0; i < batch_size_; ++i) {
+            order_[i] = i;
+        }
+        batch_sizes_.assign(seq_length_, batch_size_);
+        if (packed_) {
+            CHECK_EQ(1, sequence_lens->ndim());
+            CHECK_EQ(batch_size_, sequence_lens->shape()[0]);
+            chainerx::Array lens_array = chainerx::AsContiguous(sequence_lens->AsType(chainerx::Dtype::kInt64));
+            const int64_t* lens = RawPtr<int64_t>(lens_array);
+            std::stable_sort(order_.begin(), order_.end(), [lens](int64_t a, int64_t b) { return lens[a] > lens[b]; });
+            for (int64_t time = 0; time < seq_length_; ++time) {
+                batch_sizes_[time] = std::count_if(lens, lens + batch_size_, [time](int64_t len) { return time < len; });
+            }
+        }
+        offsets_.resize(seq_length_ + 1);
+        offsets_[0] = 0;
+        for (int64_t time = 0; time < seq_length_; ++time) {
+            offsets_[time + 1] = offsets_[time] + batch_sizes_[time];
+        }
+        y_ = chainerx::Zeros({seq_length_, num_directions_, batch_size_, hidden_size_}, x.dtype(), x.device());
+    }
+
+    int64_t seq_length() const {
+        return seq_length_;
+    }
+    int64_t batch_size() const {
+        return batch_size_;
+    }
+    int num_directions() const {
+        return num_directions_;
+    }
+    const chainerx::Array& y() const {
+        return y_;
+    }
+
+    int64_t GetTime(int d, int64_t t) const {
+        return (direction_ == 1 || d == 1) ? seq_length_ - t - 1 : t;
+    }
+
+    // Returns the number of active rows at `time`. They are the first
+    // rows in the packed order.
+    int64_t GetBatchSize(int64_t time) const {
+        return batch_sizes_[time];
+    }
+
+    float* GetOutput(int d, int64_t time, int64_t i) const {
+        return RawPtr<float>(y_) + ((time * num_directions_ + d) * batch_size_ + order_[i]) * hidden_size_;
+    }
+
+    // Returns (packed rows, n) `X * w^T` for (n, input_size) `w`.
+    chainerx::Array InputGemm(const chainerx::Array& w) const {
+        const int64_t input_size = x_.shape()[2];
+        chainerx::Array xs;
+        if (packed_) {
+            const chainerx::Array x = chainerx::AsContiguous(x_);
+            xs = chainerx::Empty({offsets_[seq_length_], input_size}, x.dtype(), x.device());
+            for (int64_t time = 0; time < seq_length_; ++time) {
+                for (int64_t i = 0; i < batch_sizes_[time]; ++i) {
+                    const float* src = RawPtr<float>(x) + (time * batch_size_ + order_[i]) * input_size;
+                    std::copy(src, src + input_size, RawPtr<float>(xs) + (offsets_[time] + i) * input_size);
+                }
+            }
+        } else {
+            xs = x_.Reshape({seq_length_ * batch_size_, input_size});
+        }
+        return chainerx::AsContiguous(chainerx::Dot(xs, chainerx::Transpose(w)));
+    }
+
+    // Returns the rows of `X * W^T` for `time`.
+    const float* GetInput(const chainerx::Array& xw, int64_t time) const {
+        return RawPtr<float>(xw) + offsets_[time] * xw.shape()[1];
+    }
+
+    // Returns a (num_directions, batch_size, hidden_size) array in the
+    // packed order which holds the state updated in-place.
+    chainerx::Array InitialState(const absl::optional<chainerx::Array>& initial) const {
+        if (!initial.has_value()) {
+            return chainerx::Zeros({num_directions_, batch_size_, hidden_size_}, x_.dtype(), x_.device());
+        }
+        const chainerx::Array state = chainerx::AsContiguous(*initial);
+        chainerx::Array packed = chainerx::Empty(state.shape(), state.dtype(), state.device());
+        for (int d = 0; d < num_directions_; ++d) {
+            for (int64_t i = 0; i < batch_size_; ++i) {
+                const float* src = RawPtr<float>(state) + (d * batch_size_ + order_[i]) * hidden_size_;
+                std::copy(src, src + hidden_size_, RawPtr<float>(packed) + (d * batch_size_ + i) * hidden_size_);
+            }
+        }
+        return packed;
+    }
+
+    // Restores the original order of a state.
+    chainerx::Array FinalState(const chainerx::Array& packed) const {
+        if (!packed_) {
+            return packed;
+        }
+        chainerx::Array state = chainerx::Empty(packed.shape(), packed.dtype(), packed.device());
+        for (int d = 0; d < num_directions_; ++d) {
+            for (int64_t i = 0; i < batch_size_; ++i) {
+                const float* src = RawPtr<float>(packed) + (d * batch_size_ + i) * hidden_size_;
+                std::copy(src, src + hidden_size_, RawPtr<float>(state) + (d * batch_size_ + order_[i]) * hidden_size_);
+            }
+        }
+        return state;
+    }
+
+private:
+    const chainerx::Array x_;
+    const int64_t seq_length_;
+    const int64_t batch_size_;
+    const int64_t hidden_size_;
+    const int num_directions_;
+    const int direction_;
+    const bool packed_;
+    // The original index of each row in the packed order.
+    std::vector<int64_t> order_;
+    // The number of active rows for each time.
+    std::vector<int64_t> batch_sizes_;
+    // The offset of the first packed row for each time.
+    std::vector<int64_t> offsets_;
+    chainerx::Array y_;
+};
+
+}  // namespace
+
+bool NativeRNN(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array>* result) {
+    if (!IsSupported(x, sequence_lens, {&w, &r, OptionalPtr(b), OptionalPtr(initial_h)})) {
+        return false;
+    }
+
+    const int64_t hidden_size = w.shape()[1];
+    FusedRNN rnn(x, w, sequence_lens, hidden_size, direction);
+    const int64_t batch_size = rnn.batch_size();
+    chainerx::Array hs = rnn.InitialState(initial_h);
+    std::vector<float> gates(batch_size * hidden_size);
+
+    for (int d = 0; d < rnn.num_directions(); ++d) {
+        const chainerx::Array xw = rnn.InputGemm(w.At({d}));
+        const chainerx::Array rt = GetRecurrentWeight(r, d, 0, hidden_size);
+        const std::vector<float> bias = AddBiases(GetBias(b, d, 0, hidden_size), GetBias(b, d, hidden_size, hidden_size));
+        float* h = RawPtr<float>(hs) + d * batch_size * hidden_size;
+
+        for (int64_t t = 0; t < rnn.seq_length(); ++t) {
+            const int64_t time = rnn.GetTime(d, t);
+            const int64_t n = rnn.GetBatchSize(time);
+            const float* xwt = rnn.GetInput(xw, time);
+            for (int64_t i = 0; i < n; ++i) {
+                for (int64_t k = 0; k < hidden_size; ++k) {
+                    gates[i * hidden_size + k] = xwt[i * hidden_size + k] + bias[k];
+                }
+            }
+            AddRecurrentGemm(n, hidden_size, hidden_size, h, RawPtr<float>(rt), gates.data());
+
+            for (int64_t i = 0; i < n; ++i) {
+                const float* gi = &gates[i * hidden_size];
+                float* hi = h + i * hidden_size;
+                float* yi = rnn.GetOutput(d, time, i);
+                for (int64_t k = 0; k < hidden_size; ++k) {
+                    hi[k] = yi[k] = std::tanh(gi[k]);
+                }
+            }
+        }
+    }
+
+    *result = std::make_tuple(rnn.y(), rnn.FinalState(hs));
+    return true;
+}
+
+bool NativeGRU(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        int linear_before_reset,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array>* result) {
+    if (!IsSupported(x, sequence_lens, {&w, &r, OptionalPtr(b), OptionalPtr(initial_h)})) {
+        return false;
+    }
+
+    CHECK_EQ(0, w.shape()[1] % 3);
+    const int64_t hidden_size = w.shape()[1] / 3;
+    FusedRNN rnn(x, w, sequence_lens, hidden_size, direction);
+    const int64_t batch_size = rnn.batch_size();
+    const int64_t num_gates = 3 * hidden_size;
+    chainerx::Array hs = rnn.InitialState(initial_h);
+    // Update and reset gates.
+    std::vector<float> zr(batch_size * 2 * hidden_size);
+    // The recurrent part of the hidden gate.
+    std::vector<float> hr(batch_size * hidden_size);
+    // `r * h` for linear_before_reset=0.
+    std::vector<float> rh(batch_size * hidden_size);
+
+    for (int d = 0; d < rnn.num_directions(); ++d) {
+        const chainerx::Array xw = rnn.InputGemm(w.At({d}));
+        const chainerx::Array rt_zr = GetRecurrentWeight(r, d, 0, 2 * hidden_size);
+        const chainerx::Array rt_h = GetRecurrentWeight(r, d, 2 * hidden_size, hidden_size);
+        const std::vector<float> zr_bias = AddBiases(GetBias(b, d, 0, 2 * hidden_size), GetBias(b, d, num_gates, 2 * hidden_size));
+        const std::vector<float> wb_h = GetBias(b, d, 2 * hidden_size, hidden_size);
+        const std::vector<float> rb_h = GetBias(b, d, num_gates + 2 * hidden_size, hidden_size);
+        float* h = RawPtr<float>(hs) + d * batch_size * hidden_size;
+
+        for (int64_t t = 0; t < rnn.seq_length(); ++t) {
+            const int64_t time = rnn.GetTime(d, t);
+            const int64_t n = rnn.GetBatchSize(time);
+            const float* xwt = rnn.GetInput(xw, time);
+            for (int64_t i = 0; i < n; ++i) {
+                for (int64_t k = 0; k < 2 * hidden_size; ++k) {
+                    zr[i * 2 * hidden_size + k] = xwt[i * num_gates + k] + zr_bias[k];
+                }
+            }
+            AddRecurrentGemm(n, hidden_size, 2 * hidden_size, h, RawPtr<float>(rt_zr), zr.data());
+            for (int64_t i = 0; i < n * 2 * hidden_size; ++i) {
+                zr[i] = SigmoidScalar(zr[i]);
+            }
+
+            for (int64_t i = 0; i < n; ++i) {
+                std::copy(rb_h.begin(), rb_h.end(), &hr[i * hidden_size]);
+            }
+            if (linear_before_reset) {
+                AddRecurrentGemm(n, hidden_size, hidden_size, h, RawPtr<float>(rt_h), hr.data());
+            } else {
+                for (int64_t i = 0; i < n; ++i) {
+                    const float* ri = &zr[i * 2 * hidden_size + hidden_size];
+                    for (int64_t k = 0; k < hidden_size; ++k) {
+                        rh[i * hidden_size + k] = ri[k] * h[i * hidden_size + k];
+                    }
+                }
+                AddRecurrentGemm(n, hidden_size, hidden_size, rh.data(), RawPtr<float>(rt_h), hr.data());
+            }
+
+            for (int64_t i = 0; i < n; ++i) {
+                const float* zi = &zr[i * 2 * hidden_size];
+                const float* ri = zi + hidden_size;
+                const float* xhi = xwt + i * num_gates + 2 * hidden_size;
+                const float* hri = &hr[i * hidden_size];
+                float* hi = h + i * hidden_size;
+                float* yi = rnn.GetOutput(d, time, i);
+                for (int64_t k = 0; k < hidden_size; ++k) {
+                    const float hh = linear_before_reset ? xhi[k] + wb_h[k] + ri[k] * hri[k] : xhi[k] + wb_h[k] + hri[k];
+                    const float nh = std::tanh(hh);
+                    hi[k] = yi[k] = (1 - zi[k]) * nh + zi[k] * hi[k];
+                }
+            }
+        }
+    }
+
+    *result = std::make_tuple(rnn.y(), rnn.FinalState(hs));
+    return true;
+}
+
+bool NativeLSTM(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        const absl::optional<chainerx::Array>& initial_c,
+        const absl::optional<chainerx::Array>& p,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array, chainerx::Array>* result) {
+    if (!IsSupported(x, sequence_lens, {&w, &r, OptionalPtr(b), OptionalPtr(initial_h), OptionalPtr(initial_c), OptionalPtr(p)})) {
+        return false;
+    }
+
+    CHECK_EQ(0, w.shape()[1] % 4);
+    const int64_t hidden_size = w.shape()[1] / 4;
+    FusedRNN rnn(x, w, sequence_lens, hidden_size, direction);
+    const int64_t batch_size = rnn.batch_size();
+    const int64_t num_gates = 4 * hidden_size;
+    chainerx::Array hs = rnn.InitialState(initial_h);
+    chainerx::Array cs = rnn.InitialState(initial_c);
+    std::vector<float> gates(batch_size * num_gates);
+
+    for (int d = 0; d < rnn.num_directions(); ++d) {
+        const chainerx::Array xw = rnn.InputGemm(w.At({d}));
+        const chainerx::Array rt = GetRecurrentWeight(r, d, 0, num_gates);
+        const std::vector<float> bias = AddBiases(GetBias(b, d, 0, num_gates), GetBias(b, d, num_gates, num_gates));
+        // Peepholes for input, output, and forget gates.
+        const std::vector<float> pi = GetBias(p, d, 0, hidden_size);
+        const std::vector<float> po = GetBias(p, d, hidden_size, hidden_size);
+        const std::vector<float> pf = GetBias(p, d, 2 * hidden_size, hidden_size);
+        float* h = RawPtr<float>(hs) + d * batch_size * hidden_size;
+        float* c = RawPtr<float>(cs) + d * batch_size * hidden_size;
+
+        for (int64_t t = 0; t < rnn.seq_length(); ++t) {
+            const int64_t time = rnn.GetTime(d, t);
+            const int64_t n = rnn.GetBatchSize(time);
+            const float* xwt = rnn.GetInput(xw, time);
+            for (int64_t i = 0; i < n * num_gates; ++i) {
+                gates[i] = xwt[i] + bias[i % num_gates];
+            }
+            AddRecurrentGemm(n, hidden_size, num_gates, h, RawPtr<float>(rt), gates.data());
+
+            for (int64_t i = 0; i < n; ++i) {
+                // Gates are in the order of input, output, forget, and cell.
+                const float* ig = &gates[i * num_gates];
+                const float* og = ig + hidden_size;
+                const float* fg = og + hidden_size;
+                const float* cg = fg + hidden_size;
+                float* hi = h + i * hidden_size;
+                float* ci = c + i * hidden_size;
+                float* yi = rnn.GetOutput(d, time, i);
+                for (int64_t k = 0; k < hidden_size; ++k) {
+                    const float iv = SigmoidScalar(ig[k] + pi[k] * ci[k]);
+                    const float fv = SigmoidScalar(fg[k] + pf[k] * ci[k]);
+                    const float nc = fv * ci[k] + iv * std::tanh(cg[k]);
+                    const float ov = SigmoidScalar(og[k] + po[k] * nc);
+                    ci[k] = nc;
+                    hi[k] = yi[k] = ov * std::tanh(nc);
+                }
+            }
+        }
+    }
+
+    *result = std::make_tuple(rnn.y(), rnn.FinalState(hs), rnn.FinalState(cs));
+    return true;
+}
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <tuple>
+
+#include <absl/types/optional.h>
+
+#include <chainerx/array.h>
+
+namespace chainer_compiler {
+namespace runtime {
+
+// Fused RNN kernels for float32 arrays on native devices. `X * W^T`
+// for all timesteps is computed by a single GEMM up front, and then
+// the recurrent GEMM and the gate computation of each timestep run in
+// a single loop nest which writes directly into the outputs. When
+// `sequence_lens` is given (e.g., NStepLSTM lowered via
+// ChainerSequencePad), the batch is packed by length so finished
+// sequences cost nothing in later timesteps. They do not record
+// anything for backpropagation and return false when the inputs are
+// not supported.
+
+bool NativeRNN(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array>* result);
+
+bool NativeGRU(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        int linear_before_reset,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array>* result);
+
+bool NativeLSTM(
+        const chainerx::Array& x,
+        const chainerx::Array& w,
+        const chainerx::Array& r,
+        const absl::optional<chainerx::Array>& b,
+        const absl::optional<chainerx::Array>& sequence_lens,
+        const absl::optional<chainerx::Array>& initial_h,
+        const absl::optional<chainerx::Array>& initial_c,
+        const absl::optional<chainerx::Array>& p,
+        int direction,
+        std::tuple<chainerx::Array, chainerx::Array, chainerx::Array>* result);
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <limits>
+
+#include <chainerx/array.h>
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/linalg.h>
+#include <chainerx/routines/manipulation.h>
+#include <chainerx/routines/normalization.h>
+
+#include <common/log.h>
+#include <runtime/chainerx_util.h>
+#include <runtime/gen_chxvm_ops.h>
+
+namespace chainer_compiler {
+namespace runtime {
+
+namespace {
+
+// A 2D sliding window over an NHWC input. `pads` may be asymmetric
+// in the ONNX order, i.e., (top, left, bottom, right).
+struct Window2D {
+    Window2D(const chainerx::Shape& x_shape, int64_t kh, int64_t kw, const Int64StackVector& strides, const Int64StackVector& pads, bool cover_all)
+        : batch_size(x_shape[0]), height(x_shape[1]), width(x_shape[2]), channels(x_shape[3]), kh(kh), kw(kw) {
+        CHECK(strides.empty() || strides.size() == 2) << "Unsupported strides: " << strides.size();
+        CHECK(pads.empty() || pads.size() == 4) << "Unsupported pads: " << pads.size();
+        sh = strides.empty() ? 1 : strides[0];
+        sw = strides.empty() ? 1 : strides[1];
+        pad_t = pads.empty() ? 0 : pads[0];
+        pad_l = pads.empty() ? 0 : pads[1];
+        const int64_t pad_b = pads.empty() ? 0 : pads[2];
+        const int64_t pad_r = pads.empty() ? 0 : pads[3];
+        padded_height = height + pad_t + pad_b;
+        padded_width = width + pad_l + pad_r;
+        out_height = (padded_height - kh + (cover_all ? sh - 1 : 0)) / sh + 1;
+        out_width = (padded_width - kw + (cover_all ? sw - 1 : 0)) / sw + 1;
+        CHECK_LT(0, out_height);
+        CHECK_LT(0, out_width);
+    }
+
+    int64_t num_pixels() const {
+        return batch_size * out_height * out_width;
+    }
+
+    // Calls `fn(iy, ix)` for positions in the window of the output
+    // pixel `r` which are inside of the input.
+    template <class Fn>
+    void ForEach(int64_t r, Fn fn) const {
+        const int64_t oy = r / out_width % out_height;
+        const int64_t ox = r % out_width;
+        const int64_t y0 = oy * sh - pad_t;
+        const int64_t x0 = ox * sw - pad_l;
+        for (int64_t iy = std::max<int64_t>(y0, 0); iy < std::min(y0 + kh, height); ++iy) {
+            for (int64_t ix = std::max<int64_t>(x0, 0); ix < std::min(x0 + kw, width); ++ix) {
+                fn(iy, ix);
+            }
+        }
+    }
+
+    // The number of positions in the window of `r` which are inside
+    // of the padded input.
+    int64_t PaddedWindowSize(int64_t r) const {
+        const int64_t oy = r / out_width % out_height;
+        const int64_t ox = r % out_width;
+        const int64_t y0 = oy * sh;
+        const int64_t x0 = ox * sw;
+        return (std::min(y0 + kh, padded_height) - y0) * (std::min(x0 + kw, padded_width) - x0);
+    }
+
+    // Returns the offset of (n, iy, ix, 0) in the input.
+    int64_t InputOffset(int64_t r, int64_t iy, int64_t ix) const {
+        const int64_t n = r / (out_height * out_width);
+        return ((n * height + iy) * width + ix) * channels;
+    }
+
+    const int64_t batch_size;
+    const int64_t height;
+    const int64_t width;
+    const int64_t channels;
+    const int64_t kh;
+    const int64_t kw;
+    int64_t sh;
+    int64_t sw;
+    int64_t pad_t;
+    int64_t pad_l;
+    int64_t padded_height;
+    int64_t padded_width;
+    int64_t out_height;
+    int64_t out_width;
+};
+
+// NHWC kernels are implemented for contiguous float32 arrays on the
+// host. Other arrays are converted and converted back. Arrays which
+// need no conversion (e.g., OHWI weights) are not copied.
+chainerx::Array ToHostFloat(const chainerx::Array& x) {
+    return chainerx::AsContiguous(x.ToNative().AsType(chainerx::Dtype::kFloat32, false));
+}
+
+chainerx::Array FromHostFloat(const chainerx::Array& y, const chainerx::Array& like) {
+    chainerx::Array r = y;
+    if (r.dtype() != like.dtype()) {
+        r = r.AsType(like.dtype());
+    }
+    return r.ToDevice(like.device());
+}
+
+template <bool is_max>
+chainerx::Array PoolNHWC(
+        const chainerx::Array& in_x,
+        const Int64StackVector& kernel_shape,
+        const Int64StackVector& strides,
+        const Int64StackVector& pads,
+        bool cover_all,
+        bool count_include_pad) {
+    CHECK_EQ(4, in_x.ndim());
+    CHECK_EQ(2, kernel_shape.size());
+    const chainerx::Array x = ToHostFloat(in_x);
+    const Window2D win(x.shape(), kernel_shape[0], kernel_shape[1], strides, pads, cover_all);
+    const int64_t channels = win.channels;
+    chainerx::Array y = chainerx::Empty({win.batch_size, win.out_height, win.out_width, channels}, x.dtype(), x.device());
+    const float* xp = RawPtr<const float>(x);
+    float* yp = RawPtr<float>(y);
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t r = 0; r < win.num_pixels(); ++r) {
+        float* d = yp + r * channels;
+        std::fill(d, d + channels, is_max ? -std::numeric_limits<float>::infinity() : 0.0f);
+        int64_t count = 0;
+        win.ForEach(r, [&](int64_t iy, int64_t ix) {
+            const float* s = xp + win.InputOffset(r, iy, ix);
+            // Channels are contiguous so this loop is vectorized.
+            for (int64_t c = 0; c < channels; ++c) {
+                d[c] = is_max ? std::max(d[c], s[c]) : d[c] + s[c];
+            }
+            ++count;
+        });
+        if (!is_max) {
+            const float scale = 1.0f / (count_include_pad ? win.PaddedWindowSize(r) : std::max<int64_t>(count, 1));
+            for (int64_t c = 0; c < channels; ++c) {
+                d[c] *= scale;
+            }
+        }
+    }
+    return FromHostFloat(y, in_x);
+}
+
+}  // namespace
+
+chainerx::Array ConvNHWCOp::RunImpl(
+        ChxVMState* st, const chainerx::Array& in_x, const chainerx::Array& in_w, const absl::optional<chainerx::Array>& b) {
+    CHECK_EQ(4, in_x.ndim());
+    CHECK_EQ(4, in_w.ndim());
+    const chainerx::Array x = ToHostFloat(in_x);
+    const chainerx::Array w = ToHostFloat(in_w);
+    const int64_t out_channels = w.shape()[0];
+    const Window2D win(x.shape(), w.shape()[1], w.shape()[2], strides, pads, false);
+    CHECK_EQ(win.channels, w.shape()[3]) << "Channel mismatch: x=" << x.shape() << " w=" << w.shape();
+    const int64_t patch_size = win.kh * win.kw * win.channels;
+
+    // im2col for NHWC copies contiguous runs of `channels` elements,
+    // and it is not necessary for 1x1 convolutions without strides.
+    chainerx::Array col;
+    if (win.kh == 1 && win.kw == 1 && win.sh == 1 && win.sw == 1 && win.pad_t == 0 && win.pad_l == 0 &&
+        win.out_height == win.height && win.out_width == win.width) {
+        col = x.Reshape({win.num_pixels(), patch_size});
+    } else {
+        col = chainerx::Empty({win.num_pixels(), patch_size}, x.dtype(), x.device());
+        const float* xp = RawPtr<const float>(x);
+        float* cp = RawPtr<float>(col);
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+        for (int64_t r = 0; r < win.num_pixels(); ++r) {
+            float* row = cp + r * patch_size;
+            std::fill(row, row + patch_size, 0.0f);
+            const int64_t oy = r / win.out_width % win.out_height;
+            const int64_t ox = r % win.out_width;
+            win.ForEach(r, [&](int64_t iy, int64_t ix) {
+                const int64_t ky = iy - (oy * win.sh - win.pad_t);
+                const int64_t kx = ix - (ox * win.sw - win.pad_l);
+                const float* s = xp + win.InputOffset(r, iy, ix);
+                std::copy(s, s + win.channels, row + (ky * win.kw + kx) * win.channels);
+            });
+        }
+    }
+
+    // (pixels, KH*KW*C) x (O, KH*KW*C)^T => (pixels, O).
+    chainerx::Array y = chainerx::Dot(col, chainerx::Transpose(w.Reshape({out_channels, patch_size})));
+    if (b.has_value()) {
+        y += ToHostFloat(*b);
+    }
+    return FromHostFloat(y.Reshape({win.batch_size, win.out_height, win.out_width, out_channels}), in_x);
+}
+
+chainerx::Array MaxPoolNHWCOp::RunImpl(ChxVMState* st, const chainerx::Array& x) {
+    return PoolNHWC<true>(x, kernel_shape, strides, pads, cover_all, false);
+}
+
+chainerx::Array AveragePoolNHWCOp::RunImpl(ChxVMState* st, const chainerx::Array& x) {
+    return PoolNHWC<false>(x, kernel_shape, strides, pads, false, count_include_pad);
+}
+
+chainerx::Array FixedBatchNormalizationNHWCOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& x,
+        const chainerx::Array& s,
+        const chainerx::Array& bias,
+        const chainerx::Array& mean,
+        const chainerx::Array& var) {
+    // To workaround the limitation of CuDNN.
+    if (epsilon <= 1e-5) epsilon = 1e-5 + 1e-12;
+    chainerx::Axes axes;
+    for (int i = 0; i < x.ndim() - 1; ++i) {
+        axes.push_back(i);
+    }
+    return chainerx::FixedBatchNorm(x, s, bias, mean, var, epsilon, axes);
+}
+
+}  // namespace runtime
+}  // namespace chainer_compiler
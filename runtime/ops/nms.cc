@@ -0,0 +1,159 @@
+#include "runtime/ops/nms.h"
+
+#include <algorithm>
+
+#include <chainerx/array.h>
+#include <chainerx/native/native_backend.h>
+#include <chainerx/routines/creation.h>
+
+#include <common/log.h>
+#include <runtime/chainerx_util.h>
+#include <runtime/gen_chxvm_ops.h>
+
+namespace chainer_compiler {
+namespace runtime {
+
+void SortedBoxes::Reserve(int64_t n) {
+    y_min_.reserve(n);
+    x_min_.reserve(n);
+    y_max_.reserve(n);
+    x_max_.reserve(n);
+    area_.reserve(n);
+}
+
+void SortedBoxes::Add(float y_min, float x_min, float y_max, float x_max) {
+    y_min_.push_back(y_min);
+    x_min_.push_back(x_min);
+    y_max_.push_back(y_max);
+    x_max_.push_back(x_max);
+    area_.push_back((y_max - y_min) * (x_max - x_min));
+}
+
+std::vector<int64_t> NonMaxSuppression(const SortedBoxes& boxes, float iou_threshold, int64_t max_output_size) {
+    constexpr int64_t kBits = 64;
+    const int64_t n = boxes.size();
+    const float* y_min = boxes.y_min_.data();
+    const float* x_min = boxes.x_min_.data();
+    const float* y_max = boxes.y_max_.data();
+    const float* x_max = boxes.x_max_.data();
+    const float* area = boxes.area_.data();
+
+    std::vector<uint64_t> suppressed((n + kBits - 1) / kBits);
+    std::vector<int64_t> kept;
+    uint8_t overlaps[kBits];
+    for (int64_t i = 0; i < n && static_cast<int64_t>(kept.size()) < max_output_size; ++i) {
+        if ((suppressed[i / kBits] >> (i % kBits)) & 1) {
+            continue;
+        }
+        kept.push_back(i);
+
+        const float y0 = y_min[i];
+        const float x0 = x_min[i];
+        const float y1 = y_max[i];
+        const float x1 = x_max[i];
+        const float a = area[i];
+        // Boxes before `i` are already decided, so only the words
+        // which contain later boxes are updated.
+        for (int64_t word = (i + 1) / kBits; word < static_cast<int64_t>(suppressed.size()); ++word) {
+            const int64_t begin = word * kBits;
+            const int64_t end = std::min(n, begin + kBits);
+            // This loop has no branches so it is vectorized.
+            for (int64_t j = begin; j < end; ++j) {
+                const float h = std::max(0.0f, std::min(y1, y_max[j]) - std::max(y0, y_min[j]));
+                const float w = std::max(0.0f, std::min(x1, x_max[j]) - std::max(x0, x_min[j]));
+                const float intersection = h * w;
+                overlaps[j - begin] = intersection > iou_threshold * (a + area[j] - intersection);
+            }
+            uint64_t bits = 0;
+            for (int64_t j = begin; j < end; ++j) {
+                bits |= static_cast<uint64_t>(overlaps[j - begin]) << (j - begin);
+            }
+            suppressed[word] |= bits;
+        }
+    }
+    return kept;
+}
+
+chainerx::Array NonMaxSuppressionOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& boxes,
+        const chainerx::Array& scores,
+        const absl::optional<StrictScalar>& max_output_boxes_per_class,
+        const absl::optional<StrictScalar>& iou_threshold,
+        const absl::optional<StrictScalar>& score_threshold) {
+    CHECK_EQ(3, boxes.ndim());
+    CHECK_EQ(3, scores.ndim());
+    CHECK_EQ(4, boxes.shape()[2]);
+    const int64_t batch_size = boxes.shape()[0];
+    const int64_t num_boxes = boxes.shape()[1];
+    const int64_t num_classes = scores.shape()[1];
+    CHECK_EQ(batch_size, scores.shape()[0]);
+    CHECK_EQ(num_boxes, scores.shape()[2]);
+
+    const int64_t max_output_size = max_output_boxes_per_class.has_value() ? static_cast<int64_t>(*max_output_boxes_per_class) : 0;
+    const float iou_thresh = iou_threshold.has_value() ? static_cast<float>(*iou_threshold) : 0.0f;
+    const bool has_score_threshold = score_threshold.has_value();
+    const float score_thresh = has_score_threshold ? static_cast<float>(*score_threshold) : 0.0f;
+
+    const chainerx::Array boxes_c = chainerx::AsContiguous(boxes.ToNative().AsType(chainerx::Dtype::kFloat32));
+    const chainerx::Array scores_c = chainerx::AsContiguous(scores.ToNative().AsType(chainerx::Dtype::kFloat32));
+    const float* boxes_ptr = RawPtr<const float>(boxes_c);
+    const float* scores_ptr = RawPtr<const float>(scores_c);
+
+    // Images and classes are independent, so they run in parallel.
+    std::vector<std::vector<int64_t>> selected(batch_size * num_classes);
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t bc = 0; bc < batch_size * num_classes; ++bc) {
+        if (max_output_size <= 0) {
+            continue;
+        }
+        const int64_t b = bc / num_classes;
+        const float* s = &scores_ptr[bc * num_boxes];
+        std::vector<int64_t> order;
+        order.reserve(num_boxes);
+        for (int64_t i = 0; i < num_boxes; ++i) {
+            if (!has_score_threshold || s[i] > score_thresh) {
+                order.push_back(i);
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [s](int64_t i, int64_t j) { return s[i] > s[j]; });
+
+        SortedBoxes sorted_boxes;
+        sorted_boxes.Reserve(order.size());
+        for (int64_t i : order) {
+            const float* box = &boxes_ptr[(b * num_boxes + i) * 4];
+            if (center_point_box) {
+                // (x_center, y_center, width, height).
+                sorted_boxes.Add(box[1] - box[3] / 2, box[0] - box[2] / 2, box[1] + box[3] / 2, box[0] + box[2] / 2);
+            } else {
+                // Any diagonal pair of corners.
+                sorted_boxes.Add(
+                        std::min(box[0], box[2]), std::min(box[1], box[3]), std::max(box[0], box[2]), std::max(box[1], box[3]));
+            }
+        }
+
+        for (int64_t k : NonMaxSuppression(sorted_boxes, iou_thresh, max_output_size)) {
+            selected[bc].push_back(order[k]);
+        }
+    }
+
+    int64_t num_selected = 0;
+    for (const std::vector<int64_t>& s : selected) {
+        num_selected += s.size();
+    }
+    chainerx::Array selected_indices = chainerx::Empty({num_selected, 3}, chainerx::Dtype::kInt64, chainerx::GetNativeBackend().GetDevice(0));
+    int64_t* out = RawPtr<int64_t>(selected_indices);
+    for (int64_t bc = 0; bc < batch_size * num_classes; ++bc) {
+        for (int64_t i : selected[bc]) {
+            *out++ = bc / num_classes;
+            *out++ = bc % num_classes;
+            *out++ = i;
+        }
+    }
+    return selected_indices;
+}
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace chainer_compiler {
+namespace runtime {
+
+// Boxes sorted by their scores in descending order. Coordinates are
+// stored as a structure of arrays so IoUs against a single box can be
+// computed by a vectorized loop.
+class SortedBoxes {
+public:
+    void Reserve(int64_t n);
+
+    // Boxes must be added in the descending order of their scores.
+    void Add(float y_min, float x_min, float y_max, float x_max);
+
+    int64_t size() const {
+        return y_min_.size();
+    }
+
+    float y_min(int64_t i) const {
+        return y_min_[i];
+    }
+    float x_min(int64_t i) const {
+        return x_min_[i];
+    }
+    float y_max(int64_t i) const {
+        return y_max_[i];
+    }
+    float x_max(int64_t i) const {
+        return x_max_[i];
+    }
+
+private:
+    friend std::vector<int64_t> NonMaxSuppression(const SortedBoxes& boxes, float iou_threshold, int64_t max_output_size);
+
+    std::vector<float> y_min_;
+    std::vector<float> x_min_;
+    std::vector<float> y_max_;
+    std::vector<float> x_max_;
+    std::vector<float> area_;
+};
+
+// Greedy non-maximum suppression. Returns the indices of kept boxes
+// in `boxes`, at most `max_output_size` of them. A box is suppressed
+// when its IoU with a kept box is larger than `iou_threshold`.
+// Suppressed boxes are tracked by a bitmask, and a row of the mask is
+// computed only for kept boxes.
+std::vector<int64_t> NonMaxSuppression(const SortedBoxes& boxes, float iou_threshold, int64_t max_output_size);
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -1,10 +1,16 @@
+#include <cmath>
+
 #include <chainerx/kernels/normalization.h>
+#include <chainerx/routines/activation.h>
 #include <chainerx/routines/arithmetic.h>
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/indexing.h>
 #include <chainerx/routines/manipulation.h>
 #include <chainerx/routines/normalization.h>
 #include <chainerx/routines/statistics.h>
 
 #include <common/log.h>
+#include <runtime/chainerx_util.h>
 #include <runtime/chxvm_state.h>
 #include <runtime/gen_chxvm_ops.h>
 
@@ -22,8 +28,16 @@ public:
             chainerx::Shape x1_shape,
             chainerx::Shape x2_shape,
             double epsilon,
-            const chainerx::Axes& sorted_axis)
-        : state_(state), x_(x), gamma_(gamma), x1_shape_(x1_shape), x2_shape_(x2_shape), epsilon_(epsilon), sorted_axis_(sorted_axis) {
+            const chainerx::Axes& sorted_axis,
+            const absl::optional<chainerx::Array>& y)
+        : state_(state),
+          x_(x),
+          gamma_(gamma),
+          x1_shape_(x1_shape),
+          x2_shape_(x2_shape),
+          epsilon_(epsilon),
+          sorted_axis_(sorted_axis),
+          y_(y) {
     }
     virtual ~BatchNormBackwardContext() = default;
 
@@ -55,6 +69,11 @@ public:
         return sorted_axis_;
     }
 
+    // The output of the forward computation. Only for fused ReLU.
+    const absl::optional<chainerx::Array>& y() const {
+        return y_;
+    }
+
 private:
     std::shared_ptr<chainerx::BatchNormGradState> state_;
     chainerx::Array x_;
@@ -63,8 +82,255 @@ private:
     chainerx::Shape x2_shape_;
     double epsilon_;
     chainerx::Axes sorted_axis_;
+    absl::optional<chainerx::Array> y_;
+};
+
+// The backward context of `NativeBatchNorm`. `y` is kept only when
+// ReLU is fused.
+class NativeBatchNormBackwardContext : public ChxVMOpaque {
+public:
+    NativeBatchNormBackwardContext(
+            const chainerx::Array& x,
+            const chainerx::Array& gamma,
+            const chainerx::Array& mean,
+            const chainerx::Array& inv_std,
+            const absl::optional<chainerx::Array>& y,
+            chainerx::Shape x1_shape,
+            chainerx::Shape x2_shape)
+        : x_(x), gamma_(gamma), mean_(mean), inv_std_(inv_std), y_(y), x1_shape_(x1_shape), x2_shape_(x2_shape) {
+    }
+    virtual ~NativeBatchNormBackwardContext() = default;
+
+    const chainerx::Array& x() const {
+        return x_;
+    }
+
+    const chainerx::Array& gamma() const {
+        return gamma_;
+    }
+
+    const chainerx::Array& mean() const {
+        return mean_;
+    }
+
+    const chainerx::Array& inv_std() const {
+        return inv_std_;
+    }
+
+    const absl::optional<chainerx::Array>& y() const {
+        return y_;
+    }
+
+    const chainerx::Shape& x1_shape() const {
+        return x1_shape_;
+    }
+
+    const chainerx::Shape& x2_shape() const {
+        return x2_shape_;
+    }
+
+private:
+    chainerx::Array x_;
+    chainerx::Array gamma_;
+    chainerx::Array mean_;
+    chainerx::Array inv_std_;
+    absl::optional<chainerx::Array> y_;
+    chainerx::Shape x1_shape_;
+    chainerx::Shape x2_shape_;
+};
+
+bool IsContiguousFloat(const chainerx::Array& a) {
+    return a.dtype() == chainerx::Dtype::kFloat32 && a.IsContiguous();
+}
+
+// Returns true if the batch normalization of `x` can be computed by
+// `NativeBatchNorm`. Running statistics are updated in-place so they
+// must be contiguous.
+bool CanUseNativeBatchNorm(
+        const chainerx::Array& x,
+        const chainerx::Array& s,
+        const chainerx::Array& bias,
+        const chainerx::Array& mean,
+        const chainerx::Array& var) {
+    if (!IsNativeDevice(&x.device()) || x.ndim() < 2 || x.GetTotalSize() == 0) {
+        return false;
+    }
+    for (const chainerx::Array& a : {x, s, bias, mean, var}) {
+        if (a.dtype() != chainerx::Dtype::kFloat32 || !IsNativeDevice(&a.device())) {
+            return false;
+        }
+    }
+    const int64_t channels = x.shape()[1];
+    return IsContiguousFloat(mean) && IsContiguousFloat(var) && s.GetTotalSize() == channels && bias.GetTotalSize() == channels &&
+           mean.GetTotalSize() == channels && var.GetTotalSize() == channels;
+}
+
+struct NativeBatchNormResult {
+    chainerx::Array y;
+    // Per-channel statistics of the batch. `var` is biased.
+    chainerx::Array mean;
+    chainerx::Array var;
+    chainerx::Array inv_std;
 };
 
+// Batch normalization over all axes but the second one for a native
+// float32 input. `x` and `gamma` must be contiguous. The per-channel mean and variance are computed in a
+// single pass over `x` by merging the statistics of each (n, c) row
+// with Chan's parallel variant of Welford's algorithm, which is
+// numerically stable unlike E[x^2]-E[x]^2. The running statistics are
+// updated in the same way as ChainerX does.
+NativeBatchNormResult NativeBatchNorm(
+        const chainerx::Array& x,
+        const chainerx::Array& gamma,
+        const chainerx::Array& in_beta,
+        const chainerx::Array& running_mean,
+        const chainerx::Array& running_var,
+        double epsilon,
+        double decay,
+        bool update_running,
+        bool fuse_relu) {
+    const chainerx::Array beta = chainerx::AsContiguous(in_beta);
+    const int64_t batch_size = x.shape()[0];
+    const int64_t channels = x.shape()[1];
+    const int64_t spatial = x.GetTotalSize() / (batch_size * channels);
+    const int64_t reduce_size = batch_size * spatial;
+    const double adjust = static_cast<double>(reduce_size) / std::max<int64_t>(reduce_size - 1, 1);
+
+    NativeBatchNormResult r;
+    r.y = chainerx::EmptyLike(x, x.device());
+    r.mean = chainerx::Empty({channels}, x.dtype(), x.device());
+    r.var = chainerx::Empty({channels}, x.dtype(), x.device());
+    r.inv_std = chainerx::Empty({channels}, x.dtype(), x.device());
+    const float* xp = RawPtr<const float>(x);
+    const float* gp = RawPtr<const float>(gamma);
+    const float* bp = RawPtr<const float>(beta);
+    float* yp = RawPtr<float>(r.y);
+    float* mp = RawPtr<float>(r.mean);
+    float* vp = RawPtr<float>(r.var);
+    float* ip = RawPtr<float>(r.inv_std);
+    float* rmp = RawPtr<float>(running_mean);
+    float* rvp = RawPtr<float>(running_var);
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t c = 0; c < channels; ++c) {
+        double mean = 0;
+        double m2 = 0;
+        int64_t count = 0;
+        for (int64_t n = 0; n < batch_size; ++n) {
+            const float* row = xp + (n * channels + c) * spatial;
+            // The row is small enough to stay in cache.
+            double row_sum = 0;
+            for (int64_t i = 0; i < spatial; ++i) {
+                row_sum += row[i];
+            }
+            const double row_mean = row_sum / spatial;
+            double row_m2 = 0;
+            for (int64_t i = 0; i < spatial; ++i) {
+                const double d = row[i] - row_mean;
+                row_m2 += d * d;
+            }
+            const double delta = row_mean - mean;
+            const int64_t total = count + spatial;
+            mean += delta * spatial / total;
+            m2 += row_m2 + delta * delta * count * spatial / total;
+            count = total;
+        }
+
+        const double var = m2 / reduce_size;
+        const double inv_std = 1.0 / std::sqrt(var + epsilon);
+        mp[c] = mean;
+        vp[c] = var;
+        ip[c] = inv_std;
+        if (update_running) {
+            rmp[c] = decay * rmp[c] + (1 - decay) * mean;
+            rvp[c] = decay * rvp[c] + (1 - decay) * adjust * var;
+        }
+
+        const float scale = gp[c] * inv_std;
+        const float shift = bp[c] - mean * scale;
+        for (int64_t n = 0; n < batch_size; ++n) {
+            const float* row = xp + (n * channels + c) * spatial;
+            float* out = yp + (n * channels + c) * spatial;
+            if (fuse_relu) {
+                for (int64_t i = 0; i < spatial; ++i) {
+                    out[i] = std::max(row[i] * scale + shift, 0.0f);
+                }
+            } else {
+                for (int64_t i = 0; i < spatial; ++i) {
+                    out[i] = row[i] * scale + shift;
+                }
+            }
+        }
+    }
+    return r;
+}
+
+// The closed form gradient of `NativeBatchNorm`:
+//
+//   gbeta = sum(gy)
+//   ggamma = sum(gy * xhat)
+//   gx = gamma * inv_std * (gy - gbeta / M - xhat * ggamma / M)
+//
+// where xhat = (x - mean) * inv_std and M is the number of reduced
+// elements. When ReLU is fused, `gy` is masked by `y > 0` first.
+std::tuple<chainerx::Array, chainerx::Array, chainerx::Array> NativeBatchNormGrad(
+        const NativeBatchNormBackwardContext& context, const chainerx::Array& in_gy) {
+    const chainerx::Array& x = context.x();
+    const chainerx::Array gy = chainerx::AsContiguous(in_gy.AsType(chainerx::Dtype::kFloat32));
+    const int64_t batch_size = x.shape()[0];
+    const int64_t channels = x.shape()[1];
+    const int64_t spatial = x.GetTotalSize() / (batch_size * channels);
+    const double reduce_size = batch_size * spatial;
+
+    chainerx::Array gx = chainerx::EmptyLike(x, x.device());
+    chainerx::Array ggamma = chainerx::Empty({channels}, x.dtype(), x.device());
+    chainerx::Array gbeta = chainerx::Empty({channels}, x.dtype(), x.device());
+    const float* xp = RawPtr<const float>(x);
+    const float* yp = context.y().has_value() ? RawPtr<const float>(*context.y()) : nullptr;
+    const float* gyp = RawPtr<const float>(gy);
+    const float* gp = RawPtr<const float>(context.gamma());
+    const float* mp = RawPtr<const float>(context.mean());
+    const float* ip = RawPtr<const float>(context.inv_std());
+    float* gxp = RawPtr<float>(gx);
+    float* ggp = RawPtr<float>(ggamma);
+    float* gbp = RawPtr<float>(gbeta);
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t c = 0; c < channels; ++c) {
+        const float mean = mp[c];
+        const float inv_std = ip[c];
+        double sum_gy = 0;
+        double sum_gy_xhat = 0;
+        for (int64_t n = 0; n < batch_size; ++n) {
+            const int64_t offset = (n * channels + c) * spatial;
+            for (int64_t i = 0; i < spatial; ++i) {
+                const float g = (yp && yp[offset + i] <= 0) ? 0 : gyp[offset + i];
+                sum_gy += g;
+                sum_gy_xhat += g * (xp[offset + i] - mean) * inv_std;
+            }
+        }
+        ggp[c] = sum_gy_xhat;
+        gbp[c] = sum_gy;
+
+        const float scale = gp[c] * inv_std;
+        const float mean_gy = sum_gy / reduce_size;
+        const float mean_gy_xhat = sum_gy_xhat / reduce_size;
+        for (int64_t n = 0; n < batch_size; ++n) {
+            const int64_t offset = (n * channels + c) * spatial;
+            for (int64_t i = 0; i < spatial; ++i) {
+                const float g = (yp && yp[offset + i] <= 0) ? 0 : gyp[offset + i];
+                const float xhat = (xp[offset + i] - mean) * inv_std;
+                gxp[offset + i] = scale * (g - mean_gy - xhat * mean_gy_xhat);
+            }
+        }
+    }
+    return std::make_tuple(gx, ggamma.Reshape(context.x1_shape()), gbeta.Reshape(context.x2_shape()));
+}
+
 // TODO(hamaji): Copied from ChainerX's code.
 using Array = chainerx::Array;
 using Axes = chainerx::Axes;
@@ -145,6 +411,24 @@ std::tuple<chainerx::Array, ChxVMOpaque*, chainerx::Array, chainerx::Array, chai
         const chainerx::Array& var) {
     // To workaround the limitation of CuDNN.
     if (epsilon <= 1e-5) epsilon = 1e-5 + 1e-12;
+
+    if (CanUseNativeBatchNorm(x, s, bias, mean, var)) {
+        const chainerx::Array xc = chainerx::AsContiguous(x);
+        const chainerx::Array gamma = chainerx::AsContiguous(s);
+        // Statistics shouldn't be updated when recomputing.
+        NativeBatchNormResult result = NativeBatchNorm(xc, gamma, bias, mean, var, epsilon, decay, !in_recomputing, fuse_relu);
+        absl::optional<chainerx::Array> y;
+        if (fuse_relu) y = result.y;
+        ChxVMOpaque* ctx = new NativeBatchNormBackwardContext(xc, gamma, result.mean, result.inv_std, y, s.shape(), bias.shape());
+        if (st->options().dump_memory_usage >= 1) {
+            ctx->SetRetainedArrays({xc, gamma, result.mean, result.inv_std});
+        }
+        chainerx::Array saved_mean, saved_var;
+        if (this->saved_mean >= 0) saved_mean = result.mean;
+        if (this->saved_var >= 0) saved_var = result.var;
+        return std::tie(result.y, ctx, mean, var, saved_mean, saved_var);
+    }
+
     chainerx::Axes axes;
     for (int i = 0; i < x.shape().size(); ++i) {
         if (i != 1) axes.push_back(i);
@@ -163,7 +447,12 @@ std::tuple<chainerx::Array, ChxVMOpaque*, chainerx::Array, chainerx::Array, chai
     chainerx::Array out;
     std::tie(out, state) = x.device().backend().CallKernel<chainerx::BatchNormKernel>(
             x, gamma_reshaped, beta_reshaped, result.mean, result.var, epsilon, decay, result.sorted_axis, true, absl::nullopt);
-    ChxVMOpaque* ctx = new BatchNormBackwardContext(state, x, gamma_reshaped, s.shape(), bias.shape(), epsilon, result.sorted_axis);
+    absl::optional<chainerx::Array> y;
+    if (fuse_relu) {
+        out = chainerx::Relu(out);
+        y = out;
+    }
+    ChxVMOpaque* ctx = new BatchNormBackwardContext(state, x, gamma_reshaped, s.shape(), bias.shape(), epsilon, result.sorted_axis, y);
     if (st->options().dump_memory_usage >= 1) {
         ctx->SetRetainedArrays({x, gamma_reshaped, beta_reshaped, result.mean, result.var});
     }
@@ -196,12 +485,22 @@ chainerx::Array FixedBatchNormalizationOp::RunImpl(
     for (int i = 0; i < x.shape().size(); ++i) {
         if (i != 1) axes.push_back(i);
     }
-    return chainerx::FixedBatchNorm(x, s, bias, mean, var, epsilon, axes);
+    chainerx::Array y = chainerx::FixedBatchNorm(x, s, bias, mean, var, epsilon, axes);
+    return fuse_relu ? chainerx::Relu(y) : y;
 }
 
 std::tuple<chainerx::Array, chainerx::Array, chainerx::Array> BatchNormalizationGradOp::RunImpl(
-        ChxVMState* st, const chainerx::Array& gy, const ChxVMOpaque& ctx) {
+        ChxVMState* st, const chainerx::Array& in_gy, const ChxVMOpaque& ctx) {
+    if (auto* native_context = dynamic_cast<const NativeBatchNormBackwardContext*>(&ctx)) {
+        return NativeBatchNormGrad(*native_context, in_gy);
+    }
+
     auto& context = dynamic_cast<const BatchNormBackwardContext&>(ctx);
+    chainerx::Array gy = in_gy;
+    if (context.y().has_value()) {
+        const chainerx::Array& y = *context.y();
+        gy = chainerx::Where(y > chainerx::Zeros({}, y.dtype(), y.device()), gy, chainerx::Zeros({}, gy.dtype(), gy.device()));
+    }
     chainerx::Array gx, ggamma, gbeta;
     std::tie(gx, ggamma, gbeta) = gy.device().backend().CallKernel<chainerx::BatchNormGradKernel>(
             context.x(),
@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <chainerx/numeric_limits.h>
 #include <chainerx/routines/binary.h>
 #include <chainerx/routines/connection.h>
+#include <chainerx/routines/creation.h>
 #include <chainerx/routines/manipulation.h>
 #include <chainerx/routines/misc.h>
 
@@ -43,6 +49,174 @@ chainerx::Array dequantize_array(const chainerx::Array& x, const chainerx::Scala
     return zero_pointed_x * x_scale;
 }
 
+chainerx::Array QLinearConvByFloat(
+        const chainerx::Array& q_x,
+        const StrictScalar& x_scale,
+        const StrictScalar& x_zero_point,
+        const chainerx::Array& q_w,
+        const chainerx::Array& w_scale,
+        const chainerx::Array& w_zero_point,
+        const StrictScalar& y_scale,
+        const StrictScalar& y_zero_point,
+        const absl::optional<chainerx::Array>& b,
+        const Int64StackVector& strides,
+        const Int64StackVector& pads,
+        int group,
+        const std::string& auto_pad) {
+    // Dequantize q_x and q_w
+    const chainerx::Array x = dequantize_array(q_x, chainerx::Scalar(x_scale), chainerx::Scalar(x_zero_point));
+    chainerx::Array w = q_w.AsType(chainerx::Dtype::kFloat32);
+    if (w_scale.shape().size() == 1) {
+        CHECK_EQ(w.shape()[0], w_scale.shape()[0]);
+        std::vector<chainerx::Array> stack(w.shape()[0]);
+        for (int64_t i = 0; i < w.shape()[0]; ++i) {
+            stack[i] = dequantize_array(w.At({i}), chainerx::AsScalar(w_scale.At({i})), chainerx::AsScalar(w_zero_point.At({i})));
+        }
+        w = chainerx::Stack(stack);
+    } else {
+        CHECK_EQ(0, w_scale.shape().size());
+        w = dequantize_array(w, chainerx::AsScalar(w_scale), chainerx::AsScalar(w_zero_point));
+    }
+
+    // Run convolution normally
+    return quantize_array(GroupedConv(x, w, b, strides, pads, group, auto_pad), y_scale, y_zero_point);
+}
+
+// Integer kernels for QLinearConv and QLinearMatMul on CPU. Quantized
+// values are widened to int16 with their zero points subtracted so
+// the inner loop of the GEMM is a multiply-accumulate into int32
+// which compilers vectorize well. The difference of two uint8 values
+// fits in int16 and the products do not overflow int32 for
+// reasonable reduction sizes.
+
+bool IsQuantizedDtype(chainerx::Dtype dtype) {
+    return dtype == chainerx::Dtype::kUInt8 || dtype == chainerx::Dtype::kInt8;
+}
+
+template <typename T>
+void WidenToInt16(const T* x, int64_t size, int64_t zero_point, int16_t* y) {
+    const int16_t zp = static_cast<int16_t>(zero_point);
+    for (int64_t i = 0; i < size; ++i) {
+        y[i] = static_cast<int16_t>(x[i]) - zp;
+    }
+}
+
+void WidenToInt16(const chainerx::Array& x, int64_t offset, int64_t size, int64_t zero_point, int16_t* y) {
+    switch (x.dtype()) {
+        case chainerx::Dtype::kUInt8:
+            WidenToInt16(RawPtr<const uint8_t>(x) + offset, size, zero_point, y);
+            break;
+        case chainerx::Dtype::kInt8:
+            WidenToInt16(RawPtr<const int8_t>(x) + offset, size, zero_point, y);
+            break;
+        default:
+            CHECK(false) << "Unexpected dtype for quantized values: " << x.dtype();
+    }
+}
+
+struct Conv2DGeometry {
+    int64_t kh, kw;
+    int64_t sy, sx;
+    int64_t pad_top, pad_left;
+    int64_t out_h, out_w;
+};
+
+// Lays out the patches of a (channels, height, width) image as a
+// (channels * kh * kw, out_h * out_w) matrix. Paddings are zeros,
+// which is the zero point before widening.
+template <typename T>
+void Im2Col(const T* x, int64_t zero_point, int64_t channels, int64_t height, int64_t width, const Conv2DGeometry& g, int16_t* col) {
+    const int16_t zp = static_cast<int16_t>(zero_point);
+    for (int64_t c = 0; c < channels; ++c) {
+        const T* xc = x + c * height * width;
+        for (int64_t ky = 0; ky < g.kh; ++ky) {
+            for (int64_t kx = 0; kx < g.kw; ++kx) {
+                for (int64_t oy = 0; oy < g.out_h; ++oy) {
+                    const int64_t iy = oy * g.sy - g.pad_top + ky;
+                    if (iy < 0 || iy >= height) {
+                        std::fill(col, col + g.out_w, 0);
+                        col += g.out_w;
+                        continue;
+                    }
+                    const T* xr = xc + iy * width;
+                    for (int64_t ox = 0; ox < g.out_w; ++ox) {
+                        const int64_t ix = ox * g.sx - g.pad_left + kx;
+                        *col++ = (ix < 0 || ix >= width) ? 0 : static_cast<int16_t>(xr[ix]) - zp;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Im2Col(
+        const chainerx::Array& x,
+        int64_t offset,
+        int64_t zero_point,
+        int64_t channels,
+        int64_t height,
+        int64_t width,
+        const Conv2DGeometry& g,
+        int16_t* col) {
+    switch (x.dtype()) {
+        case chainerx::Dtype::kUInt8:
+            Im2Col(RawPtr<const uint8_t>(x) + offset, zero_point, channels, height, width, g, col);
+            break;
+        case chainerx::Dtype::kInt8:
+            Im2Col(RawPtr<const int8_t>(x) + offset, zero_point, channels, height, width, g, col);
+            break;
+        default:
+            CHECK(false) << "Unexpected dtype for quantized values: " << x.dtype();
+    }
+}
+
+// Computes `y = a * b` for row-major (m, k) `a`, (k, n) `b`, and
+// (m, n) `y`. Columns are processed in blocks so a block of `b` stays
+// in cache while rows of `a` are swept.
+void GemmInt16(int64_t m, int64_t n, int64_t k, const int16_t* a, const int16_t* b, int32_t* y) {
+    constexpr int64_t kBlockN = 256;
+    std::fill(y, y + m * n, 0);
+    for (int64_t j0 = 0; j0 < n; j0 += kBlockN) {
+        const int64_t j1 = std::min(n, j0 + kBlockN);
+        for (int64_t i = 0; i < m; ++i) {
+            const int16_t* ar = a + i * k;
+            int32_t* yr = y + i * n;
+            for (int64_t l = 0; l < k; ++l) {
+                const int32_t av = ar[l];
+                if (av == 0) continue;
+                const int16_t* br = b + l * n;
+                for (int64_t j = j0; j < j1; ++j) {
+                    yr[j] += av * br[j];
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void Requantize(const int32_t* acc, int64_t size, float multiplier, int64_t zero_point, T* y) {
+    const float lo = std::numeric_limits<T>::min();
+    const float hi = std::numeric_limits<T>::max();
+    const float zp = zero_point;
+    for (int64_t i = 0; i < size; ++i) {
+        const float v = std::nearbyint(acc[i] * multiplier) + zp;
+        y[i] = static_cast<T>(std::min(hi, std::max(lo, v)));
+    }
+}
+
+void Requantize(const int32_t* acc, int64_t size, float multiplier, int64_t zero_point, const chainerx::Array& y, int64_t offset) {
+    switch (y.dtype()) {
+        case chainerx::Dtype::kUInt8:
+            Requantize(acc, size, multiplier, zero_point, RawPtr<uint8_t>(y) + offset);
+            break;
+        case chainerx::Dtype::kInt8:
+            Requantize(acc, size, multiplier, zero_point, RawPtr<int8_t>(y) + offset);
+            break;
+        default:
+            CHECK(false) << "Unexpected dtype for quantized values: " << y.dtype();
+    }
+}
+
 }  // namespace
 
 chainerx::Array QuantizeLinearOp::RunImpl(
@@ -59,6 +233,32 @@ chainerx::Array DequantizeLinearOp::RunImpl(
     return dequantize_array(x, chainerx::Scalar(x_scale), chainerx::Scalar(x_zero_point));
 }
 
+class QLinearConvOp::QLinearConvImpl {
+public:
+    // The weight, its zero points, and its scales the packed weight
+    // was made from. They are compared with `IsSameArray`. Holding
+    // them keeps their buffers from being reused for other arrays
+    // while they are used as the cache key.
+    chainerx::Array w;
+    chainerx::Array w_zero_point;
+    chainerx::Array w_scale;
+    // (out_channels, in_channels / group * kh * kw) in int16 with zero
+    // points subtracted.
+    std::vector<int16_t> packed_w;
+    // The scale of each output channel.
+    std::vector<float> w_scales;
+    std::vector<int16_t> col;
+    std::vector<int32_t> acc;
+};
+
+void QLinearConvOp::InitImpl() {
+    impl_ = new QLinearConvImpl();
+}
+
+QLinearConvOp::~QLinearConvOp() {
+    delete impl_;
+}
+
 chainerx::Array QLinearConvOp::RunImpl(
         ChxVMState* st,
         const chainerx::Array& q_x,
@@ -70,27 +270,159 @@ chainerx::Array QLinearConvOp::RunImpl(
         const StrictScalar& y_scale,
         const StrictScalar& y_zero_point,
         const absl::optional<chainerx::Array>& b) {
-    // Dequantize q_x and q_w
-    const chainerx::Array x = dequantize_array(q_x, chainerx::Scalar(x_scale), chainerx::Scalar(x_zero_point));
-    chainerx::Array w = q_w.AsType(chainerx::Dtype::kFloat32);
     CHECK_EQ(w_scale.GetTotalSize(), w_zero_point.GetTotalSize());
     CHECK_EQ(w_scale.shape().size(), w_zero_point.shape().size());
-    if (w_scale.shape().size() == 1) {
-        CHECK_EQ(w.shape()[0], w_scale.shape()[0]);
-        std::vector<chainerx::Array> stack(w.shape()[0]);
-        for (int64_t i = 0; i < w.shape()[0]; ++i) {
-            stack[i] = dequantize_array(w.At({i}), chainerx::AsScalar(w_scale.At({i})), chainerx::AsScalar(w_zero_point.At({i})));
+    Int64StackVector comp_strides = ComplementStride(strides, q_x);
+    Int64StackVector comp_pads = ComplementPad(pads, q_x);
+
+    if (!IsNativeDevice(&q_x.device()) || q_x.ndim() != 4 || !IsQuantizedDtype(q_x.dtype()) || !IsQuantizedDtype(q_w.dtype())) {
+        return QLinearConvByFloat(
+                q_x, x_scale, x_zero_point, q_w, w_scale, w_zero_point, y_scale, y_zero_point, b, comp_strides, comp_pads, group, auto_pad);
+    }
+
+    const int64_t batch_size = q_x.shape()[0];
+    const int64_t in_channels = q_x.shape()[1];
+    const int64_t height = q_x.shape()[2];
+    const int64_t width = q_x.shape()[3];
+    const int64_t out_channels = q_w.shape()[0];
+    CHECK_EQ(0, out_channels % group);
+    CHECK_EQ(in_channels, q_w.shape()[1] * group);
+    const int64_t group_in_channels = in_channels / group;
+    const int64_t group_out_channels = out_channels / group;
+
+    Int64StackVector all_pads =
+            CalculateAutoPad(auto_pad, q_x, Int64StackVector(q_w.shape().begin() + 2, q_w.shape().end()), comp_strides, comp_pads);
+    Conv2DGeometry g;
+    g.kh = q_w.shape()[2];
+    g.kw = q_w.shape()[3];
+    g.sy = comp_strides[0];
+    g.sx = comp_strides[1];
+    g.pad_top = all_pads[0];
+    g.pad_left = all_pads[1];
+    const int64_t pad_bottom = all_pads.size() == 4 ? all_pads[2] : all_pads[0];
+    const int64_t pad_right = all_pads.size() == 4 ? all_pads[3] : all_pads[1];
+    g.out_h = (height + g.pad_top + pad_bottom - g.kh) / g.sy + 1;
+    g.out_w = (width + g.pad_left + pad_right - g.kw) / g.sx + 1;
+    const int64_t k = group_in_channels * g.kh * g.kw;
+    const int64_t out_size = g.out_h * g.out_w;
+
+    if (impl_->packed_w.empty() || !IsSameArray(impl_->w, q_w) || !IsSameArray(impl_->w_zero_point, w_zero_point) ||
+        !IsSameArray(impl_->w_scale, w_scale)) {
+        impl_->w = q_w;
+        impl_->w_zero_point = w_zero_point;
+        impl_->w_scale = w_scale;
+        const chainerx::Array w = chainerx::AsContiguous(q_w);
+        impl_->packed_w.resize(out_channels * k);
+        impl_->w_scales.resize(out_channels);
+        for (int64_t m = 0; m < out_channels; ++m) {
+            const chainerx::Array zp = w_zero_point.ndim() ? w_zero_point.At({m}) : w_zero_point;
+            WidenToInt16(w, m * k, k, static_cast<int64_t>(chainerx::AsScalar(zp)), &impl_->packed_w[m * k]);
+            const chainerx::Array scale = w_scale.ndim() ? w_scale.At({m}) : w_scale;
+            impl_->w_scales[m] = static_cast<double>(chainerx::AsScalar(scale));
         }
-        w = chainerx::Stack(stack);
-    } else {
-        CHECK_EQ(0, w_scale.shape().size());
-        w = dequantize_array(w, chainerx::AsScalar(w_scale), chainerx::AsScalar(w_zero_point));
     }
 
-    // Run convolution normally
-    Int64StackVector comp_strides = ComplementStride(strides, x);
-    Int64StackVector comp_pads = ComplementPad(pads, x);
-    return quantize_array(GroupedConv(x, w, b, comp_strides, comp_pads, group, auto_pad), y_scale, y_zero_point);
+    std::vector<float> multipliers(out_channels);
+    for (int64_t m = 0; m < out_channels; ++m) {
+        multipliers[m] = static_cast<double>(x_scale) * impl_->w_scales[m] / static_cast<double>(y_scale);
+    }
+    std::vector<int32_t> bias;
+    if (b.has_value()) {
+        chainerx::Array b32 = chainerx::AsContiguous(b->AsType(chainerx::Dtype::kInt32));
+        const int32_t* bp = RawPtr<const int32_t>(b32);
+        bias.assign(bp, bp + out_channels);
+    }
+
+    const chainerx::Array x = chainerx::AsContiguous(q_x);
+    chainerx::Array y = chainerx::Empty({batch_size, out_channels, g.out_h, g.out_w}, y_zero_point.dtype(), q_x.device());
+    impl_->col.resize(k * out_size);
+    impl_->acc.resize(group_out_channels * out_size);
+    int32_t* acc = impl_->acc.data();
+    for (int64_t n = 0; n < batch_size; ++n) {
+        for (int64_t gi = 0; gi < group; ++gi) {
+            const int64_t x_offset = (n * in_channels + gi * group_in_channels) * height * width;
+            Im2Col(x, x_offset, static_cast<int64_t>(x_zero_point), group_in_channels, height, width, g, impl_->col.data());
+            const int64_t m0 = gi * group_out_channels;
+            GemmInt16(group_out_channels, out_size, k, &impl_->packed_w[m0 * k], impl_->col.data(), acc);
+            for (int64_t m = 0; m < group_out_channels; ++m) {
+                int32_t* acc_row = acc + m * out_size;
+                if (!bias.empty()) {
+                    const int32_t bv = bias[m0 + m];
+                    for (int64_t i = 0; i < out_size; ++i) acc_row[i] += bv;
+                }
+                const int64_t y_offset = (n * out_channels + m0 + m) * out_size;
+                Requantize(acc_row, out_size, multipliers[m0 + m], static_cast<int64_t>(y_zero_point), y, y_offset);
+            }
+        }
+    }
+    return y;
+}
+
+class QLinearMatMulOp::QLinearMatMulImpl {
+public:
+    // See QLinearConvImpl.
+    chainerx::Array b;
+    chainerx::Array b_zero_point;
+    chainerx::Array b_scale;
+    // (k, n) in int16 with zero points subtracted.
+    std::vector<int16_t> packed_b;
+    float b_scale_value;
+    std::vector<int16_t> a;
+    std::vector<int32_t> acc;
+};
+
+void QLinearMatMulOp::InitImpl() {
+    impl_ = new QLinearMatMulImpl();
+}
+
+QLinearMatMulOp::~QLinearMatMulOp() {
+    delete impl_;
+}
+
+chainerx::Array QLinearMatMulOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& q_a,
+        const StrictScalar& a_scale,
+        const StrictScalar& a_zero_point,
+        const chainerx::Array& q_b,
+        const chainerx::Array& b_scale,
+        const chainerx::Array& b_zero_point,
+        const StrictScalar& y_scale,
+        const StrictScalar& y_zero_point) {
+    if (!IsNativeDevice(&q_a.device()) || q_a.ndim() < 2 || q_b.ndim() != 2 || b_scale.GetTotalSize() != 1 ||
+        b_zero_point.GetTotalSize() != 1 || !IsQuantizedDtype(q_a.dtype()) || !IsQuantizedDtype(q_b.dtype())) {
+        const chainerx::Array a = dequantize_array(q_a, chainerx::Scalar(a_scale), chainerx::Scalar(a_zero_point));
+        const chainerx::Array b = (q_b.AsType(chainerx::Dtype::kFloat32) - b_zero_point) * b_scale;
+        return quantize_array(NumpyMatMul(a, b), y_scale, y_zero_point);
+    }
+
+    const int64_t k = q_b.shape()[0];
+    const int64_t n = q_b.shape()[1];
+    CHECK_EQ(k, q_a.shape().back()) << q_a.shape() << " vs " << q_b.shape();
+    const int64_t m = q_a.GetTotalSize() / k;
+
+    if (impl_->packed_b.empty() || !IsSameArray(impl_->b, q_b) || !IsSameArray(impl_->b_zero_point, b_zero_point) ||
+        !IsSameArray(impl_->b_scale, b_scale)) {
+        impl_->b = q_b;
+        impl_->b_zero_point = b_zero_point;
+        impl_->b_scale = b_scale;
+        impl_->packed_b.resize(k * n);
+        WidenToInt16(
+                chainerx::AsContiguous(q_b), 0, k * n, static_cast<int64_t>(chainerx::AsScalar(b_zero_point.Reshape({}))), impl_->packed_b.data());
+        impl_->b_scale_value = static_cast<double>(chainerx::AsScalar(b_scale.Reshape({})));
+    }
+
+    const float multiplier = static_cast<double>(a_scale) * impl_->b_scale_value / static_cast<double>(y_scale);
+
+    chainerx::Shape y_shape(q_a.shape());
+    y_shape.back() = n;
+    chainerx::Array y = chainerx::Empty(y_shape, y_zero_point.dtype(), q_a.device());
+    impl_->a.resize(m * k);
+    impl_->acc.resize(m * n);
+    WidenToInt16(chainerx::AsContiguous(q_a), 0, m * k, static_cast<int64_t>(a_zero_point), impl_->a.data());
+    GemmInt16(m, n, k, impl_->a.data(), impl_->packed_b.data(), impl_->acc.data());
+    Requantize(impl_->acc.data(), m * n, multiplier, static_cast<int64_t>(y_zero_point), y, 0);
+    return y;
 }
 
 chainerx::Array MatMulIntegerOp::RunImpl(
@@ -1,5 +1,9 @@
 #include <math.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include <chainerx/array.h>
 #include <chainerx/routines/arithmetic.h>
 #include <chainerx/routines/creation.h>
@@ -15,27 +19,236 @@ namespace runtime {
 
 namespace {
 
-void NaiveUpsampleImpl(
-        const chainerx::Array& x, const chainerx::Array& y, const std::vector<int64_t>& int_scales, const std::vector<int64_t>& indices) {
-    if (int_scales.size() == indices.size()) {
-        std::vector<chainerx::ArrayIndex> dst_indices(indices.begin(), indices.end());
-        std::vector<chainerx::ArrayIndex> src_indices;
-        for (size_t i = 0; i < indices.size(); ++i) {
-            src_indices.push_back(indices[i] / int_scales[i]);
+enum class ResizeMode { kNearest, kLinear, kCubic };
+
+// How an output coordinate is mapped to an input coordinate.
+enum class CoordinateTransform {
+    // x_in = x_out / scale, as in ONNX's Resize and Upsample.
+    kAsymmetric,
+    // x_in = x_out * (in_size - 1) / (out_size - 1), as in Chainer's
+    // resize_images.
+    kAlignCorners,
+};
+
+ResizeMode GetResizeMode(const std::string& mode) {
+    if (mode == "nearest") {
+        return ResizeMode::kNearest;
+    } else if (mode == "linear" || mode == "bilinear") {
+        return ResizeMode::kLinear;
+    } else if (mode == "cubic") {
+        return ResizeMode::kCubic;
+    }
+    CHECK(false) << "Unknown resize mode: " << mode;
+}
+
+// Input indices and their weights for each output index along a
+// single axis. Each output index has `taps` entries.
+struct ResizeTable {
+    int64_t taps;
+    std::vector<int64_t> indices;
+    std::vector<float> weights;
+};
+
+ResizeTable MakeResizeTable(int64_t in_size, int64_t out_size, double scale, ResizeMode mode, CoordinateTransform transform) {
+    // The coefficient of the cubic convolution, same as ONNX's default.
+    constexpr double kCubicA = -0.75;
+    auto clamp = [in_size](int64_t i) { return std::min(std::max<int64_t>(i, 0), in_size - 1); };
+
+    ResizeTable table;
+    table.taps = mode == ResizeMode::kNearest ? 1 : mode == ResizeMode::kLinear ? 2 : 4;
+    table.indices.reserve(out_size * table.taps);
+    table.weights.reserve(out_size * table.taps);
+    for (int64_t o = 0; o < out_size; ++o) {
+        double x;
+        if (transform == CoordinateTransform::kAlignCorners) {
+            x = out_size > 1 ? static_cast<double>(o) * (in_size - 1) / (out_size - 1) : 0.0;
+        } else {
+            x = o / scale;
         }
-        y.At(dst_indices) += x.At(src_indices);
-    } else {
-        int64_t width = y.shape()[indices.size()];
-        for (size_t i = 0; i < width; ++i) {
-            std::vector<int64_t> next_indices(indices);
-            next_indices.push_back(i);
-            NaiveUpsampleImpl(x, y, int_scales, next_indices);
+
+        switch (mode) {
+            case ResizeMode::kNearest:
+                // Coordinates are rounded for downsampling as ONNX's
+                // reference results of Resize-10 do.
+                table.indices.push_back(clamp(static_cast<int64_t>(scale < 1.0 ? std::round(x) : std::floor(x))));
+                table.weights.push_back(1);
+                break;
+
+            case ResizeMode::kLinear: {
+                x = std::min<double>(std::max(x, 0.0), in_size - 1);
+                const int64_t x0 = static_cast<int64_t>(std::floor(x));
+                const double t = x - x0;
+                table.indices.push_back(x0);
+                table.weights.push_back(1 - t);
+                table.indices.push_back(clamp(x0 + 1));
+                table.weights.push_back(t);
+                break;
+            }
+
+            case ResizeMode::kCubic: {
+                const int64_t x0 = static_cast<int64_t>(std::floor(x));
+                const double t = x - x0;
+                const double a = kCubicA;
+                const double coeffs[4] = {((a * (t + 1) - 5 * a) * (t + 1) + 8 * a) * (t + 1) - 4 * a,
+                                          ((a + 2) * t - (a + 3)) * t * t + 1,
+                                          ((a + 2) * (1 - t) - (a + 3)) * (1 - t) * (1 - t) + 1,
+                                          ((a * (2 - t) - 5 * a) * (2 - t) + 8 * a) * (2 - t) - 4 * a};
+                for (int k = 0; k < 4; ++k) {
+                    table.indices.push_back(clamp(x0 - 1 + k));
+                    table.weights.push_back(coeffs[k]);
+                }
+                break;
+            }
         }
     }
+    return table;
 }
 
-void NaiveUpsample(const chainerx::Array& x, const chainerx::Array& y, const std::vector<int64_t>& int_scales) {
-    NaiveUpsampleImpl(x, y, int_scales, {});
+// Resizes `axis` of a contiguous float32 array. The array is viewed as
+// (outer, in_size, inner) so the innermost loop runs over contiguous
+// elements. Outer slices (e.g., channels) are processed in parallel.
+chainerx::Array ResizeAxis(const chainerx::Array& x, int axis, const ResizeTable& table) {
+    const int64_t in_size = x.shape()[axis];
+    const int64_t out_size = table.indices.size() / table.taps;
+    int64_t outer = 1;
+    for (int i = 0; i < axis; ++i) {
+        outer *= x.shape()[i];
+    }
+    int64_t inner = 1;
+    for (int i = axis + 1; i < x.ndim(); ++i) {
+        inner *= x.shape()[i];
+    }
+
+    chainerx::Shape y_shape(x.shape());
+    y_shape[axis] = out_size;
+    chainerx::Array y = chainerx::Empty(y_shape, x.dtype(), x.device());
+    const float* src = RawPtr<const float>(x);
+    float* dst = RawPtr<float>(y);
+    const int64_t taps = table.taps;
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t o = 0; o < outer; ++o) {
+        const float* s = src + o * in_size * inner;
+        float* d = dst + o * out_size * inner;
+        for (int64_t i = 0; i < out_size; ++i) {
+            const int64_t* indices = &table.indices[i * taps];
+            const float* weights = &table.weights[i * taps];
+            float* di = d + i * inner;
+            const float* s0 = s + indices[0] * inner;
+            if (taps == 1) {
+                std::copy(s0, s0 + inner, di);
+                continue;
+            }
+            const float w0 = weights[0];
+            for (int64_t k = 0; k < inner; ++k) {
+                di[k] = w0 * s0[k];
+            }
+            for (int64_t t = 1; t < taps; ++t) {
+                const float* st = s + indices[t] * inner;
+                const float wt = weights[t];
+                for (int64_t k = 0; k < inner; ++k) {
+                    di[k] += wt * st[k];
+                }
+            }
+        }
+    }
+    return y;
+}
+
+// The transpose of `ResizeAxis`. Scatters `gy` back to the input
+// indices in `table` with their weights. `gy` must be a contiguous
+// float32 array.
+chainerx::Array ResizeAxisGrad(const chainerx::Array& gy, int axis, int64_t in_size, const ResizeTable& table) {
+    const int64_t out_size = gy.shape()[axis];
+    CHECK_EQ(out_size * table.taps, static_cast<int64_t>(table.indices.size()));
+    int64_t outer = 1;
+    for (int i = 0; i < axis; ++i) {
+        outer *= gy.shape()[i];
+    }
+    int64_t inner = 1;
+    for (int i = axis + 1; i < gy.ndim(); ++i) {
+        inner *= gy.shape()[i];
+    }
+
+    chainerx::Shape gx_shape(gy.shape());
+    gx_shape[axis] = in_size;
+    chainerx::Array gx = chainerx::Zeros(gx_shape, gy.dtype(), gy.device());
+    const float* src = RawPtr<const float>(gy);
+    float* dst = RawPtr<float>(gx);
+    const int64_t taps = table.taps;
+
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t o = 0; o < outer; ++o) {
+        const float* s = src + o * out_size * inner;
+        float* d = dst + o * in_size * inner;
+        for (int64_t i = 0; i < out_size; ++i) {
+            const float* si = s + i * inner;
+            for (int64_t t = 0; t < taps; ++t) {
+                float* dt = d + table.indices[i * taps + t] * inner;
+                const float wt = table.weights[i * taps + t];
+                for (int64_t k = 0; k < inner; ++k) {
+                    dt[k] += wt * si[k];
+                }
+            }
+        }
+    }
+    return gx;
+}
+
+// A general resize for any number of dimensions. Interpolation is
+// separable, so axes are resized one by one with index/weight tables
+// built once per axis. The computation is done in float32 on the host
+// for all dtypes and devices.
+chainerx::Array ResizeND(
+        const chainerx::Array& x,
+        const chainerx::Shape& y_shape,
+        const std::vector<double>& scales,
+        ResizeMode mode,
+        CoordinateTransform transform) {
+    CHECK_EQ(x.ndim(), y_shape.size());
+    CHECK_EQ(x.ndim(), scales.size());
+    chainerx::Array t = chainerx::AsContiguous(x.ToNative().AsType(chainerx::Dtype::kFloat32));
+    for (int axis = 0; axis < x.ndim(); ++axis) {
+        const int64_t in_size = x.shape()[axis];
+        const int64_t out_size = y_shape[axis];
+        if (in_size == out_size && (transform == CoordinateTransform::kAlignCorners || scales[axis] == 1.0)) {
+            continue;
+        }
+        t = ResizeAxis(t, axis, MakeResizeTable(in_size, out_size, scales[axis], mode, transform));
+    }
+    if (t.dtype() != x.dtype()) {
+        t = t.AsType(x.dtype());
+    }
+    return t.ToDevice(x.device());
+}
+
+// The gradient of `ResizeND` from `x_shape` to the shape of `gy`.
+// Axes are processed in the reverse order of `ResizeND`.
+chainerx::Array ResizeNDGrad(
+        const chainerx::Array& gy,
+        const chainerx::Shape& x_shape,
+        const std::vector<double>& scales,
+        ResizeMode mode,
+        CoordinateTransform transform) {
+    CHECK_EQ(gy.ndim(), x_shape.size());
+    CHECK_EQ(gy.ndim(), scales.size());
+    chainerx::Array t = chainerx::AsContiguous(gy.ToNative().AsType(chainerx::Dtype::kFloat32));
+    for (int axis = gy.ndim() - 1; axis >= 0; --axis) {
+        const int64_t in_size = x_shape[axis];
+        const int64_t out_size = gy.shape()[axis];
+        if (in_size == out_size && (transform == CoordinateTransform::kAlignCorners || scales[axis] == 1.0)) {
+            continue;
+        }
+        t = ResizeAxisGrad(t, axis, in_size, MakeResizeTable(in_size, out_size, scales[axis], mode, transform));
+    }
+    if (t.dtype() != gy.dtype()) {
+        t = t.AsType(gy.dtype());
+    }
+    return t.ToDevice(gy.device());
 }
 
 template <int static_xy_scale>
@@ -79,8 +292,8 @@ chainerx::Array Upsample2D32bitForCPU(chainerx::Array x, const chainerx::Shape&
     chainerx::Array y = chainerx::Empty(to_shape, x.dtype(), x.device());
     if (int_scales[2] == 2 && int_scales[3] == 2) {
         Upsample2D32bitForRawPtr<2>(
-                reinterpret_cast<float*>(y.raw_data()),
-                reinterpret_cast<float*>(x.raw_data()),
+                RawPtr<float>(y),
+                RawPtr<float>(x),
                 x.shape()[0],
                 x.shape()[1],
                 x.shape()[2],
@@ -89,8 +302,8 @@ chainerx::Array Upsample2D32bitForCPU(chainerx::Array x, const chainerx::Shape&
                 -1);
     } else {
         Upsample2D32bitForRawPtr<0>(
-                reinterpret_cast<float*>(y.raw_data()),
-                reinterpret_cast<float*>(x.raw_data()),
+                RawPtr<float>(y),
+                RawPtr<float>(x),
                 x.shape()[0],
                 x.shape()[1],
                 x.shape()[2],
@@ -149,120 +362,61 @@ chainerx::Array Upsample(const chainerx::Array& x, const std::vector<int64_t>& s
         return Upsample2D(x, scales);
     }
 
-    chainerx::Array y = chainerx::Zeros(to_shape, x.dtype());
-    NaiveUpsample(x, y, scales);
-    return y;
+    return ResizeND(x, to_shape, std::vector<double>(scales.begin(), scales.end()), ResizeMode::kNearest, CoordinateTransform::kAsymmetric);
 }
 
-void GetIntScales(const chainerx::Array& scales, std::vector<int64_t>* int_scales, bool* has_upsample, bool* has_downsample) {
-    CHECK_EQ(1, scales.ndim());
-
-    *has_upsample = false;
-    *has_downsample = false;
-    for (int64_t i = 0; i < scales.shape()[0]; ++i) {
-        chainerx::Scalar scale = chainerx::AsScalar(scales.At({i}));
-        int64_t int_scale;
-        if (scale.kind() == chainerx::DtypeKind::kFloat) {
-            double double_scale = static_cast<double>(scale);
-            if (double_scale > 1.0) {
-                *has_upsample = true;
-            } else if (double_scale < 1.0) {
-                double_scale = 1.0 / double_scale;
-                *has_downsample = true;
-            }
-            int_scale = static_cast<int64_t>(std::round(double_scale));
-            CHECK_EQ(double_scale, int_scale) << "Only int scale is supported: " << scales;
-        } else {
-            int_scale = static_cast<int64_t>(scale);
-            *has_upsample = int_scale > 1;
+// Returns true if `scales` are integers no less than one.
+bool GetIntUpsampleScales(const std::vector<double>& scales, std::vector<int64_t>* int_scales) {
+    for (double scale : scales) {
+        if (scale < 1.0 || scale != std::round(scale)) {
+            return false;
         }
-        CHECK_LE(1, int_scale) << "scales must be greater than or equal to 1: " << scales;
-        int_scales->push_back(int_scale);
+        int_scales->push_back(static_cast<int64_t>(scale));
     }
-
-    CHECK(!*has_upsample || !*has_downsample) << "Resize with both upsampling and downsampling is not supported: scales=" << scales;
+    return true;
 }
 
 }  // namespace
 
 chainerx::Array ResizeOp::RunImpl(ChxVMState* st, const chainerx::Array& x, const chainerx::Array& scales) {
-    std::vector<int64_t> int_scales;
-    bool has_upsample = false;
-    bool has_downsample = false;
-    GetIntScales(scales, &int_scales, &has_upsample, &has_downsample);
-
-    if (has_downsample) {
-        return Downsample(x, int_scales);
-    }
-    if (has_upsample) {
-        return Upsample(x, int_scales);
+    CHECK_EQ(1, scales.ndim());
+    CHECK_EQ(x.ndim(), scales.shape()[0]) << "Unexpected scales: " << scales;
+    std::vector<double> float_scales;
+    chainerx::Shape y_shape(x.shape());
+    for (int64_t i = 0; i < x.ndim(); ++i) {
+        float_scales.push_back(static_cast<double>(chainerx::AsScalar(scales.At({i}))));
+        CHECK_LT(0, float_scales.back()) << "scales must be positive: " << scales;
+        y_shape[i] = static_cast<int64_t>(std::floor(x.shape()[i] * float_scales.back()));
     }
-    CHECK(false);
-}
 
-chainerx::Array ResizeGradOp::RunImpl(ChxVMState* st, const chainerx::Array& x, const chainerx::Array& scales) {
+    const ResizeMode resize_mode = GetResizeMode(mode);
     std::vector<int64_t> int_scales;
-    bool has_upsample = false;
-    bool has_downsample = false;
-    GetIntScales(chainerx::Reciprocal(scales), &int_scales, &has_upsample, &has_downsample);
-
-    chainerx::Array y;
-    if (has_downsample) {
-        y = Downsample(x, int_scales);
-    } else if (has_upsample) {
-        y = Upsample(x, int_scales);
-    } else {
-        CHECK(false);
-    }
-
-    int64_t total_scale = 1;
-    for (int64_t scale : int_scales) {
-        total_scale *= scale;
-    }
-    if (has_downsample) {
-        y *= total_scale;
-    } else if (has_upsample) {
-        y /= total_scale;
+    if (resize_mode == ResizeMode::kNearest && GetIntUpsampleScales(float_scales, &int_scales)) {
+        return Upsample(x, int_scales);
     }
-    return y;
+    return ResizeND(x, y_shape, float_scales, resize_mode, CoordinateTransform::kAsymmetric);
 }
 
-namespace {
+chainerx::Array ResizeGradOp::RunImpl(
+        ChxVMState* st, const chainerx::Array& gy, const chainerx::Array& scales, const chainerx::Shape& x_shape) {
+    CHECK_EQ(1, scales.ndim());
+    CHECK_EQ(gy.ndim(), scales.shape()[0]) << "Unexpected scales: " << scales;
+    CHECK_EQ(gy.ndim(), x_shape.size());
+    std::vector<double> float_scales;
+    for (int64_t i = 0; i < gy.ndim(); ++i) {
+        float_scales.push_back(static_cast<double>(chainerx::AsScalar(scales.At({i}))));
+    }
 
-void ResizeImagesFloat32ForCPU(const chainerx::Array& x, const chainerx::Array& y) {
-    const float* src = static_cast<float*>(x.raw_data());
-    float* dst = static_cast<float*>(y.raw_data());
-
-    const int64_t sh = x.shape()[2];
-    const int64_t sw = x.shape()[3];
-    const int64_t dh = y.shape()[2];
-    const int64_t dw = y.shape()[3];
-
-    for (int64_t b = 0; b < x.shape()[0]; ++b) {
-        for (int64_t c = 0; c < x.shape()[1]; ++c) {
-            const float* sp = src + ((b * x.shape()[1]) + c) * sh * sw;
-            for (int64_t yi = 0; yi < dh; ++yi) {
-                const double v = static_cast<double>(yi) * (sh - 1) / (dh - 1);
-                const int v0 = std::min<int>(v, sh - 2);
-                const int v1 = v0 + 1;
-                for (int64_t xi = 0; xi < dw; ++xi) {
-                    const double u = static_cast<double>(xi) * (sw - 1) / (dw - 1);
-                    const int u0 = std::min<int>(u, sw - 2);
-                    const int u1 = u0 + 1;
-                    const double w1 = (u1 - u) * (v1 - v);
-                    const double w2 = (u - u0) * (v1 - v);
-                    const double w3 = (u1 - u) * (v - v0);
-                    const double w4 = (u - u0) * (v - v0);
-                    const float val = (w1 * sp[v0 * sw + u0] + w2 * sp[v0 * sw + u1] + w3 * sp[v1 * sw + u0] + w4 * sp[v1 * sw + u1]);
-                    *dst++ = val;
-                }
-            }
-        }
+    // Integer upsampling of images is the transpose of sum pooling.
+    std::vector<int64_t> int_scales;
+    if (GetIntUpsampleScales(float_scales, &int_scales) && int_scales.size() == 4 && int_scales[0] == 1 && int_scales[1] == 1) {
+        return Downsample(gy, int_scales) * (int_scales[2] * int_scales[3]);
     }
+    // Otherwise, including downsampling which picks one of the input
+    // pixels, scatter `gy` to the positions which `ResizeND` sampled.
+    return ResizeNDGrad(gy, x_shape, float_scales, ResizeMode::kNearest, CoordinateTransform::kAsymmetric);
 }
 
-}  // namespace
-
 chainerx::Array ResizeImagesOp::RunImpl(ChxVMState* st, const chainerx::Array& x) {
     CHECK_EQ(4, x.ndim());
     CHECK_EQ(2, output_shape.size());
@@ -270,46 +424,7 @@ chainerx::Array ResizeImagesOp::RunImpl(ChxVMState* st, const chainerx::Array& x
     y_shape[2] = output_shape[0];
     y_shape[3] = output_shape[1];
 
-    if (IsNativeDevice(&x.device()) && x.dtype() == chainerx::Dtype::kFloat32) {
-        chainerx::Array xc = chainerx::AsContiguous(x);
-        chainerx::Array y = chainerx::Empty(y_shape, x.dtype());
-        ResizeImagesFloat32ForCPU(xc, y);
-        return y;
-    }
-
-    chainerx::Array y = chainerx::Zeros(y_shape, x.dtype());
-
-    const int64_t sh = x.shape()[2];
-    const int64_t sw = x.shape()[3];
-    const int64_t dh = y.shape()[2];
-    const int64_t dw = y.shape()[3];
-
-    for (int64_t b = 0; b < x.shape()[0]; ++b) {
-        for (int64_t c = 0; c < x.shape()[1]; ++c) {
-            for (int64_t yi = 0; yi < y_shape[2]; ++yi) {
-                for (int64_t xi = 0; xi < y_shape[3]; ++xi) {
-                    const double u = static_cast<double>(xi) * (sw - 1) / (dw - 1);
-                    const double v = static_cast<double>(yi) * (sh - 1) / (dh - 1);
-                    const int u0 = std::min<int>(u, sw - 2);
-                    const int v0 = std::min<int>(v, sh - 2);
-                    const int u1 = u0 + 1;
-                    const int v1 = v0 + 1;
-                    const double w1 = (u1 - u) * (v1 - v);
-                    const double w2 = (u - u0) * (v1 - v);
-                    const double w3 = (u1 - u) * (v - v0);
-                    const double w4 = (u - u0) * (v - v0);
-                    const double val =
-                            (w1 * static_cast<double>(chainerx::AsScalar(x.At({b, c, v0, u0}))) +
-                             w2 * static_cast<double>(chainerx::AsScalar(x.At({b, c, v0, u1}))) +
-                             w3 * static_cast<double>(chainerx::AsScalar(x.At({b, c, v1, u0}))) +
-                             w4 * static_cast<double>(chainerx::AsScalar(x.At({b, c, v1, u1}))));
-                    y.At({b, c, yi, xi}) += val;
-                }
-            }
-        }
-    }
-
-    return y;
+    return ResizeND(x, y_shape, std::vector<double>(x.ndim(), 1.0), ResizeMode::kLinear, CoordinateTransform::kAlignCorners);
 }
 
 }  // namespace runtime
@@ -1,16 +1,16 @@
-#include <chainerx/backprop_mode.h>
 #include <chainerx/routines/activation.h>
 #include <chainerx/routines/creation.h>
 #include <chainerx/routines/hyperbolic.h>
 #include <chainerx/routines/linalg.h>
 #include <chainerx/routines/logic.h>
 #include <chainerx/routines/manipulation.h>
+#include <chainerx/routines/reduction.h>
 
 #include <common/log.h>
-#include <runtime/backward_context.h>
 #include <runtime/chainerx_util.h>
 #include <runtime/gen_chxvm_ops.h>
 #include <runtime/ops/cudnn_rnn.h>
+#include <runtime/ops/native_rnn.h>
 
 namespace chainer_compiler {
 namespace runtime {
@@ -49,6 +49,12 @@ public:
         }
     }
 
+    // Returns the mask at `time` in the shape of (batch_size, 1).
+    chainerx::Array GetMask(int time) const {
+        CHECK(has_mask_);
+        return chainerx::Reshape(sequence_mask_.At({time}), {batch_size_, 1});
+    }
+
     void MaskOutput(chainerx::Array* out) const {
         if (!has_mask_) return;
         *out = *out * chainerx::Reshape(sequence_mask_, {out->shape()[0], batch_size_, 1});
@@ -62,6 +68,193 @@ private:
     chainerx::Array pmask_, nmask_;
 };
 
+// Keeps the minimal arrays for the backward computation of LSTM. For
+// each direction, the activated gates (i, o, f, and c) and the cell
+// and hidden states before each step are kept in the (seq_length,
+// batch_size, ...) layout. The new cell state is recomputed from them.
+// Peephole weights are kept as well when they are given.
+class LSTMBackwardContext : public ChxVMOpaque {
+public:
+    LSTMBackwardContext(
+            const chainerx::Array& x,
+            const chainerx::Array& w,
+            const chainerx::Array& r,
+            const absl::optional<chainerx::Array>& sequence_lens,
+            const absl::optional<chainerx::Array>& p,
+            int direction,
+            std::vector<chainerx::Array> gates,
+            std::vector<chainerx::Array> c_prevs,
+            std::vector<chainerx::Array> h_prevs)
+        : x_(x),
+          w_(w),
+          r_(r),
+          sequence_lens_(sequence_lens),
+          p_(p),
+          direction_(direction),
+          gates_(std::move(gates)),
+          c_prevs_(std::move(c_prevs)),
+          h_prevs_(std::move(h_prevs)) {
+    }
+    virtual ~LSTMBackwardContext() = default;
+
+    const chainerx::Array& x() const {
+        return x_;
+    }
+
+    const chainerx::Array& w() const {
+        return w_;
+    }
+
+    const chainerx::Array& r() const {
+        return r_;
+    }
+
+    const absl::optional<chainerx::Array>& sequence_lens() const {
+        return sequence_lens_;
+    }
+
+    const absl::optional<chainerx::Array>& p() const {
+        return p_;
+    }
+
+    int direction() const {
+        return direction_;
+    }
+
+    const chainerx::Array& gates(int d) const {
+        return gates_[d];
+    }
+
+    const chainerx::Array& c_prev(int d) const {
+        return c_prevs_[d];
+    }
+
+    const chainerx::Array& h_prev(int d) const {
+        return h_prevs_[d];
+    }
+
+private:
+    chainerx::Array x_;
+    chainerx::Array w_;
+    chainerx::Array r_;
+    absl::optional<chainerx::Array> sequence_lens_;
+    absl::optional<chainerx::Array> p_;
+    int direction_;
+    std::vector<chainerx::Array> gates_;
+    std::vector<chainerx::Array> c_prevs_;
+    std::vector<chainerx::Array> h_prevs_;
+};
+
+// Computes the gradients of LSTM by backpropagation through time.
+// Gradients of the gates of all steps are concatenated so gradients of
+// `x`, `w` and `r` are computed by a single matrix multiplication each.
+// The gradient of the peephole weights is null when LSTM has no `p`.
+std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array> LSTMBackward(
+        const LSTMBackwardContext& context, const chainerx::Array& gy) {
+    // gy: [seq_length, num_directions, batch_size, hidden_size]
+    const chainerx::Array& x = context.x();
+    const chainerx::Array& w = context.w();
+    const chainerx::Array& r = context.r();
+    const int64_t seq_length = x.shape()[0];
+    const int64_t batch_size = x.shape()[1];
+    const int64_t input_size = x.shape()[2];
+    const int64_t hidden_size = w.shape()[1] / 4;
+    const int num_direction = w.shape()[0];
+    const chainerx::Array xs = chainerx::Reshape(x, {seq_length * batch_size, input_size});
+
+    SequenceLengthMask mask(context.sequence_lens(), x.dtype(), seq_length, batch_size);
+    chainerx::Array gx = chainerx::Zeros(x.shape(), x.dtype(), x.device());
+    std::vector<chainerx::Array> gws, grs, gbs, gps;
+    std::vector<chainerx::ArrayIndex> indices(2, chainerx::Slice());
+    const bool has_peepholes = context.p().has_value();
+
+    for (int d = 0; d < num_direction; ++d) {
+        chainerx::Array gyd = gy.At({chainerx::Slice(), d});
+        mask.MaskOutput(&gyd);
+        const chainerx::Array& gates = context.gates(d);
+        const chainerx::Array& c_prevs = context.c_prev(d);
+        const chainerx::Array rd = r.At({d});
+        chainerx::Array pi, po, pf, gpi, gpo, gpf;
+        if (has_peepholes) {
+            chainerx::Array ps = context.p()->At({d});
+            pi = ps.At({chainerx::Slice(0, hidden_size)});
+            po = ps.At({chainerx::Slice(hidden_size, 2 * hidden_size)});
+            pf = ps.At({chainerx::Slice(2 * hidden_size, 3 * hidden_size)});
+            gpi = chainerx::Zeros({hidden_size}, x.dtype(), x.device());
+            gpo = chainerx::Zeros({hidden_size}, x.dtype(), x.device());
+            gpf = chainerx::Zeros({hidden_size}, x.dtype(), x.device());
+        }
+
+        chainerx::Array gh = chainerx::Zeros({batch_size, hidden_size}, x.dtype(), x.device());
+        chainerx::Array gc = chainerx::Zeros({batch_size, hidden_size}, x.dtype(), x.device());
+        std::vector<chainerx::Array> ggates(seq_length);
+        for (int64_t t = seq_length - 1; t >= 0; --t) {
+            int64_t time = t;
+            if (context.direction() == 1 || d == 1) time = seq_length - t - 1;
+
+            const chainerx::Array g = gates.At({time});
+            indices[1] = chainerx::Slice({0, hidden_size});
+            chainerx::Array i = g.At(indices);
+            indices[1] = chainerx::Slice({hidden_size, hidden_size * 2});
+            chainerx::Array o = g.At(indices);
+            indices[1] = chainerx::Slice({hidden_size * 2, hidden_size * 3});
+            chainerx::Array f = g.At(indices);
+            indices[1] = chainerx::Slice({hidden_size * 3, hidden_size * 4});
+            chainerx::Array nc = g.At(indices);
+            const chainerx::Array c_prev = c_prevs.At({time});
+            const chainerx::Array c = f * c_prev + i * nc;
+            const chainerx::Array tanh_c = chainerx::Tanh(c);
+
+            gh = gh + gyd.At({time});
+            // Masked steps pass the states through.
+            chainerx::Array gh_pass, gc_pass;
+            if (mask.has_mask()) {
+                chainerx::Array m = mask.GetMask(time);
+                gh_pass = gh * (1 - m);
+                gc_pass = gc * (1 - m);
+                gh = gh * m;
+                gc = gc * m;
+            }
+
+            chainerx::Array go = gh * tanh_c * o * (1 - o);
+            gc = gc + gh * o * (1 - tanh_c * tanh_c);
+            // The output gate peeks the updated cell state.
+            if (has_peepholes) gc = gc + go * po;
+            chainerx::Array gi = gc * nc * i * (1 - i);
+            chainerx::Array gf = gc * c_prev * f * (1 - f);
+            chainerx::Array gnc = gc * i * (1 - nc * nc);
+            ggates[time] = chainerx::Concatenate({gi, go, gf, gnc}, 1);
+
+            gh = chainerx::Dot(ggates[time], rd);
+            gc = gc * f;
+            if (has_peepholes) {
+                // The input and forget gates peek the previous cell state.
+                gc = gc + gi * pi + gf * pf;
+                gpi += chainerx::Sum(gi * c_prev, chainerx::Axes{0});
+                gpo += chainerx::Sum(go * c, chainerx::Axes{0});
+                gpf += chainerx::Sum(gf * c_prev, chainerx::Axes{0});
+            }
+            if (mask.has_mask()) {
+                gh = gh + gh_pass;
+                gc = gc + gc_pass;
+            }
+        }
+
+        const chainerx::Array gg = chainerx::Reshape(chainerx::Stack(ggates, 0), {seq_length * batch_size, 4 * hidden_size});
+        const chainerx::Array ggt = chainerx::Transpose(gg);
+        gx += chainerx::Reshape(chainerx::Dot(gg, w.At({d})), x.shape());
+        gws.push_back(chainerx::Dot(ggt, xs));
+        grs.push_back(chainerx::Dot(ggt, chainerx::Reshape(context.h_prev(d), {seq_length * batch_size, hidden_size})));
+        const chainerx::Array gb = chainerx::Sum(gg, chainerx::Axes{0});
+        gbs.push_back(chainerx::Concatenate({gb, gb}, 0));
+        if (has_peepholes) gps.push_back(chainerx::Concatenate({gpi, gpo, gpf}, 0));
+    }
+
+    chainerx::Array gp;
+    if (has_peepholes) gp = chainerx::Stack(gps, 0);
+    return std::make_tuple(gx, chainerx::Stack(gws, 0), chainerx::Stack(grs, 0), chainerx::Stack(gbs, 0), gp);
+}
+
 }  // namespace
 
 std::tuple<chainerx::Array, chainerx::Array> RNNOp::RunImpl(
@@ -76,6 +269,11 @@ std::tuple<chainerx::Array, chainerx::Array> RNNOp::RunImpl(
     // W: [num_directions, hidden_size, input_size]
     // R: [num_directions, hidden_size, hidden_size]
     // B: [num_directions, 2 * hidden_size]
+    {
+        std::tuple<chainerx::Array, chainerx::Array> result;
+        if (NativeRNN(x, w, r, b, sequence_lens, initial_h, direction, &result)) return result;
+    }
+
     // TODO(hamaji): They cannot be tested as ONNX does not have test cases.
     CHECK_EQ(1, w.shape()[0]) << "Multi-directional RNN is not implemented yet";
     CHECK_EQ(0, direction) << "Reversed RNN is not implemented yet";
@@ -131,6 +329,11 @@ std::tuple<chainerx::Array, chainerx::Array> GRUOp::RunImpl(
     // W: [num_directions, 3 * hidden_size, input_size]
     // R: [num_directions, 3 * hidden_size, hidden_size]
     // B: [num_directions, 6 * hidden_size]
+    {
+        std::tuple<chainerx::Array, chainerx::Array> result;
+        if (NativeGRU(x, w, r, b, sequence_lens, initial_h, linear_before_reset, direction, &result)) return result;
+    }
+
     int64_t seq_length = x.shape()[0];
     int64_t batch_size = x.shape()[1];
     CHECK_EQ(0, w.shape()[1] % 3);
@@ -237,10 +440,15 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
     }
 #endif  // CHAINER_COMPILER_ENABLE_CUDNN
 
-    std::vector<chainerx::Array> xs = {x, w, r};
-    if (b.has_value()) xs.push_back(*b);
-    std::unique_ptr<BackwardContext> bwd(new BackwardContext("LSTM", xs));
-    chainerx::ForceBackpropModeScope bp_scope{bwd->backprop_id()};
+    // The fused kernel does not record the graph for backprop.
+    if (ctx < 0) {
+        std::tuple<chainerx::Array, chainerx::Array, chainerx::Array> result;
+        if (NativeLSTM(x, w, r, b, sequence_lens, initial_h, initial_c, p, direction, &result)) {
+            return std::make_tuple(std::get<0>(result), std::get<1>(result), std::get<2>(result), static_cast<ChxVMOpaque*>(nullptr));
+        }
+    }
+
+    const bool need_backward = ctx >= 0;
     // X: [seq_length, batch_size, input_size]
     // W: [num_directions, 4 * hidden_size, input_size]
     // R: [num_directions, 4 * hidden_size, hidden_size]
@@ -265,6 +473,7 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
     chainerx::Array outputs[2];
     chainerx::Array hs[2];
     chainerx::Array cs[2];
+    std::vector<chainerx::Array> saved_gates, saved_c_prevs, saved_h_prevs;
 
     for (int d = 0; d < num_direction; ++d) {
         chainerx::Array wt = chainerx::Transpose(w.At({d}));
@@ -288,6 +497,12 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
         }
 
         std::vector<chainerx::Array> outs(seq_length);
+        std::vector<chainerx::Array> gates_t, c_prev_t, h_prev_t;
+        if (need_backward) {
+            gates_t.resize(seq_length);
+            c_prev_t.resize(seq_length);
+            h_prev_t.resize(seq_length);
+        }
         for (int64_t t = 0; t < x.shape()[0]; ++t) {
             int64_t time = t;
             if (direction == 1 || d == 1) time = x.shape()[0] - t - 1;
@@ -308,13 +523,21 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
             if (p.has_value()) {
                 i = i + pi * c;
                 f = f + pf * c;
-                o = o + po * c;
             }
             i = Sigmoid(i);
             f = Sigmoid(f);
-            nc = chainerx::Tanh(nc);
+            chainerx::Array g = chainerx::Tanh(nc);
+            nc = f * c + i * g;
+            // The output gate peeks the updated cell state.
+            if (p.has_value()) {
+                o = o + po * nc;
+            }
             o = Sigmoid(o);
-            nc = f * c + i * nc;
+            if (need_backward) {
+                gates_t[time] = chainerx::Concatenate({i, o, f, g}, 1);
+                c_prev_t[time] = c;
+                h_prev_t[time] = h;
+            }
             chainerx::Array nh = o * chainerx::Tanh(nc);
             mask.UpdateState(time, nc, &c);
             mask.UpdateState(time, nh, &h);
@@ -326,6 +549,11 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
         outputs[d] = output;
         hs[d] = h;
         cs[d] = c;
+        if (need_backward) {
+            saved_gates.push_back(chainerx::Stack(gates_t, 0));
+            saved_c_prevs.push_back(chainerx::Stack(c_prev_t, 0));
+            saved_h_prevs.push_back(chainerx::Stack(h_prev_t, 0));
+        }
     }
 
     chainerx::Array output, h, c;
@@ -339,36 +567,38 @@ std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, ChxVMOpaque*> LSTM
         c = chainerx::Stack({cs[0], cs[1]}, 0);
     }
 
+    if (!need_backward) {
+        return std::make_tuple(output, h, c, static_cast<ChxVMOpaque*>(nullptr));
+    }
+
+    std::vector<chainerx::Array> retained_arrays = {x, w, r};
+    for (int d = 0; d < num_direction; ++d) {
+        retained_arrays.push_back(saved_gates[d]);
+        retained_arrays.push_back(saved_c_prevs[d]);
+        retained_arrays.push_back(saved_h_prevs[d]);
+    }
+    ChxVMOpaque* bwd = new LSTMBackwardContext(
+            x, w, r, sequence_lens, p, direction, std::move(saved_gates), std::move(saved_c_prevs), std::move(saved_h_prevs));
     if (st->options().dump_memory_usage >= 1) {
-        WARN_ONCE("Retained arrays for LSTM on CPU is inaccurate");
-        std::vector<chainerx::Array> retained_arrays = {x, w, r, output, h, c};
-        for (const auto& a : {b, sequence_lens, initial_h, initial_c, p}) {
-            if (a.has_value()) {
-                retained_arrays.push_back(*a);
-            }
-        }
         bwd->SetRetainedArrays(retained_arrays);
     }
-
-    bwd->SetOutput({output});
-    return std::make_tuple(output, h, c, bwd.release());
+    return std::make_tuple(output, h, c, bwd);
 }
 
-std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array> LSTMGradOp::RunImpl(
+std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array> LSTMGradOp::RunImpl(
         ChxVMState* st, const chainerx::Array& gy, const ChxVMOpaque& ctx) {
 #if CHAINER_COMPILER_ENABLE_CUDNN
     {
+        // cuDNN is used only for LSTM without peepholes.
         std::tuple<chainerx::Array, chainerx::Array, chainerx::Array, chainerx::Array> result;
-        if (CudnnLSTMGrad(gy, ctx, &result)) return result;
+        if (CudnnLSTMGrad(gy, ctx, &result)) {
+            return std::make_tuple(std::get<0>(result), std::get<1>(result), std::get<2>(result), std::get<3>(result), chainerx::Array());
+        }
     }
 #endif
 
-    auto& context = dynamic_cast<const BackwardContext&>(ctx);
-    chainerx::ForceBackpropModeScope bp_scope{context.backprop_id()};
-    std::vector<chainerx::Array> gxs{context.Backward({gy})};
-    CHECK_EQ(4UL, gxs.size());
-
-    return std::make_tuple(gxs[0], gxs[1], gxs[2], gxs[3]);
+    auto& context = dynamic_cast<const LSTMBackwardContext&>(ctx);
+    return LSTMBackward(context, gy);
 }
 
 }  // namespace runtime
@@ -1,11 +1,13 @@
 #include <math.h>
 
+#include <limits>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include <chainerx/array.h>
 #include <chainerx/routines/creation.h>
 #include <chainerx/routines/manipulation.h>
-#include <chainerx/routines/statistics.h>
 
 #include <common/log.h>
 #include <runtime/chainerx_util.h>
@@ -18,62 +20,191 @@ namespace runtime {
 // TODO(hamaji): Move this to ChainerX.
 namespace {
 
-chainerx::Slice ROIPoolingSlice(double size, double stride, double max_size, double roi_offset) {
+std::pair<int64_t, int64_t> ROIPoolingRange(double size, double stride, double max_size, double roi_offset) {
     int64_t start = int64_t(floor(size * stride));
     int64_t end = int64_t(ceil((size + 1) * stride));
     start = std::min<double>(std::max<double>(start + roi_offset, 0), max_size);
     end = std::min<double>(std::max<double>(end + roi_offset, 0), max_size);
-    return chainerx::Slice(start, end);
+    return std::make_pair(start, end);
 }
 
-template <class ReduceFn>
-chainerx::Array ROIPool2D(
+// Input ranges of output bins of a single ROI for ROI pooling.
+struct ROIPoolingBins {
+    int64_t batch_index;
+    std::vector<std::pair<int64_t, int64_t>> ys;
+    std::vector<std::pair<int64_t, int64_t>> xs;
+};
+
+std::vector<ROIPoolingBins> GetROIPoolingBins(
         const chainerx::Array& bottom_data,
         const chainerx::Array& bottom_rois,
         const chainerx::Array& bottom_roi_indices,
         const Int64StackVector& output_shape,
-        const float spatial_scale,
-        ReduceFn fn) {
+        const float spatial_scale) {
     CHECK_EQ(4, bottom_data.ndim());
     CHECK_EQ(2, output_shape.size());
-    const int64_t channels = bottom_data.shape()[1];
     const int64_t height = bottom_data.shape()[2];
     const int64_t width = bottom_data.shape()[3];
     const int64_t n_rois = bottom_rois.shape()[0];
     const int64_t outh = output_shape[0];
     const int64_t outw = output_shape[1];
-    chainerx::Array top_data = chainerx::Zeros(chainerx::Shape{n_rois, channels, outh, outw}, bottom_rois.dtype());
+    const chainerx::Array rois = chainerx::AsContiguous(bottom_rois.AsType(chainerx::Dtype::kFloat64));
+    const chainerx::Array roi_indices = chainerx::AsContiguous(bottom_roi_indices.AsType(chainerx::Dtype::kInt64));
+    const double* rois_ptr = RawPtr<const double>(rois);
+    const int64_t* roi_indices_ptr = RawPtr<const int64_t>(roi_indices);
 
+    std::vector<ROIPoolingBins> bins(n_rois);
     for (int64_t i_roi = 0; i_roi < n_rois; ++i_roi) {
-        int64_t idx = int64_t(chainerx::AsScalar(bottom_roi_indices.At({i_roi})));
-        int64_t ymin = round(double(chainerx::AsScalar(bottom_rois.At({i_roi, 0})) * spatial_scale));
-        int64_t xmin = round(double(chainerx::AsScalar(bottom_rois.At({i_roi, 1})) * spatial_scale));
-        int64_t ymax = round(double(chainerx::AsScalar(bottom_rois.At({i_roi, 2})) * spatial_scale));
-        int64_t xmax = round(double(chainerx::AsScalar(bottom_rois.At({i_roi, 3})) * spatial_scale));
+        const double* roi = &rois_ptr[i_roi * 4];
+        int64_t ymin = round(roi[0] * spatial_scale);
+        int64_t xmin = round(roi[1] * spatial_scale);
+        int64_t ymax = round(roi[2] * spatial_scale);
+        int64_t xmax = round(roi[3] * spatial_scale);
         int64_t roi_height = std::max<int64_t>(ymax - ymin, 1);
         int64_t roi_width = std::max<int64_t>(xmax - xmin, 1);
         double strideh = 1. * roi_height / outh;
         double stridew = 1. * roi_width / outw;
 
+        ROIPoolingBins* b = &bins[i_roi];
+        b->batch_index = roi_indices_ptr[i_roi];
         for (int64_t outy = 0; outy < outh; ++outy) {
-            const chainerx::Slice& sliceh = ROIPoolingSlice(outy, strideh, height, ymin);
-            if (sliceh.stop() <= sliceh.start()) {
-                continue;
-            }
+            b->ys.push_back(ROIPoolingRange(outy, strideh, height, ymin));
+        }
+        for (int64_t outx = 0; outx < outw; ++outx) {
+            b->xs.push_back(ROIPoolingRange(outx, stridew, width, xmin));
+        }
+    }
+    return bins;
+}
 
-            for (int64_t outx = 0; outx < outw; ++outx) {
-                const chainerx::Slice& slicew = ROIPoolingSlice(outx, stridew, width, xmin);
-                if (slicew.stop() <= slicew.start()) {
-                    continue;
+// Computes ROI pooling for a single channel of a single ROI. Empty
+// bins are filled by zeros.
+template <bool is_max, typename T>
+void ROIPool2DChannel(const ROIPoolingBins& bins, int64_t width, const T* bottom, T* top) {
+    for (const std::pair<int64_t, int64_t>& y : bins.ys) {
+        for (const std::pair<int64_t, int64_t>& x : bins.xs) {
+            T v = 0;
+            if (y.first < y.second && x.first < x.second) {
+                if (is_max) {
+                    v = std::numeric_limits<T>::lowest();
+                    for (int64_t iy = y.first; iy < y.second; ++iy) {
+                        for (int64_t ix = x.first; ix < x.second; ++ix) {
+                            v = std::max(v, bottom[iy * width + ix]);
+                        }
+                    }
+                } else {
+                    double sum = 0;
+                    for (int64_t iy = y.first; iy < y.second; ++iy) {
+                        for (int64_t ix = x.first; ix < x.second; ++ix) {
+                            sum += bottom[iy * width + ix];
+                        }
+                    }
+                    v = sum / ((y.second - y.first) * (x.second - x.first));
                 }
+            }
+            *top++ = v;
+        }
+    }
+}
 
-                chainerx::Array roi_data = bottom_data.At({idx, chainerx::Slice(), sliceh, slicew}).Reshape({channels, -1});
-                top_data.At({i_roi, chainerx::Slice(), outy, outx}) += fn(roi_data, 1, false);
+// Accumulates the gradient of ROI pooling for a single channel of a
+// single ROI. The max variant propagates to the first maximum element.
+template <bool is_max, typename T>
+void ROIPool2DGradChannel(const ROIPoolingBins& bins, int64_t width, const T* bottom, const T* gy, T* gx) {
+    for (const std::pair<int64_t, int64_t>& y : bins.ys) {
+        for (const std::pair<int64_t, int64_t>& x : bins.xs) {
+            const T g = *gy++;
+            if (y.second <= y.first || x.second <= x.first) {
+                continue;
+            }
+            if (is_max) {
+                int64_t argmax = y.first * width + x.first;
+                for (int64_t iy = y.first; iy < y.second; ++iy) {
+                    for (int64_t ix = x.first; ix < x.second; ++ix) {
+                        if (bottom[argmax] < bottom[iy * width + ix]) {
+                            argmax = iy * width + ix;
+                        }
+                    }
+                }
+                gx[argmax] += g;
+            } else {
+                const T v = g / ((y.second - y.first) * (x.second - x.first));
+                for (int64_t iy = y.first; iy < y.second; ++iy) {
+                    for (int64_t ix = x.first; ix < x.second; ++ix) {
+                        gx[iy * width + ix] += v;
+                    }
+                }
             }
         }
     }
+}
 
-    return top_data;
+template <bool is_max, typename T>
+chainerx::Array ROIPool2D(
+        const chainerx::Array& bottom_data,
+        const chainerx::Array& bottom_rois,
+        const chainerx::Array& bottom_roi_indices,
+        const Int64StackVector& output_shape,
+        const float spatial_scale) {
+    const std::vector<ROIPoolingBins> bins = GetROIPoolingBins(bottom_data, bottom_rois, bottom_roi_indices, output_shape, spatial_scale);
+    const chainerx::Array x = chainerx::AsContiguous(bottom_data.AsType(chainerx::PrimitiveType<T>::kDtype, false));
+    const int64_t channels = x.shape()[1];
+    const int64_t height = x.shape()[2];
+    const int64_t width = x.shape()[3];
+    const int64_t n_rois = bins.size();
+    const int64_t outh = output_shape[0];
+    const int64_t outw = output_shape[1];
+    chainerx::Array top_data = chainerx::Empty(chainerx::Shape{n_rois, channels, outh, outw}, x.dtype(), x.device());
+    const T* bottom_ptr = RawPtr<const T>(x);
+    T* top_ptr = RawPtr<T>(top_data);
+
+    // Each (ROI, channel) pair writes a distinct part of the output.
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for if (n_rois >= 20)
+#endif
+    for (int64_t i = 0; i < n_rois * channels; ++i) {
+        const ROIPoolingBins& b = bins[i / channels];
+        const int64_t c = i % channels;
+        const T* bottom = &bottom_ptr[(b.batch_index * channels + c) * height * width];
+        ROIPool2DChannel<is_max>(b, width, bottom, &top_ptr[i * outh * outw]);
+    }
+    return top_data.AsType(bottom_data.dtype(), false);
+}
+
+template <bool is_max, typename T>
+chainerx::Array ROIPool2DGrad(
+        const chainerx::Array& gy,
+        const chainerx::Array& bottom_data,
+        const chainerx::Array& bottom_rois,
+        const chainerx::Array& bottom_roi_indices,
+        const Int64StackVector& output_shape,
+        const float spatial_scale) {
+    const std::vector<ROIPoolingBins> bins = GetROIPoolingBins(bottom_data, bottom_rois, bottom_roi_indices, output_shape, spatial_scale);
+    const chainerx::Array x = chainerx::AsContiguous(bottom_data.AsType(chainerx::PrimitiveType<T>::kDtype, false));
+    const chainerx::Array gyc = chainerx::AsContiguous(gy.AsType(x.dtype(), false));
+    const int64_t channels = x.shape()[1];
+    const int64_t height = x.shape()[2];
+    const int64_t width = x.shape()[3];
+    const int64_t n_rois = bins.size();
+    const int64_t out_size = output_shape[0] * output_shape[1];
+    chainerx::Array gx = chainerx::Zeros(x.shape(), x.dtype(), x.device());
+    const T* bottom_ptr = RawPtr<const T>(x);
+    const T* gy_ptr = RawPtr<const T>(gyc);
+    T* gx_ptr = RawPtr<T>(gx);
+
+    // ROIs may share an image, so only channels are processed in
+    // parallel.
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64_t c = 0; c < channels; ++c) {
+        for (int64_t i_roi = 0; i_roi < n_rois; ++i_roi) {
+            const ROIPoolingBins& b = bins[i_roi];
+            const int64_t offset = (b.batch_index * channels + c) * height * width;
+            ROIPool2DGradChannel<is_max>(b, width, &bottom_ptr[offset], &gy_ptr[(i_roi * channels + c) * out_size], &gx_ptr[offset]);
+        }
+    }
+    return gx.AsType(bottom_data.dtype(), false);
 }
 
 absl::optional<std::tuple<double, int64_t, int64_t>> get_bounds(double p, int64_t limit) {
@@ -106,7 +237,7 @@ T& ContiguousArrayAt(chainerx::Array& a, const ArrayIndices& indices) {
         index += indices[i] * stride;
     }
     CHECK(index < a.GetTotalSize());
-    return *(static_cast<T*>(a.raw_data()) + index);
+    return *(RawPtr<T>(a) + index);
 }
 
 template <typename T>
@@ -122,7 +253,7 @@ bool is_roi_covered_by_bottom_data(
     return is_p_covered(roi_start_h, roi_end_h, height) && is_p_covered(roi_start_w, roi_end_w, width);
 }
 
-template <class ReduceMode>
+template <class ReduceMode, typename T>
 class ROIAlign2DImpl {
 public:
     ROIAlign2DImpl(
@@ -140,16 +271,17 @@ public:
           pooled_height(output_shape[0]),
           pooled_width(output_shape[1]),
           roi_bin_grid_h(sampling_ratio[0]),
-          roi_bin_grid_w(sampling_ratio[1]) {
-        contiguous_bottom_data = chainerx::AsContiguous(bottom_data);
+          roi_bin_grid_w(sampling_ratio[1]),
+          dtype(bottom_data.dtype()) {
+        contiguous_bottom_data = chainerx::AsContiguous(bottom_data.AsType(chainerx::PrimitiveType<T>::kDtype, false));
         contiguous_bottom_roi_indices = chainerx::AsContiguous(bottom_roi_indices);
-        contiguous_bottom_rois = chainerx::AsContiguous(bottom_rois);
-        top_data = chainerx::Empty(chainerx::Shape{n_rois, channels, pooled_height, pooled_width}, bottom_data.dtype());
-        bottom_ptr = static_cast<float*>(contiguous_bottom_data.raw_data());
-        top_ptr = static_cast<float*>(top_data.raw_data());
+        contiguous_bottom_rois = chainerx::AsContiguous(bottom_rois.AsType(chainerx::Dtype::kFloat64, false));
+        bottom_ptr = RawPtr<T>(contiguous_bottom_data);
     }
 
     chainerx::Array Run() {
+        top_data = chainerx::Empty(chainerx::Shape{n_rois, channels, pooled_height, pooled_width}, contiguous_bottom_data.dtype());
+        top_ptr = RawPtr<T>(top_data);
         if (n_rois < 20) {
             for (int64_t n = 0; n < n_rois; ++n) {
                 RunROI(n);
@@ -162,7 +294,37 @@ public:
                 RunROI(n);
             }
         }
-        return top_data;
+        return top_data.AsType(dtype, false);
+    }
+
+    chainerx::Array RunGrad(const chainerx::Array& gy) {
+        const chainerx::Array contiguous_gy = chainerx::AsContiguous(gy.AsType(contiguous_bottom_data.dtype(), false));
+        chainerx::Array gx = chainerx::Zeros(contiguous_bottom_data.shape(), contiguous_bottom_data.dtype(), contiguous_bottom_data.device());
+        const T* gy_ptr = RawPtr<const T>(contiguous_gy);
+        T* gx_ptr = RawPtr<T>(gx);
+
+        std::vector<PixelWeight> pixel_weights(pooled_height * pooled_width * roi_bin_grid_h * roi_bin_grid_w);
+        std::vector<PixelPos> pixel_x(pooled_width * roi_bin_grid_w);
+        std::vector<PixelPos> pixel_y(pooled_height * roi_bin_grid_h);
+        for (int64_t n = 0; n < n_rois; ++n) {
+            const int64_t roi_batch_ind = PrepareROI(n, true /* bounded */, &pixel_x, &pixel_y, &pixel_weights);
+            // ROIs may share an image, so only channels of a ROI are
+            // processed in parallel.
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for if (channels >= 16)
+#endif
+            for (int64_t c = 0; c < channels; ++c) {
+                const int64_t offset = (roi_batch_ind * channels + c) * height * width;
+                CalculateGrad(
+                        pixel_weights,
+                        pixel_x,
+                        pixel_y,
+                        &bottom_ptr[offset],
+                        &gy_ptr[(n * channels + c) * pooled_height * pooled_width],
+                        &gx_ptr[offset]);
+            }
+        }
+        return gx.AsType(dtype, false);
     }
 
 private:
@@ -184,11 +346,15 @@ private:
         double w1, w2, w3, w4;
     };
 
-    void RunROI(int n) {
-        std::vector<PixelWeight> pixel_weights(pooled_height * pooled_width * roi_bin_grid_h * roi_bin_grid_w);
-        std::vector<PixelPos> pixel_x(pooled_width * roi_bin_grid_w);
-        std::vector<PixelPos> pixel_y(pooled_height * roi_bin_grid_h);
-
+    // Fills sampling positions and their bilinear weights for the
+    // `n`-th ROI and returns its batch index. Positions are clipped
+    // unless the ROI is known to be inside of the image.
+    int64_t PrepareROI(
+            int64_t n,
+            bool bounded,
+            std::vector<PixelPos>* pixel_x,
+            std::vector<PixelPos>* pixel_y,
+            std::vector<PixelWeight>* pixel_weights) const {
         int64_t roi_batch_ind;
         if (contiguous_bottom_roi_indices.dtype() == chainerx::Dtype::kInt64) {
             roi_batch_ind = ContiguousArrayAt<int64_t>(contiguous_bottom_roi_indices, {n});
@@ -197,41 +363,61 @@ private:
         } else {
             CHECK(false) << "Unexpected dtype for roi bottom indices: " << contiguous_bottom_roi_indices.dtype();
         }
-        double roi_start_h = ContiguousArrayAt<float>(contiguous_bottom_rois, {n, 0}) * spatial_scale;
-        double roi_start_w = ContiguousArrayAt<float>(contiguous_bottom_rois, {n, 1}) * spatial_scale;
-        double roi_end_h = ContiguousArrayAt<float>(contiguous_bottom_rois, {n, 2}) * spatial_scale;
-        double roi_end_w = ContiguousArrayAt<float>(contiguous_bottom_rois, {n, 3}) * spatial_scale;
+        double roi_start_h = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 0}) * spatial_scale;
+        double roi_start_w = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 1}) * spatial_scale;
+        double roi_end_h = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 2}) * spatial_scale;
+        double roi_end_w = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 3}) * spatial_scale;
 
         double roi_height = std::max<double>(roi_end_h - roi_start_h, 1.);
         double roi_width = std::max<double>(roi_end_w - roi_start_w, 1.);
         double bin_size_h = roi_height / pooled_height;
         double bin_size_w = roi_width / pooled_width;
 
-        const float* bottom_base = &bottom_ptr[roi_batch_ind * channels * height * width];
-        float* top_base = &top_ptr[n * channels * pooled_height * pooled_width];
-        if (is_roi_covered_by_bottom_data(roi_start_h, roi_start_w, roi_end_h, roi_end_w, height, width)) {
-            FillPixelPositions(roi_start_h, bin_size_h, pooled_height, roi_bin_grid_h, &pixel_y);
-            FillPixelPositions(roi_start_w, bin_size_w, pooled_width, roi_bin_grid_w, &pixel_x);
-            FillPixelWeights(pixel_x, pixel_y, &pixel_weights);
+        if (bounded) {
+            FillPixelPositionsBounded(roi_start_h, bin_size_h, pooled_height, roi_bin_grid_h, height, pixel_y);
+            FillPixelPositionsBounded(roi_start_w, bin_size_w, pooled_width, roi_bin_grid_w, width, pixel_x);
+        } else {
+            FillPixelPositions(roi_start_h, bin_size_h, pooled_height, roi_bin_grid_h, pixel_y);
+            FillPixelPositions(roi_start_w, bin_size_w, pooled_width, roi_bin_grid_w, pixel_x);
+        }
+        FillPixelWeights(*pixel_x, *pixel_y, pixel_weights);
+        return roi_batch_ind;
+    }
+
+    bool IsROICovered(int64_t n) const {
+        double roi_start_h = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 0}) * spatial_scale;
+        double roi_start_w = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 1}) * spatial_scale;
+        double roi_end_h = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 2}) * spatial_scale;
+        double roi_end_w = ContiguousArrayAt<double>(contiguous_bottom_rois, {n, 3}) * spatial_scale;
+        return is_roi_covered_by_bottom_data(roi_start_h, roi_start_w, roi_end_h, roi_end_w, height, width);
+    }
+
+    void RunROI(int64_t n) {
+        std::vector<PixelWeight> pixel_weights(pooled_height * pooled_width * roi_bin_grid_h * roi_bin_grid_w);
+        std::vector<PixelPos> pixel_x(pooled_width * roi_bin_grid_w);
+        std::vector<PixelPos> pixel_y(pooled_height * roi_bin_grid_h);
+
+        const bool bounded = !IsROICovered(n);
+        const int64_t roi_batch_ind = PrepareROI(n, bounded, &pixel_x, &pixel_y, &pixel_weights);
+        const T* bottom_base = &bottom_ptr[roi_batch_ind * channels * height * width];
+        T* top_base = &top_ptr[n * channels * pooled_height * pooled_width];
+        if (bounded) {
             if (roi_bin_grid_h == 2 && roi_bin_grid_w == 2) {
-                CalculateOutput<false, 2>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
+                CalculateOutput<true, 2>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
             } else {
-                CalculateOutput<false, 0>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
+                CalculateOutput<true, 0>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
             }
         } else {
-            FillPixelPositionsBounded(roi_start_h, bin_size_h, pooled_height, roi_bin_grid_h, height, &pixel_y);
-            FillPixelPositionsBounded(roi_start_w, bin_size_w, pooled_width, roi_bin_grid_w, width, &pixel_x);
-            FillPixelWeights(pixel_x, pixel_y, &pixel_weights);
             if (roi_bin_grid_h == 2 && roi_bin_grid_w == 2) {
-                CalculateOutput<true, 2>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
+                CalculateOutput<false, 2>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
             } else {
-                CalculateOutput<true, 0>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
+                CalculateOutput<false, 0>(pixel_weights, pixel_x, pixel_y, bottom_base, top_base);
             }
         }
     }
 
     void FillPixelPositions(
-            double roi_start, double bin_size_w, int64_t pooled_width, int64_t roi_bin_grid_w, std::vector<PixelPos>* positions) {
+            double roi_start, double bin_size_w, int64_t pooled_width, int64_t roi_bin_grid_w, std::vector<PixelPos>* positions) const {
         for (int64_t px = 0; px < pooled_width; ++px) {
             for (int64_t ix = 0; ix < roi_bin_grid_w; ++ix) {
                 PixelPos* pp = &(*positions)[px * roi_bin_grid_w + ix];
@@ -248,7 +434,7 @@ private:
             int64_t pooled_width,
             int64_t roi_bin_grid_w,
             int64_t width,
-            std::vector<PixelPos>* positions) {
+            std::vector<PixelPos>* positions) const {
         for (int64_t px = 0; px < pooled_width; ++px) {
             for (int64_t ix = 0; ix < roi_bin_grid_w; ++ix) {
                 PixelPos* pp = &(*positions)[px * roi_bin_grid_w + ix];
@@ -264,7 +450,7 @@ private:
     }
 
     void FillPixelWeights(
-            const std::vector<PixelPos>& pixel_x, const std::vector<PixelPos>& pixel_y, std::vector<PixelWeight>* pixel_weights) {
+            const std::vector<PixelPos>& pixel_x, const std::vector<PixelPos>& pixel_y, std::vector<PixelWeight>* pixel_weights) const {
         for (int64_t ph = 0; ph < pooled_height; ++ph) {
             for (int64_t iy = 0; iy < roi_bin_grid_h; ++iy) {
                 const PixelPos& py = pixel_y[ph * roi_bin_grid_h + iy];
@@ -296,8 +482,8 @@ private:
             const std::vector<PixelWeight>& pixel_weights,
             const std::vector<PixelPos>& pixel_x,
             const std::vector<PixelPos>& pixel_y,
-            const float* bottom_base,
-            float* top_base) {
+            const T* bottom_base,
+            T* top_base) {
         int64_t rbgh, rbgw;
         if (static_roi_bin_grid) {
             rbgh = rbgw = static_roi_bin_grid;
@@ -308,7 +494,6 @@ private:
 
         ReduceMode reduce(rbgh, rbgw);
         for (int64_t c = 0; c < channels; ++c) {
-            auto pixel_weights_iterator = pixel_weights.begin();
             for (int64_t ph = 0; ph < pooled_height; ++ph) {
                 for (int64_t pw = 0; pw < pooled_width; ++pw) {
                     reduce.Reset();
@@ -317,23 +502,23 @@ private:
                         if (needs_bounds_check && py.IsInvalid()) continue;
                         const int64_t y_low = py.p_low;
                         const int64_t y_high = py.p_high;
-                        const float* bottom_low = &bottom_base[y_low * width];
-                        const float* bottom_high = &bottom_base[y_high * width];
-                        for (int64_t ix = 0; ix < rbgw; ++ix, ++pixel_weights_iterator) {
+                        const T* bottom_low = &bottom_base[y_low * width];
+                        const T* bottom_high = &bottom_base[y_high * width];
+                        for (int64_t ix = 0; ix < rbgw; ++ix) {
                             const PixelPos& px = pixel_x[pw * rbgw + ix];
                             if (needs_bounds_check && px.IsInvalid()) continue;
                             const int64_t x_low = px.p_low;
                             const int64_t x_high = px.p_high;
-                            const PixelWeight& weights = *pixel_weights_iterator;
+                            const PixelWeight& weights = pixel_weights[((ph * pooled_width + pw) * rbgh + iy) * rbgw + ix];
                             const double w1 = weights.w1;
                             const double w2 = weights.w2;
                             const double w3 = weights.w3;
                             const double w4 = weights.w4;
 
-                            float v1 = bottom_low[x_low];
-                            float v2 = bottom_low[x_high];
-                            float v3 = bottom_high[x_low];
-                            float v4 = bottom_high[x_high];
+                            T v1 = bottom_low[x_low];
+                            T v2 = bottom_low[x_high];
+                            T v3 = bottom_high[x_low];
+                            T v4 = bottom_high[x_high];
 
                             double weighted_average = w1 * v1 + w2 * v2 + w3 * v3 + w4 * v4;
                             reduce.Reduce(weighted_average);
@@ -347,6 +532,61 @@ private:
         }
     }
 
+    // Accumulates the gradient of a single channel into `gx_base`.
+    // Sampling positions must be bounded. The max variant propagates
+    // the gradient only to the sampling point which gave the maximum.
+    void CalculateGrad(
+            const std::vector<PixelWeight>& pixel_weights,
+            const std::vector<PixelPos>& pixel_x,
+            const std::vector<PixelPos>& pixel_y,
+            const T* bottom_base,
+            const T* gy_base,
+            T* gx_base) const {
+        const double inv_elems = 1.0 / (roi_bin_grid_h * roi_bin_grid_w);
+        auto accumulate = [this, &pixel_weights, &pixel_x, &pixel_y, gx_base](int64_t ph, int64_t pw, int64_t iy, int64_t ix, double g) {
+            const PixelPos& py = pixel_y[ph * roi_bin_grid_h + iy];
+            const PixelPos& px = pixel_x[pw * roi_bin_grid_w + ix];
+            const PixelWeight& weights = pixel_weights[((ph * pooled_width + pw) * roi_bin_grid_h + iy) * roi_bin_grid_w + ix];
+            gx_base[py.p_low * width + px.p_low] += g * weights.w1;
+            gx_base[py.p_low * width + px.p_high] += g * weights.w2;
+            gx_base[py.p_high * width + px.p_low] += g * weights.w3;
+            gx_base[py.p_high * width + px.p_high] += g * weights.w4;
+        };
+
+        for (int64_t ph = 0; ph < pooled_height; ++ph) {
+            for (int64_t pw = 0; pw < pooled_width; ++pw) {
+                const double g = gy_base[ph * pooled_width + pw];
+                double max_val = std::numeric_limits<double>::lowest();
+                int64_t argmax_y = -1, argmax_x = -1;
+                for (int64_t iy = 0; iy < roi_bin_grid_h; ++iy) {
+                    const PixelPos& py = pixel_y[ph * roi_bin_grid_h + iy];
+                    if (py.IsInvalid()) continue;
+                    for (int64_t ix = 0; ix < roi_bin_grid_w; ++ix) {
+                        const PixelPos& px = pixel_x[pw * roi_bin_grid_w + ix];
+                        if (px.IsInvalid()) continue;
+                        if (!ReduceMode::kSelectsOne) {
+                            accumulate(ph, pw, iy, ix, g * inv_elems);
+                            continue;
+                        }
+                        const PixelWeight& weights = pixel_weights[((ph * pooled_width + pw) * roi_bin_grid_h + iy) * roi_bin_grid_w + ix];
+                        const double weighted_average = weights.w1 * bottom_base[py.p_low * width + px.p_low] +
+                                                        weights.w2 * bottom_base[py.p_low * width + px.p_high] +
+                                                        weights.w3 * bottom_base[py.p_high * width + px.p_low] +
+                                                        weights.w4 * bottom_base[py.p_high * width + px.p_high];
+                        if (max_val < weighted_average) {
+                            max_val = weighted_average;
+                            argmax_y = iy;
+                            argmax_x = ix;
+                        }
+                    }
+                }
+                if (ReduceMode::kSelectsOne && argmax_y >= 0) {
+                    accumulate(ph, pw, argmax_y, argmax_x, g);
+                }
+            }
+        }
+    }
+
     const float spatial_scale;
     const int64_t channels;
     const int64_t height;
@@ -356,16 +596,18 @@ private:
     const int64_t pooled_width;
     const int64_t roi_bin_grid_h;
     const int64_t roi_bin_grid_w;
+    // The dtype of outputs, which may differ from T for float16.
+    const chainerx::Dtype dtype;
 
     chainerx::Array contiguous_bottom_data;
     chainerx::Array contiguous_bottom_roi_indices;
     chainerx::Array contiguous_bottom_rois;
     chainerx::Array top_data;
-    const float* bottom_ptr;
-    float* top_ptr;
+    const T* bottom_ptr;
+    T* top_ptr;
 };
 
-template <class ReduceMode>
+template <class ReduceMode, typename T>
 chainerx::Array ROIAlign2D(
         const chainerx::Array& bottom_data,
         const chainerx::Array& bottom_rois,
@@ -376,12 +618,31 @@ chainerx::Array ROIAlign2D(
     CHECK_EQ(4, bottom_data.ndim());
     CHECK_EQ(2, output_shape.size());
     CHECK_EQ(2, sampling_ratio.size());
-    ROIAlign2DImpl<ReduceMode> impl(bottom_data, bottom_rois, bottom_roi_indices, output_shape, spatial_scale, sampling_ratio);
+    ROIAlign2DImpl<ReduceMode, T> impl(bottom_data, bottom_rois, bottom_roi_indices, output_shape, spatial_scale, sampling_ratio);
     return impl.Run();
 }
 
+template <class ReduceMode, typename T>
+chainerx::Array ROIAlign2DGrad(
+        const chainerx::Array& gy,
+        const chainerx::Array& bottom_data,
+        const chainerx::Array& bottom_rois,
+        const chainerx::Array& bottom_roi_indices,
+        const Int64StackVector& output_shape,
+        const float spatial_scale,
+        const chainerx::StackVector<int64_t, chainerx::kMaxNdim>& sampling_ratio) {
+    CHECK_EQ(4, bottom_data.ndim());
+    CHECK_EQ(2, output_shape.size());
+    CHECK_EQ(2, sampling_ratio.size());
+    ROIAlign2DImpl<ReduceMode, T> impl(bottom_data, bottom_rois, bottom_roi_indices, output_shape, spatial_scale, sampling_ratio);
+    return impl.RunGrad(gy);
+}
+
 class ReduceByMax {
 public:
+    // Only the maximum sampling point receives the gradient.
+    static constexpr bool kSelectsOne = true;
+
     ReduceByMax(int64_t /*roi_bin_grid_h*/, int64_t /*roi_bin_grid_w*/) {
         Reset();
     }
@@ -404,6 +665,8 @@ private:
 
 class ReduceByAverage {
 public:
+    static constexpr bool kSelectsOne = false;
+
     ReduceByAverage(int64_t roi_bin_grid_h, int64_t roi_bin_grid_w) : inv_elems_(1.0 / (roi_bin_grid_h * roi_bin_grid_w)) {
         Reset();
     }
@@ -425,30 +688,106 @@ private:
     double inv_elems_;
 };
 
+// Runs `fn` with a value of the type the ROI kernels compute `x` in.
+// Float64 inputs are computed in double, and float16 ones are cast to
+// float32 and back.
+template <typename Fn>
+chainerx::Array DispatchROIKernel(const chainerx::Array& x, Fn fn) {
+    CHECK(chainerx::GetKind(x.dtype()) == chainerx::DtypeKind::kFloat) << "Unsupported dtype for ROI ops: " << x.dtype();
+    if (x.dtype() == chainerx::Dtype::kFloat64) {
+        return fn(double());
+    }
+    return fn(float());
+}
+
 }  // namespace
 
 chainerx::Array ROIMaxPool2DOp::RunImpl(
         ChxVMState* st, const chainerx::Array& x, const chainerx::Array& rois, const chainerx::Array& roi_indices) {
     CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
-    return ROIPool2D(x, rois, roi_indices, output_shape, spatial_scale, chainerx::AMax);
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIPool2D<true, T>(x, rois, roi_indices, output_shape, spatial_scale);
+    });
 }
 
 chainerx::Array ROIAveragePool2DOp::RunImpl(
         ChxVMState* st, const chainerx::Array& x, const chainerx::Array& rois, const chainerx::Array& roi_indices) {
     CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
-    return ROIPool2D(x, rois, roi_indices, output_shape, spatial_scale, chainerx::Mean);
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIPool2D<false, T>(x, rois, roi_indices, output_shape, spatial_scale);
+    });
 }
 
 chainerx::Array ROIMaxAlign2DOp::RunImpl(
         ChxVMState* st, const chainerx::Array& x, const chainerx::Array& rois, const chainerx::Array& roi_indices) {
     CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
-    return ROIAlign2D<ReduceByMax>(x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIAlign2D<ReduceByMax, T>(x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    });
 }
 
 chainerx::Array ROIAverageAlign2DOp::RunImpl(
         ChxVMState* st, const chainerx::Array& x, const chainerx::Array& rois, const chainerx::Array& roi_indices) {
     CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
-    return ROIAlign2D<ReduceByAverage>(x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIAlign2D<ReduceByAverage, T>(x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    });
+}
+
+chainerx::Array ROIMaxPool2DGradOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& gy,
+        const chainerx::Array& x,
+        const chainerx::Array& rois,
+        const chainerx::Array& roi_indices) {
+    CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIPool2DGrad<true, T>(gy, x, rois, roi_indices, output_shape, spatial_scale);
+    });
+}
+
+chainerx::Array ROIAveragePool2DGradOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& gy,
+        const chainerx::Array& x,
+        const chainerx::Array& rois,
+        const chainerx::Array& roi_indices) {
+    CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIPool2DGrad<false, T>(gy, x, rois, roi_indices, output_shape, spatial_scale);
+    });
+}
+
+chainerx::Array ROIMaxAlign2DGradOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& gy,
+        const chainerx::Array& x,
+        const chainerx::Array& rois,
+        const chainerx::Array& roi_indices) {
+    CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIAlign2DGrad<ReduceByMax, T>(gy, x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    });
+}
+
+chainerx::Array ROIAverageAlign2DGradOp::RunImpl(
+        ChxVMState* st,
+        const chainerx::Array& gy,
+        const chainerx::Array& x,
+        const chainerx::Array& rois,
+        const chainerx::Array& roi_indices) {
+    CHECK(!IsCudaDevice(&x.device())) << "Not implemented";
+    return DispatchROIKernel(x, [&](auto pt) {
+        using T = decltype(pt);
+        return ROIAlign2DGrad<ReduceByAverage, T>(gy, x, rois, roi_indices, output_shape, spatial_scale, sampling_ratio);
+    });
 }
 
 }  // namespace runtime
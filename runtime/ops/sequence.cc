@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include <chainerx/routines/creation.h>
 #include <chainerx/routines/manipulation.h>
 
@@ -22,16 +25,42 @@ int64_t GetOptionalInt(const absl::optional<StrictScalar>& array, int64_t defaul
 }  // namespace
 
 void SequenceClearOp::RunImpl(ChxVMState* st) {
-    st->GetSequence(seq)->clear();
+    st->GetMutableSequence(seq)->clear();
 }
 
 void SequenceAppendOp::RunImpl(ChxVMState* st) {
-    st->GetSequence(seq)->emplace_back(*st->GetVar(value));
+    st->GetMutableSequence(seq)->emplace_back(*st->GetVar(value));
+}
+
+chainerx::Array ScanOutputCreateOp::RunImpl(ChxVMState* st, const StrictScalar& trip_count) {
+    std::vector<int64_t> dims = {std::max<int64_t>(0, static_cast<int64_t>(trip_count))};
+    dims.insert(dims.end(), shape.begin(), shape.end());
+    return chainerx::Empty(chainerx::Shape(dims.begin(), dims.end()), static_cast<chainerx::Dtype>(dtype));
+}
+
+void ScanOutputSetOp::RunImpl(ChxVMState* st) {
+    chainerx::Array out = st->GetArray(output);
+    const chainerx::Array& v = st->GetArray(value);
+    const int64_t i = static_cast<int64_t>(st->GetScalar(index));
+    CHECK_LE(0, i);
+    CHECK_LT(i, out.shape()[0]) << "Too many iterations for the scan output";
+    chainerx::Shape s(out.shape().begin() + 1, out.shape().end());
+    if (i == 0 && (s != v.shape() || out.dtype() != v.dtype() || &out.device() != &v.device())) {
+        // The statically inferred type was not accurate.
+        s = v.shape();
+        std::vector<int64_t> dims = {out.shape()[0]};
+        dims.insert(dims.end(), s.begin(), s.end());
+        out = chainerx::Empty(chainerx::Shape(dims.begin(), dims.end()), v.dtype(), v.device());
+        st->FreeVar(output);
+        st->SetArray(output, out);
+    }
+    CHECK_EQ(s, v.shape()) << "Shapes of scan outputs must be the same";
+    BlitArray(v, out.At({i}));
 }
 
 void SequenceExtendOp::RunImpl(ChxVMState* st, const ChxVMSequence& a, const ChxVMSequence& b, ChxVMSequence* output) {
     *output = a;
-    for (const auto& a : b) output->push_back(a);
+    output->Extend(b);
 }
 
 void SequencePopOp::RunImpl(ChxVMState* st) {
@@ -40,7 +69,7 @@ void SequencePopOp::RunImpl(ChxVMState* st) {
         st->SetVar(output, ChxVMVar());
         return;
     }
-    ChxVMSequence* v = st->GetSequence(seq);
+    ChxVMSequence* v = st->GetMutableSequence(seq);
     CHECK(!v->empty());
     st->SetVar(output, v->back());
     v->pop_back();
@@ -82,6 +111,10 @@ void SequenceGetSliceOp::RunImpl(
     int64_t step = GetOptionalInt(step_array, 1);
     CHECK_NE(0, step) << "Slice step cannot be zero";
 
+    if (step == 1) {
+        *output = seq.Slice(start, std::max(start, end));
+        return;
+    }
     for (int64_t i = start; step > 0 ? (i < end) : (i > end); i += step) {
         CHECK_LE(0, i);
         CHECK_LT(i, seq.size());
@@ -117,7 +150,7 @@ void SequenceGetSliceGradOp::RunImpl(
 }
 
 chainerx::Array SequenceStackOp::RunImpl(ChxVMState* st, const ChxVMSequence& seq) {
-    return chainerx::Stack(NonOptional(seq), axis);
+    return StackSequence(NonOptional(seq), axis);
 }
 
 std::tuple<chainerx::Array, chainerx::Array> SequenceConcatOp::RunImpl(ChxVMState* st, const ChxVMSequence& seq) {
@@ -127,7 +160,7 @@ std::tuple<chainerx::Array, chainerx::Array> SequenceConcatOp::RunImpl(ChxVMStat
         indices.push_back(index += v.GetArray().shape()[axis]);
     }
     indices.pop_back();
-    chainerx::Array out = chainerx::Concatenate(NonOptional(seq), axis);
+    chainerx::Array out = ConcatSequence(NonOptional(seq), axis);
     chainerx::Array ctx = MakeHostArray(chainerx::Dtype::kInt64, chainerx::Shape({static_cast<int64_t>(indices.size())}), &indices[0]);
     return std::tie(out, ctx);
 }
@@ -223,8 +256,10 @@ void SequenceLengthsOp::RunImpl(ChxVMState* st, const ChxVMSequence& seq, ChxVMS
     }
 }
 
-void SequenceCopyOp::RunImpl(ChxVMState* st, const ChxVMSequence& seq, ChxVMSequence* output) {
-    *output = seq;
+void SequenceCopyOp::RunImpl(ChxVMState* st) {
+    const ChxVMVar& var = *st->GetVar(seq);
+    CHECK_EQ(ChxVMVar::Kind::kSequence, var.kind()) << var.DebugString();
+    st->SetVar(output, var);
 }
 
 void SequenceMoveOp::RunImpl(ChxVMState* st) {
@@ -233,10 +268,11 @@ void SequenceMoveOp::RunImpl(ChxVMState* st) {
         st->SetVar(output, ChxVMVar());
         return;
     }
-    ChxVMSequence* s = st->GetSequence(seq);
-    ChxVMSequence* d = st->CreateSequence(output);
-    CHECK(d->empty());
-    std::swap(*d, *s);
+    // Hand over the contents without copying and leave `seq` empty.
+    const ChxVMVar& var = *st->GetVar(seq);
+    CHECK_EQ(ChxVMVar::Kind::kSequence, var.kind()) << var.DebugString();
+    st->SetVar(output, var);
+    st->CreateSequence(seq);
 }
 
 }  // namespace runtime
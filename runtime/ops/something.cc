@@ -1,5 +1,6 @@
+#include <algorithm>
 #include <array>
-#include <map>
+#include <cmath>
 #include <numeric>
 
 #include <chainerx/array.h>
@@ -9,6 +10,7 @@
 #include <common/log.h>
 #include <runtime/chainerx_util.h>
 #include <runtime/gen_chxvm_ops.h>
+#include <runtime/ops/nms.h>
 
 namespace chainer_compiler {
 namespace runtime {
@@ -25,56 +27,66 @@ constexpr size_t k_train_nms_limit_post = 2000;
 constexpr size_t k_test_nms_limit_pre = 1000;
 constexpr size_t k_test_nms_limit_post = 1000;
 
-namespace {
-template <typename Int, typename Iter, typename Comp>
-std::vector<Int> argsort(Iter first, Iter last, Comp comp) {
-    std::vector<Int> indices(std::distance(first, last));
-    std::iota(indices.begin(), indices.end(), 0);
-    std::sort(indices.begin(), indices.end(), [first, comp](Int i, Int j) { return comp(*(first + i), *(first + j)); });
-    return indices;
-}
-
-double calc_area(std::array<double, 4> const& tlbr) {
-    return (tlbr[2] - tlbr[0]) * (tlbr[3] - tlbr[1]);
-}
-
-template <typename T>
-const T& at(const std::vector<T>& v, size_t i) {
-    // return v.at(i);
-    return v[i];
-}
-template <typename T>
-T& at(std::vector<T>& v, size_t i) {
-    return const_cast<T&>(at(const_cast<const std::vector<T>&>(v), i));
-}
-
-}  // namespace
-
-std::vector<size_t> NonMaximumSuppression(std::vector<std::array<double, 4>> const& roi_l_list, double nms_threash, size_t nms_limit) {
-    std::vector<double> bbox_area_list(roi_l_list.size());
-    std::transform(
-            roi_l_list.begin(), roi_l_list.end(), bbox_area_list.begin(), [](const std::array<double, 4>& roi) { return calc_area(roi); });
-    std::vector<size_t> selected_indices;
-    for (int64_t i = 0; i < roi_l_list.size(); ++i) {
-        const std::array<double, 4> b_tlbr = at(roi_l_list, i);
-        const bool is_selected = std::all_of(
-                selected_indices.begin(), selected_indices.end(), [nms_threash, i, b_tlbr, &bbox_area_list, &roi_l_list](size_t s) {
-                    const std::array<double, 4>& selected_roi_tlbr = roi_l_list[s];
-                    const std::array<double, 4> tlbr{{std::max(b_tlbr[0], selected_roi_tlbr[0]),
-                                                      std::max(b_tlbr[1], selected_roi_tlbr[1]),
-                                                      std::min(b_tlbr[2], selected_roi_tlbr[2]),
-                                                      std::min(b_tlbr[3], selected_roi_tlbr[3])}};
-                    const double area = (tlbr[0] < tlbr[2]) && (tlbr[1] < tlbr[3]) ? calc_area(tlbr) : 0;
-                    return nms_threash * (at(bbox_area_list, i) + at(bbox_area_list, s) - area) > area;
-                });
-        if (is_selected) {
-            selected_indices.push_back(i);
-        }
-        if (selected_indices.size() >= nms_limit) {
-            break;
+// A proposal decoded from an anchor.
+struct Proposal {
+    float conf;
+    std::array<float, 4> tlbr;
+};
+
+// Decodes proposals of a single image in a single pyramid level. Only
+// anchors with the top `nms_limit_pre` confidences are decoded, and
+// proposals are returned in the descending order of their confidences.
+std::vector<Proposal> DecodeProposals(
+        const float* loc,
+        const float* conf,
+        int64_t height,
+        int64_t width,
+        double scale,
+        const std::vector<double>& ahs,
+        const std::vector<double>& aws,
+        double in_shape_h,
+        double in_shape_w,
+        size_t nms_limit_pre) {
+    const int64_t num_ratios = k_anchor_ratios.size();
+    const int64_t num_anchors = height * width * num_ratios;
+    std::vector<int64_t> order(num_anchors);
+    std::iota(order.begin(), order.end(), 0);
+    const int64_t num_cut = std::min<int64_t>(num_anchors, nms_limit_pre);
+    std::partial_sort(order.begin(), order.begin() + num_cut, order.end(), [conf](int64_t i, int64_t j) {
+        return conf[i] > conf[j] || (conf[i] == conf[j] && i < j);
+    });
+
+    std::vector<Proposal> proposals;
+    proposals.reserve(num_cut);
+    for (int64_t n = 0; n < num_cut; ++n) {
+        const int64_t ki = order[n];
+        const int64_t iar = ki % num_ratios;
+        const int64_t v = ki / num_ratios % width;
+        const int64_t u = ki / num_ratios / width;
+        const double ay = (u + 0.5) / scale;
+        const double ax = (v + 0.5) / scale;
+        const double ah = ahs[iar];
+        const double aw = aws[iar];
+
+        const float* loc_ki = loc + ki * 4;
+        const double roi_y = ay + ah * loc_ki[0];
+        const double roi_x = ax + aw * loc_ki[1];
+        const double roi_h = ah * std::exp(std::min<double>(loc_ki[2], k_exp_clip));
+        const double roi_w = aw * std::exp(std::min<double>(loc_ki[3], k_exp_clip));
+
+        // yxhw -> tlbr (top left, bottom right)
+        Proposal p;
+        p.conf = conf[ki];
+        p.tlbr[0] = std::max(roi_y - roi_h * 0.5, 0.0);
+        p.tlbr[1] = std::max(roi_x - roi_w * 0.5, 0.0);
+        p.tlbr[2] = std::min(roi_y + roi_h * 0.5, in_shape_h);
+        p.tlbr[3] = std::min(roi_x + roi_w * 0.5, in_shape_w);
+        // Drop empty proposals.
+        if (p.tlbr[0] < p.tlbr[2] && p.tlbr[1] < p.tlbr[3]) {
+            proposals.push_back(p);
         }
     }
-    return selected_indices;
+    return proposals;
 }
 
 std::vector<chainerx::Array> ChainerCVRPNDecode(
@@ -98,8 +110,6 @@ std::vector<chainerx::Array> ChainerCVRPNDecode(
     const size_t k_nms_limit_post = k_train_nms_limit_post;
     const double in_shape_h = static_cast<double>(AsScalar(in_shape.At({2})));
     const double in_shape_w = static_cast<double>(AsScalar(in_shape.At({3})));
-    std::vector<std::array<double, 4>> rois_list;
-    std::vector<chainerx::Array> roi_indices_list;
     const int64_t batch_size = static_cast<int64_t>(chainerx::AsScalar(in_shape.At({0})));
 
     std::vector<std::vector<double>> ahs(scales.size(), std::vector<double>(k_anchor_ratios.size()));
@@ -109,121 +119,73 @@ std::vector<chainerx::Array> ChainerCVRPNDecode(
             const double ar = k_anchor_ratios[iar];
             const double w = std::round(1.0 / scales[l] / std::sqrt(ar));
             const double h = std::round(w * ar);
-            at(at(ahs, l), iar) = h * (k_anchor_size << l) * scales[l];
-            at(at(aws, l), iar) = w * (k_anchor_size << l) * scales[l];
+            ahs[l][iar] = h * (k_anchor_size << l) * scales[l];
+            aws[l][iar] = w * (k_anchor_size << l) * scales[l];
         }
     }
 
+    std::vector<chainerx::Array> contiguous_locs;
+    std::vector<chainerx::Array> contiguous_confs;
+    for (size_t l = 0; l < scales.size(); ++l) {
+        contiguous_locs.push_back(chainerx::AsContiguous(locs[l].AsType(chainerx::Dtype::kFloat32)));
+        contiguous_confs.push_back(chainerx::AsContiguous(confs[l].AsType(chainerx::Dtype::kFloat32)));
+    }
+
+    // Images are independent, so they run in parallel.
+    std::vector<std::vector<Proposal>> rois_per_batch(batch_size);
+#if CHAINER_COMPILER_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
     for (int64_t b = 0; b < batch_size; ++b) {
-        std::vector<std::array<double, 4>> rois_list_per_batch;
-        std::vector<double> confs_list_per_batch;
+        std::vector<Proposal>& selected = rois_per_batch[b];
         for (size_t l = 0; l < scales.size(); ++l) {
-            const float* loc_l = static_cast<float*>(locs[l].raw_data()) + b * locs[l].shape()[1] * locs[l].shape()[2];
-            const float* conf_l = static_cast<float*>(confs[l].raw_data()) + b * confs[l].shape()[1];
-            const auto& h_l = hs[l];
-            const int64_t k_l = locs[l].shape()[1];
-            std::vector<std::array<double, 4>> roi_l_list(h_l.shape()[2] * h_l.shape()[3] * k_anchor_ratios.size());
-            size_t ki = 0;
-            for (size_t u = 0; u < h_l.shape()[2]; ++u) {
-                for (size_t v = 0; v < h_l.shape()[3]; ++v) {
-                    const double ay = (u + 0.5) / scales[l];
-                    const double ax = (v + 0.5) / scales[l];
-                    for (size_t iar = 0; iar < k_anchor_ratios.size(); ++iar) {
-                        const double ah = at(at(ahs, l), iar);
-                        const double aw = at(at(aws, l), iar);
-
-                        const float* loc_l_ki = loc_l + ki * 4;
-                        const double loc_l_y = *(loc_l_ki + 0);
-                        const double loc_l_x = *(loc_l_ki + 1);
-                        const double loc_l_h = *(loc_l_ki + 2);
-                        const double loc_l_w = *(loc_l_ki + 3);
-
-                        const double roi_l_y = ay + ah * loc_l_y;
-                        const double roi_l_x = ax + aw * loc_l_x;
-                        const double roi_l_h = ah * std::exp(std::min(loc_l_h, k_exp_clip));
-                        const double roi_l_w = aw * std::exp(std::min(loc_l_w, k_exp_clip));
-
-                        // yxhw -> tlbr (top left, bottom right)
-                        roi_l_list[ki][0] = std::max(roi_l_y - roi_l_h * 0.5, 0.0);  // roi_l_tly
-                        roi_l_list[ki][1] = std::max(roi_l_x - roi_l_w * 0.5, 0.0);  // roi_l_tlx
-                        roi_l_list[ki][2] = std::min(roi_l_y + roi_l_h * 0.5, in_shape_h);  // roi_l_bry
-                        roi_l_list[ki][3] = std::min(roi_l_x + roi_l_w * 0.5, in_shape_w);  // roi_l_brx
-                        ++ki;
-                    }  // end for iar
-                }  // end for v
-            }  // end for u
-
-            // reduce size of `conf_l` to `nms_limit_pre`
-            std::vector<size_t> cut_indices = argsort<size_t>(conf_l, conf_l + k_l, [](float a, float b) { return a > b; });
-            std::vector<std::array<double, 4>> roi_l_list_cut(std::min(static_cast<size_t>(k_l), k_nms_limit_pre));
-            std::vector<double> conf_l_list_cut(std::min(static_cast<size_t>(k_l), k_nms_limit_pre));
-            std::transform(
-                    cut_indices.begin(), cut_indices.begin() + roi_l_list_cut.size(), roi_l_list_cut.begin(), [&roi_l_list](size_t i) {
-                        return at(roi_l_list, i);
-                    });
-            std::transform(cut_indices.begin(), cut_indices.begin() + conf_l_list_cut.size(), conf_l_list_cut.begin(), [&conf_l](size_t i) {
-                return *(conf_l + i);
-            });
-
-            // mask
-            std::vector<size_t> mask_indices(roi_l_list_cut.size());
-            std::iota(mask_indices.begin(), mask_indices.end(), 0);
-            const auto mask_indices_end_iter = std::remove_if(mask_indices.begin(), mask_indices.end(), [&roi_l_list_cut](size_t i) {
-                const std::array<double, 4>& roi = at(roi_l_list_cut, i);
-                const double roi_l_tly = roi[0];
-                const double roi_l_tlx = roi[1];
-                const double roi_l_bry = roi[2];
-                const double roi_l_brx = roi[3];
-                return (roi_l_bry <= roi_l_tly) || (roi_l_brx <= roi_l_tlx);
-            });
-            const size_t masked_size = std::distance(mask_indices.begin(), mask_indices_end_iter);
-            std::vector<std::array<double, 4>> roi_l_list_masked(masked_size);
-            std::vector<double> conf_l_list_masked(masked_size);
-            std::transform(mask_indices.begin(), mask_indices_end_iter, roi_l_list_masked.begin(), [&roi_l_list_cut](size_t i) {
-                return at(roi_l_list_cut, i);
-            });
-            std::transform(mask_indices.begin(), mask_indices_end_iter, conf_l_list_masked.begin(), [&conf_l_list_cut](size_t i) {
-                return at(conf_l_list_cut, i);
-            });
-
-            // NMS
-            std::vector<size_t> indices = NonMaximumSuppression(roi_l_list_masked, k_nms_thresh, k_nms_limit_post);
-            std::vector<std::array<double, 4>> roi_l_list_suppressed(indices.size());
-            std::vector<double> conf_l_list_suppressed(indices.size());
-            std::transform(indices.begin(), indices.end(), roi_l_list_suppressed.begin(), [&roi_l_list_masked](size_t i) {
-                return at(roi_l_list_masked, i);
-            });
-            std::transform(indices.begin(), indices.end(), conf_l_list_suppressed.begin(), [&conf_l_list_masked](size_t i) {
-                return at(conf_l_list_masked, i);
-            });
-
-            rois_list_per_batch.insert(rois_list_per_batch.end(), roi_l_list_suppressed.begin(), roi_l_list_suppressed.end());
-            confs_list_per_batch.insert(confs_list_per_batch.end(), conf_l_list_suppressed.begin(), conf_l_list_suppressed.end());
-
-        }  // end for l
-
-        // reduce size of `roi_list_per_batch` to `nms_limit_post`
-        const auto& conf = confs_list_per_batch;
-        std::vector<size_t> nms_post_indices = argsort<size_t>(conf.begin(), conf.end(), [](double a, double b) { return a > b; });
-        std::vector<std::array<double, 4>> rois_list_per_batch_sorted(std::min(k_nms_limit_post, nms_post_indices.size()));
-        std::transform(
-                nms_post_indices.begin(),
-                nms_post_indices.begin() + rois_list_per_batch_sorted.size(),
-                rois_list_per_batch_sorted.begin(),
-                [&rois_list_per_batch](size_t i) { return at(rois_list_per_batch, i); });
-        rois_list.insert(rois_list.end(), rois_list_per_batch_sorted.begin(), rois_list_per_batch_sorted.end());
-        roi_indices_list.push_back(chainerx::Full({static_cast<int64_t>(rois_list.size())}, b));
+            const chainerx::Array& loc = contiguous_locs[l];
+            const chainerx::Array& conf = contiguous_confs[l];
+            const int64_t k_l = loc.shape()[1];
+            const std::vector<Proposal> proposals = DecodeProposals(
+                    static_cast<const float*>(loc.raw_data()) + b * k_l * 4,
+                    static_cast<const float*>(conf.raw_data()) + b * k_l,
+                    hs[l].shape()[2],
+                    hs[l].shape()[3],
+                    scales[l],
+                    ahs[l],
+                    aws[l],
+                    in_shape_h,
+                    in_shape_w,
+                    k_nms_limit_pre);
+
+            SortedBoxes boxes;
+            boxes.Reserve(proposals.size());
+            for (const Proposal& p : proposals) {
+                boxes.Add(p.tlbr[0], p.tlbr[1], p.tlbr[2], p.tlbr[3]);
+            }
+            for (int64_t i : NonMaxSuppression(boxes, k_nms_thresh, k_nms_limit_post)) {
+                selected.push_back(proposals[i]);
+            }
+        }
+
+        // reduce size of proposals to `nms_limit_post`
+        std::stable_sort(selected.begin(), selected.end(), [](const Proposal& a, const Proposal& b) { return a.conf > b.conf; });
+        if (selected.size() > k_nms_limit_post) {
+            selected.resize(k_nms_limit_post);
+        }
+    }
+
+    int64_t num_rois = 0;
+    for (const std::vector<Proposal>& selected : rois_per_batch) {
+        num_rois += selected.size();
     }
-    chainerx::Array rois = chainerx::Zeros({static_cast<int64_t>(rois_list.size()) * 4}, hs.front().dtype());
-    for (size_t i = 0; i < rois_list.size(); ++i) {
-        *(static_cast<float*>(rois.raw_data()) + i * 4 + 0) = rois_list[i][0];
-        *(static_cast<float*>(rois.raw_data()) + i * 4 + 1) = rois_list[i][1];
-        *(static_cast<float*>(rois.raw_data()) + i * 4 + 2) = rois_list[i][2];
-        *(static_cast<float*>(rois.raw_data()) + i * 4 + 3) = rois_list[i][3];
+    chainerx::Array rois = chainerx::Empty({num_rois, 4}, chainerx::Dtype::kFloat32);
+    chainerx::Array roi_indices = chainerx::Empty({num_rois}, chainerx::Dtype::kInt64);
+    float* rois_ptr = static_cast<float*>(rois.raw_data());
+    int64_t* roi_indices_ptr = static_cast<int64_t*>(roi_indices.raw_data());
+    for (int64_t b = 0; b < batch_size; ++b) {
+        for (const Proposal& p : rois_per_batch[b]) {
+            rois_ptr = std::copy(p.tlbr.begin(), p.tlbr.end(), rois_ptr);
+            *roi_indices_ptr++ = b;
+        }
     }
-    rois = chainerx::Reshape(rois, {static_cast<int64_t>(rois_list.size()), 4});
-    chainerx::Array roi_indices = chainerx::Reshape(chainerx::Concatenate(roi_indices_list), {static_cast<int64_t>(rois_list.size())});
-    return std::vector<chainerx::Array>({std::move(rois), std::move(roi_indices)});
+    return std::vector<chainerx::Array>({rois.AsType(hs.front().dtype()), std::move(roi_indices)});
 }
 
 }  // namespace
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Measures If nodes with small branches.
+
+Usage:
+
+$ ./scripts/bench_if.py
+$ ./scripts/bench_if.py --num_ifs 1000 --units 1024 --device cuda
+
+This script generates a model under out/ which applies a chain of If
+nodes to a tensor and runs it with run_onnx. Each If chooses Relu or
+Neg depending on the sign of the sum of its input, so the condition
+cannot be folded at compile time. The model runs once as is and once
+with --if_to_where_max_flops, which evaluates both branches and
+selects the result with Where. The former needs a device-to-host
+transfer of the condition for each If, while the latter computes
+twice as many element-wise ops but can fuse them.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_branch(name, op_type, x, units):
+    return onnx.helper.make_graph(
+        [onnx.helper.make_node(op_type, [x], [name + '_y'])],
+        name, [],
+        [onnx.helper.make_tensor_value_info(
+            name + '_y', onnx.TensorProto.FLOAT, (units,))])
+
+
+def make_model(args):
+    nodes = []
+    x = 'x'
+    for i in range(args.num_ifs):
+        s = 'sum%d' % i
+        c = 'cond%d' % i
+        y = 'y%d' % i
+        nodes.append(onnx.helper.make_node('ReduceSum', [x], [s], keepdims=0))
+        nodes.append(onnx.helper.make_node('Greater', [s, 'zero'], [c]))
+        nodes.append(onnx.helper.make_node(
+            'If', [c], [y],
+            then_branch=make_branch('then%d' % i, 'Relu', x, args.units),
+            else_branch=make_branch('else%d' % i, 'Neg', x, args.units)))
+        x = y
+
+    initializers = [
+        numpy_helper.from_array(
+            np.random.normal(size=args.units).astype(np.float32), 'x'),
+        numpy_helper.from_array(np.array(0, dtype=np.float32), 'zero'),
+    ]
+    inputs = []
+    for tensor in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            tensor.name, tensor.data_type, tensor.dims))
+    output = onnx.helper.make_tensor_value_info(
+        x, onnx.TensorProto.FLOAT, (args.units,))
+    graph = onnx.helper.make_graph(nodes, 'bench', inputs, [output],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9)])
+
+
+def run(args, model_path, extra_args):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)] + extra_args
+    if args.device:
+        cmd += ['--device', args.device]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--num_ifs', type=int, default=100)
+    parser.add_argument('--units', type=int, default=256)
+    parser.add_argument('--device', '-d', default='')
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    model = make_model(args)
+    out_dir = os.path.join('out', 'bench_if')
+    os.makedirs(out_dir, exist_ok=True)
+    model_path = os.path.join(out_dir, 'model.onnx')
+    with open(model_path, 'wb') as f:
+        f.write(model.SerializeToString())
+
+    branched = run(args, model_path, [])
+    print('If:    %.3f msec' % branched)
+    # Large enough for both branches.
+    selected = run(args, model_path, ['--if_to_where_max_flops',
+                                      str(args.units * 2)])
+    print('Where: %.3f msec (x%.2f)' % (selected, branched / selected))
+
+
+if __name__ == '__main__':
+    main()
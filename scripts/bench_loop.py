@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Measures the overhead of ChxVM loops.
+
+Usage:
+
+$ ./scripts/bench_loop.py
+$ ./scripts/bench_loop.py --trip_count 100000
+$ ./scripts/bench_loop.py --trip_count 1 4 16 64 256 --unroll
+
+This script generates a model with a Loop whose body only adds a
+scalar to the loop state under out/ and runs it with run_onnx. As the
+body is tiny, the time per iteration is dominated by the bookkeeping
+of the loop counter and the loop condition. With --unroll, the model
+also runs with the loop unrolled, which shows the trip count where
+unrolling stops paying off.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_loop_model(trip_count):
+    body = onnx.helper.make_graph(
+        [onnx.helper.make_node('Identity', ['cond'], ['cond_out']),
+         onnx.helper.make_node('Add', ['state', 'one'], ['state_out'])],
+        'body',
+        [onnx.helper.make_tensor_value_info(
+            'iter', onnx.TensorProto.INT64, ()),
+         onnx.helper.make_tensor_value_info(
+             'cond', onnx.TensorProto.BOOL, ()),
+         onnx.helper.make_tensor_value_info(
+             'state', onnx.TensorProto.FLOAT, ())],
+        [onnx.helper.make_tensor_value_info(
+            'cond_out', onnx.TensorProto.BOOL, ()),
+         onnx.helper.make_tensor_value_info(
+             'state_out', onnx.TensorProto.FLOAT, ())])
+
+    initializers = [
+        numpy_helper.from_array(np.array(trip_count, dtype=np.int64),
+                                'trip_count'),
+        numpy_helper.from_array(np.array(True), 'cond_init'),
+        numpy_helper.from_array(np.array(0, dtype=np.float32), 'state_init'),
+        numpy_helper.from_array(np.array(1, dtype=np.float32), 'one'),
+    ]
+    node = onnx.helper.make_node(
+        'Loop', ['trip_count', 'cond_init', 'state_init'], ['output'],
+        body=body)
+    inputs = []
+    for tensor in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            tensor.name, tensor.data_type, tensor.dims))
+    output = onnx.helper.make_tensor_value_info(
+        'output', onnx.TensorProto.FLOAT, ())
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [output],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9)])
+
+
+def run(args, model_path, extra_args):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)] + extra_args
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--trip_count', type=int, nargs='+', default=[10000])
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    parser.add_argument('--unroll', action='store_true',
+                        help='Also measure the time with the loop unrolled')
+    args = parser.parse_args()
+
+    for trip_count in args.trip_count:
+        model = make_loop_model(trip_count)
+        out_dir = os.path.join('out', 'bench_loop_%d' % trip_count)
+        os.makedirs(out_dir, exist_ok=True)
+        model_path = os.path.join(out_dir, 'model.onnx')
+        with open(model_path, 'wb') as f:
+            f.write(model.SerializeToString())
+
+        elapsed = run(args, model_path, [])
+        print('Loop trip_count=%d: %.3f msec (%.3f usec/iteration)' %
+              (trip_count, elapsed, elapsed * 1000 / trip_count))
+        if args.unroll:
+            # Large enough for the body with nodes added by the compiler.
+            unrolled = run(args, model_path, ['--unroll_loops_max_nodes',
+                                              str(trip_count * 10)])
+            print('Unrolled trip_count=%d: %.3f msec (x%.2f)' %
+                  (trip_count, unrolled, elapsed / unrolled))
+
+
+if __name__ == '__main__':
+    main()
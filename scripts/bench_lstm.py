@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Measures the step time and the peak memory of LSTM training.
+
+Usage:
+
+$ ./scripts/bench_lstm.py
+$ ./scripts/bench_lstm.py --seq_length 100 -B 64 --hidden_size 512
+
+This script generates a model with a single LSTM op under out/ and
+runs it with run_onnx --backprop. The peak memory usage is taken from
+the output of --trace in a separate run.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_lstm_model(args):
+    t, b, i, h = (args.seq_length, args.batchsize, args.input_size,
+                  args.hidden_size)
+    params = [
+        ('x', np.random.normal(size=(t, b, i))),
+        ('w', np.random.normal(scale=0.1, size=(1, 4 * h, i))),
+        ('r', np.random.normal(scale=0.1, size=(1, 4 * h, h))),
+        ('b', np.random.normal(scale=0.1, size=(1, 8 * h))),
+    ]
+    initializers = [numpy_helper.from_array(v.astype(np.float32), n)
+                    for n, v in params]
+    node = onnx.helper.make_node('LSTM', ['x', 'w', 'r', 'b', ''],
+                                 ['y', '', ''], hidden_size=h)
+    inputs = []
+    for tensor in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            tensor.name, tensor.data_type, tensor.dims))
+    output = onnx.helper.make_tensor_value_info(
+        'y', onnx.TensorProto.FLOAT, (t, 1, b, h))
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [output],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9)])
+
+
+def run(args, model_path, extra_args, pattern):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path, '--backprop'] + extra_args
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(pattern, output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--batchsize', '-B', type=int, default=32)
+    parser.add_argument('--seq_length', type=int, default=50)
+    parser.add_argument('--input_size', type=int, default=256)
+    parser.add_argument('--hidden_size', type=int, default=256)
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    model = make_lstm_model(args)
+    out_dir = os.path.join('out', 'bench_lstm_%d_%d_%d_%d' %
+                           (args.seq_length, args.batchsize,
+                            args.input_size, args.hidden_size))
+    os.makedirs(out_dir, exist_ok=True)
+    model_path = os.path.join(out_dir, 'model.onnx')
+    with open(model_path, 'wb') as f:
+        f.write(model.SerializeToString())
+
+    elapsed = run(args, model_path, ['--iterations', str(args.iterations)],
+                  r'Best elapsed: (\d+(\.\d+)?)')
+    peak = run(args, model_path, ['--trace'],
+               r'Peak memory usage=(\d+)MB')
+    print('LSTM training T=%d B=%d I=%d H=%d: %.3f msec/step peak=%dMB' %
+          (args.seq_length, args.batchsize, args.input_size,
+           args.hidden_size, elapsed, peak))
+
+
+if __name__ == '__main__':
+    main()
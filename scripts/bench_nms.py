@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Measures the latency of NonMaxSuppression.
+
+Usage:
+
+$ ./scripts/bench_nms.py
+$ ./scripts/bench_nms.py --num_boxes 4000 --max_output 1000 -B 8
+
+This script generates RPN-like proposals (many overlapping boxes
+around a few objects) under out/ and runs a model with a single
+NonMaxSuppression op with run_onnx. The default setting matches the
+2000 -> 1000 proposal reduction of Faster R-CNN.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_nms_model(args):
+    bsize, n = args.batchsize, args.num_boxes
+    centers = np.random.uniform(0, args.image_size, size=(bsize, 50, 2))
+    picked = centers[np.arange(bsize)[:, None],
+                     np.random.randint(0, 50, size=(bsize, n))]
+    yx = picked + np.random.normal(scale=16, size=(bsize, n, 2))
+    hw = np.random.uniform(16, 256, size=(bsize, n, 2))
+    boxes = np.concatenate([yx - hw / 2, yx + hw / 2], axis=2)
+    boxes = np.clip(boxes, 0, args.image_size)
+    scores = np.random.uniform(size=(bsize, 1, n))
+    params = [
+        ('boxes', boxes.astype(np.float32)),
+        ('scores', scores.astype(np.float32)),
+        ('max_output_boxes_per_class',
+         np.array([args.max_output], dtype=np.int64)),
+        ('iou_threshold', np.array([args.iou_threshold], dtype=np.float32)),
+    ]
+    initializers = [numpy_helper.from_array(v, n) for n, v in params]
+    node = onnx.helper.make_node('NonMaxSuppression',
+                                 [name for name, _ in params],
+                                 ['selected_indices'])
+    inputs = []
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    output = onnx.helper.make_tensor_value_info(
+        'selected_indices', onnx.TensorProto.INT64, ('n', 3))
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [output],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 10)])
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--batchsize', '-B', type=int, default=1)
+    parser.add_argument('--num_boxes', type=int, default=2000)
+    parser.add_argument('--max_output', type=int, default=1000)
+    parser.add_argument('--iou_threshold', type=float, default=0.7)
+    parser.add_argument('--image_size', type=float, default=800)
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    model = make_nms_model(args)
+    out_dir = os.path.join('out', 'bench_nms_%d_%d_%d' %
+                           (args.batchsize, args.num_boxes, args.max_output))
+    os.makedirs(out_dir, exist_ok=True)
+    model_path = os.path.join(out_dir, 'model.onnx')
+    with open(model_path, 'wb') as f:
+        f.write(model.SerializeToString())
+    elapsed = run(args, model_path)
+    print('NonMaxSuppression batch=%d %d -> %d: %.3f msec' %
+          (args.batchsize, args.num_boxes, args.max_output, elapsed))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Compares float and int8 throughput of convolutions in ResNet-50.
+
+Usage:
+
+$ ./scripts/bench_quantized_conv.py
+$ ./scripts/bench_quantized_conv.py --batchsize 8 --iterations 20
+
+For each convolution shape, this script generates a float model
+(Conv) and a quantized model (QuantizeLinear -> QLinearConv ->
+DequantizeLinear) under out/ and runs them with run_onnx.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+# (name, in_channels, out_channels, kernel, stride, input size)
+RESNET50_CONVS = [
+    ('conv1', 3, 64, 7, 2, 224),
+    ('res2_1x1_reduce', 256, 64, 1, 1, 56),
+    ('res2_3x3', 64, 64, 3, 1, 56),
+    ('res2_1x1_expand', 64, 256, 1, 1, 56),
+    ('res3_3x3', 128, 128, 3, 1, 28),
+    ('res3_1x1_expand', 128, 512, 1, 1, 28),
+    ('res4_3x3', 256, 256, 3, 1, 14),
+    ('res4_1x1_expand', 256, 1024, 1, 1, 14),
+    ('res5_3x3', 512, 512, 3, 1, 7),
+    ('res5_1x1_expand', 512, 2048, 1, 1, 7),
+]
+
+
+def make_conv_model(bsize, ic, oc, k, stride, size, quantized):
+    x = onnx.helper.make_tensor_value_info(
+        'x', onnx.TensorProto.FLOAT, (bsize, ic, size, size))
+    osize = (size + (k // 2) * 2 - k) // stride + 1
+    y = onnx.helper.make_tensor_value_info(
+        'y', onnx.TensorProto.FLOAT, (bsize, oc, osize, osize))
+    conv_attrs = {'kernel_shape': [k, k],
+                  'pads': [k // 2] * 4,
+                  'strides': [stride, stride]}
+
+    w = np.random.normal(size=(oc, ic, k, k)).astype(np.float32)
+    if not quantized:
+        initializers = [numpy_helper.from_array(w, 'w')]
+        nodes = [onnx.helper.make_node('Conv', ['x', 'w'], ['y'],
+                                       **conv_attrs)]
+    else:
+        scale = np.abs(w).max() / 127
+        qw = np.round(w / scale).astype(np.int8)
+        params = [
+            ('x_scale', np.array(1 / 64, dtype=np.float32)),
+            ('x_zero_point', np.array(128, dtype=np.uint8)),
+            ('w', qw),
+            ('w_scale', np.array(scale, dtype=np.float32)),
+            ('w_zero_point', np.array(0, dtype=np.int8)),
+            ('y_scale', np.array(1 / 16, dtype=np.float32)),
+            ('y_zero_point', np.array(128, dtype=np.uint8)),
+        ]
+        initializers = [numpy_helper.from_array(v, n) for n, v in params]
+        nodes = [
+            onnx.helper.make_node('QuantizeLinear',
+                                  ['x', 'x_scale', 'x_zero_point'], ['qx']),
+            onnx.helper.make_node('QLinearConv',
+                                  ['qx', 'x_scale', 'x_zero_point',
+                                   'w', 'w_scale', 'w_zero_point',
+                                   'y_scale', 'y_zero_point'], ['qy'],
+                                  **conv_attrs),
+            onnx.helper.make_node('DequantizeLinear',
+                                  ['qy', 'y_scale', 'y_zero_point'], ['y']),
+        ]
+
+    inputs = [x]
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    graph = onnx.helper.make_graph(nodes, 'bench', inputs, [y],
+                                   initializer=initializers)
+    return onnx.helper.make_model(graph, producer_name='bench')
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    if args.device:
+        cmd += ['--device', args.device]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--batchsize', '-B', type=int, default=1)
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    parser.add_argument('--device', '-d', default=None)
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    print('%-18s %12s %12s %8s' % ('conv', 'float(ms)', 'int8(ms)', 'speedup'))
+    for name, ic, oc, k, stride, size in RESNET50_CONVS:
+        elapsed = []
+        for quantized in (False, True):
+            model = make_conv_model(args.batchsize, ic, oc, k, stride, size,
+                                    quantized)
+            out_dir = os.path.join('out', 'bench_quantized_conv_%s_%s' %
+                                   (name, 'int8' if quantized else 'float'))
+            os.makedirs(out_dir, exist_ok=True)
+            model_path = os.path.join(out_dir, 'model.onnx')
+            with open(model_path, 'wb') as f:
+                f.write(model.SerializeToString())
+            elapsed.append(run(args, model_path))
+        print('%-18s %12.3f %12.3f %7.2fx' %
+              (name, elapsed[0], elapsed[1], elapsed[0] / elapsed[1]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Measures the throughput of Resize.
+
+Usage:
+
+$ ./scripts/bench_resize.py
+$ ./scripts/bench_resize.py --modes linear --dtypes float16 --scales 0.5,2
+
+For each mode, dtype, and scale, this script generates a model with a
+single Resize op under out/ and runs it with run_onnx. The input and
+the scales are initializers.
+"""
+
+import argparse
+import itertools
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_resize_model(args, mode, dtype, scale):
+    bsize, channels, size = args.batchsize, args.channels, args.size
+    x = np.random.normal(size=(bsize, channels, size, size)).astype(dtype)
+    scales = np.array([1, 1, scale, scale], dtype=np.float32)
+    params = [('x', x), ('scales', scales)]
+    initializers = [numpy_helper.from_array(v, n) for n, v in params]
+    node = onnx.helper.make_node('Resize', ['x', 'scales'], ['y'], mode=mode)
+    inputs = []
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    out_size = int(np.floor(size * scale))
+    y = onnx.helper.make_tensor_value_info(
+        'y', initializers[0].data_type, (bsize, channels, out_size, out_size))
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [y],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 10)])
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def parse_floats(s):
+    return [float(v) for v in s.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--modes', default='nearest,linear,cubic')
+    parser.add_argument('--dtypes', default='float32,float16')
+    parser.add_argument('--scales', type=parse_floats, default='0.5,1.5,2')
+    parser.add_argument('--batchsize', '-B', type=int, default=1)
+    parser.add_argument('--channels', type=int, default=64)
+    parser.add_argument('--size', type=int, default=128)
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    print('%-8s %-8s %6s %10s %12s' %
+          ('mode', 'dtype', 'scale', 'msec', 'Mpixel/sec'))
+    grid = itertools.product(args.modes.split(','), args.dtypes.split(','),
+                             args.scales)
+    for mode, dtype, scale in grid:
+        model = make_resize_model(args, mode, dtype, scale)
+        out_dir = os.path.join('out', 'bench_resize_%s_%s_%g' %
+                               (mode, dtype, scale))
+        os.makedirs(out_dir, exist_ok=True)
+        model_path = os.path.join(out_dir, 'model.onnx')
+        with open(model_path, 'wb') as f:
+            f.write(model.SerializeToString())
+        elapsed = run(args, model_path)
+        out_size = int(np.floor(args.size * scale))
+        pixels = args.batchsize * args.channels * out_size * out_size
+        print('%-8s %-8s %6g %10.3f %12.1f' %
+              (mode, dtype, scale, elapsed, pixels / elapsed / 1000))
+
+
+if __name__ == '__main__':
+    main()
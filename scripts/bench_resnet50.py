@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""Measures the latency of ResNet-50.
+
+Usage:
+
+$ ./scripts/bench_resnet50.py
+$ ./scripts/bench_resnet50.py -B 32 -I 5
+$ ./scripts/bench_resnet50.py -B 32 --backprop
+
+This script generates a ResNet-50 with random weights under out/ and
+runs it with run_onnx. For inference, the model runs twice, with and
+without --channels_last. With --backprop, the time of a training step
+(forward and backward) is measured instead.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+class ResNet50Builder(object):
+
+    def __init__(self):
+        self.nodes = []
+        self.initializers = []
+        self.num_values = 0
+
+    def _name(self, prefix):
+        self.num_values += 1
+        return '%s_%d' % (prefix, self.num_values)
+
+    def param(self, prefix, value):
+        name = self._name(prefix)
+        self.initializers.append(numpy_helper.from_array(
+            value.astype(np.float32), name))
+        return name
+
+    def op(self, op_type, inputs, **kwargs):
+        output = self._name(op_type.lower())
+        self.nodes.append(onnx.helper.make_node(
+            op_type, inputs, [output], **kwargs))
+        return output
+
+    def conv_bn(self, x, in_ch, out_ch, ksize, stride=1, relu=True):
+        fan_in = in_ch * ksize * ksize
+        w = np.random.normal(scale=np.sqrt(2.0 / fan_in),
+                             size=(out_ch, in_ch, ksize, ksize))
+        pad = ksize // 2
+        h = self.op('Conv', [x, self.param('w', w)],
+                    kernel_shape=[ksize, ksize], strides=[stride, stride],
+                    pads=[pad, pad, pad, pad])
+        bn_params = [
+            np.random.uniform(0.5, 1.5, size=out_ch),
+            np.random.uniform(-0.1, 0.1, size=out_ch),
+            np.random.uniform(-0.1, 0.1, size=out_ch),
+            np.random.uniform(0.5, 1.5, size=out_ch),
+        ]
+        h = self.op('BatchNormalization',
+                    [h] + [self.param('bn', p) for p in bn_params],
+                    epsilon=1e-5)
+        if relu:
+            h = self.op('Relu', [h])
+        return h
+
+    def bottleneck(self, x, in_ch, mid_ch, out_ch, stride):
+        h = self.conv_bn(x, in_ch, mid_ch, 1)
+        h = self.conv_bn(h, mid_ch, mid_ch, 3, stride=stride)
+        h = self.conv_bn(h, mid_ch, out_ch, 1, relu=False)
+        if stride != 1 or in_ch != out_ch:
+            x = self.conv_bn(x, in_ch, out_ch, 1, stride=stride, relu=False)
+        return self.op('Relu', [self.op('Add', [h, x])])
+
+    def build(self, x):
+        h = self.conv_bn(x, 3, 64, 7, stride=2)
+        h = self.op('MaxPool', [h], kernel_shape=[3, 3], strides=[2, 2],
+                    pads=[1, 1, 1, 1])
+        in_ch = 64
+        for i, num_blocks in enumerate([3, 4, 6, 3]):
+            mid_ch = 64 << i
+            for j in range(num_blocks):
+                stride = 2 if i > 0 and j == 0 else 1
+                h = self.bottleneck(h, in_ch, mid_ch, mid_ch * 4, stride)
+                in_ch = mid_ch * 4
+        h = self.op('GlobalAveragePool', [h])
+        h = self.op('Flatten', [h])
+        w = np.random.normal(scale=0.01, size=(1000, in_ch))
+        b = np.zeros(1000)
+        return self.op('Gemm', [h, self.param('fc_w', w),
+                                self.param('fc_b', b)], transB=1)
+
+
+def make_resnet50_model(args):
+    builder = ResNet50Builder()
+    x = np.random.uniform(size=(args.batchsize, 3, 224, 224))
+    x_name = builder.param('input', x)
+    y_name = builder.build(x_name)
+    inputs = []
+    for t in builder.initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    output = onnx.helper.make_tensor_value_info(
+        y_name, onnx.TensorProto.FLOAT, (args.batchsize, 1000))
+    graph = onnx.helper.make_graph(builder.nodes, 'bench', inputs, [output],
+                                   initializer=builder.initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9)])
+
+
+def run(args, model_path, extra_args):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)] + extra_args
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--batchsize', '-B', type=int, default=1)
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    parser.add_argument('--backprop', action='store_true',
+                        help='Measure the time of a training step')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    model = make_resnet50_model(args)
+    out_dir = os.path.join('out', 'bench_resnet50_%d' % args.batchsize)
+    os.makedirs(out_dir, exist_ok=True)
+    model_path = os.path.join(out_dir, 'model.onnx')
+    with open(model_path, 'wb') as f:
+        f.write(model.SerializeToString())
+
+    if args.backprop:
+        elapsed = run(args, model_path, ['--backprop'])
+        print('ResNet-50 training batch=%d: %.3f msec/step' %
+              (args.batchsize, elapsed))
+        return
+
+    nchw = run(args, model_path, [])
+    nhwc = run(args, model_path, ['--channels_last'])
+    print('ResNet-50 batch=%d NCHW: %.3f msec' % (args.batchsize, nchw))
+    print('ResNet-50 batch=%d NHWC: %.3f msec (x%.2f)' %
+          (args.batchsize, nhwc, nchw / nhwc))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Measures the throughput of RNN, GRU, and LSTM ops.
+
+Usage:
+
+$ ./scripts/bench_rnn.py
+$ ./scripts/bench_rnn.py --ops LSTM --seq_lens 16,64 --hiddens 512
+
+For each combination of op, sequence length, batch size, and hidden
+size, this script generates a model with a single recurrent op under
+out/ and runs it with run_onnx.
+"""
+
+import argparse
+import itertools
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+NUM_GATES = {'RNN': 1, 'GRU': 3, 'LSTM': 4}
+
+
+def make_rnn_model(op, seq_len, bsize, hidden):
+    num_gates = NUM_GATES[op]
+    x = onnx.helper.make_tensor_value_info(
+        'x', onnx.TensorProto.FLOAT, (seq_len, bsize, hidden))
+    y = onnx.helper.make_tensor_value_info(
+        'y', onnx.TensorProto.FLOAT, (seq_len, 1, bsize, hidden))
+    scale = 1 / np.sqrt(hidden)
+    params = [
+        ('w', np.random.normal(
+            scale=scale,
+            size=(1, num_gates * hidden, hidden)).astype(np.float32)),
+        ('r', np.random.normal(
+            scale=scale,
+            size=(1, num_gates * hidden, hidden)).astype(np.float32)),
+        ('b', np.zeros((1, 2 * num_gates * hidden), dtype=np.float32)),
+    ]
+    initializers = [numpy_helper.from_array(v, n) for n, v in params]
+    node = onnx.helper.make_node(op, ['x', 'w', 'r', 'b'], ['y'],
+                                 hidden_size=hidden)
+    inputs = [x]
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [y],
+                                   initializer=initializers)
+    return onnx.helper.make_model(graph, producer_name='bench')
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    if args.device:
+        cmd += ['--device', args.device]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def parse_ints(s):
+    return [int(v) for v in s.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--ops', default='RNN,GRU,LSTM')
+    parser.add_argument('--seq_lens', type=parse_ints, default='16,64')
+    parser.add_argument('--batchsizes', type=parse_ints, default='1,16,64')
+    parser.add_argument('--hiddens', type=parse_ints, default='128,512')
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    parser.add_argument('--device', '-d', default=None)
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    print('%-5s %8s %6s %7s %10s %14s' %
+          ('op', 'seq_len', 'batch', 'hidden', 'msec', 'timesteps/sec'))
+    grid = itertools.product(args.ops.split(','), args.seq_lens,
+                             args.batchsizes, args.hiddens)
+    for op, seq_len, bsize, hidden in grid:
+        model = make_rnn_model(op, seq_len, bsize, hidden)
+        out_dir = os.path.join('out', 'bench_rnn_%s_%d_%d_%d' %
+                               (op.lower(), seq_len, bsize, hidden))
+        os.makedirs(out_dir, exist_ok=True)
+        model_path = os.path.join(out_dir, 'model.onnx')
+        with open(model_path, 'wb') as f:
+            f.write(model.SerializeToString())
+        elapsed = run(args, model_path)
+        print('%-5s %8d %6d %7d %10.3f %14.1f' %
+              (op, seq_len, bsize, hidden, elapsed,
+               seq_len * bsize / elapsed * 1000))
+
+
+if __name__ == '__main__':
+    main()
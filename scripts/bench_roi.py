@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Measures the throughput of ROI pooling and ROI align ops.
+
+Usage:
+
+$ ./scripts/bench_roi.py
+$ ./scripts/bench_roi.py --ops ChainerROIMaxAlign2D --backprop
+
+For each op and output size, this script generates a model with a
+single ROI op under out/ and runs it with run_onnx. The feature map
+and ROIs are initializers so --backprop also measures the gradient
+with respect to the feature map.
+"""
+
+import argparse
+import itertools
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+ALIGN_OPS = ['ChainerROIMaxAlign2D', 'ChainerROIAverageAlign2D']
+POOL_OPS = ['ChainerROIMaxPool2D', 'ChainerROIAveragePool2D']
+
+
+def make_roi_model(op, args, outsize):
+    bsize, channels, size = args.batchsize, args.channels, args.size
+    y = onnx.helper.make_tensor_value_info(
+        'y', onnx.TensorProto.FLOAT,
+        (args.num_rois, channels, outsize, outsize))
+    x = np.random.normal(size=(bsize, channels, size, size))
+    # ROIs are (ymin, xmin, ymax, xmax) in the image coordinate.
+    image_size = size / args.spatial_scale
+    tl = np.random.uniform(0, image_size * 0.8, size=(args.num_rois, 2))
+    hw = np.random.uniform(16, image_size * 0.5, size=(args.num_rois, 2))
+    br = np.minimum(tl + hw, image_size - 1)
+    rois = np.concatenate([tl, br], axis=1)
+    roi_indices = np.random.randint(0, bsize, size=args.num_rois)
+    params = [
+        ('x', x.astype(np.float32)),
+        ('rois', rois.astype(np.float32)),
+        ('roi_indices', roi_indices.astype(np.int64)),
+    ]
+    initializers = [numpy_helper.from_array(v, n) for n, v in params]
+
+    attrs = {'output_shape': [outsize, outsize],
+             'spatial_scale': args.spatial_scale}
+    if op in ALIGN_OPS:
+        attrs['sampling_ratio_list'] = [2, 2]
+    node = onnx.helper.make_node(op, ['x', 'rois', 'roi_indices'], ['y'],
+                                 domain='org.chainer', **attrs)
+    inputs = []
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    graph = onnx.helper.make_graph([node], 'bench', inputs, [y],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9),
+                       onnx.helper.make_opsetid('org.chainer', 9)])
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    if args.backprop:
+        cmd.append('--backprop')
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def parse_ints(s):
+    return [int(v) for v in s.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--ops', default=','.join(POOL_OPS + ALIGN_OPS))
+    parser.add_argument('--outsizes', type=parse_ints, default='7,14')
+    parser.add_argument('--num_rois', type=int, default=1000)
+    parser.add_argument('--batchsize', '-B', type=int, default=2)
+    parser.add_argument('--channels', type=int, default=256)
+    parser.add_argument('--size', type=int, default=50)
+    parser.add_argument('--spatial_scale', type=float, default=1 / 16)
+    parser.add_argument('--backprop', action='store_true')
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    np.random.seed(42)
+    print('%-26s %8s %10s %12s' % ('op', 'outsize', 'msec', 'rois/sec'))
+    grid = itertools.product(args.ops.split(','), args.outsizes)
+    for op, outsize in grid:
+        model = make_roi_model(op, args, outsize)
+        out_dir = os.path.join('out', 'bench_roi_%s_%d' % (op, outsize))
+        os.makedirs(out_dir, exist_ok=True)
+        model_path = os.path.join(out_dir, 'model.onnx')
+        with open(model_path, 'wb') as f:
+            f.write(model.SerializeToString())
+        elapsed = run(args, model_path)
+        print('%-26s %8d %10.3f %12.1f' %
+              (op, outsize, elapsed, args.num_rois / elapsed * 1000))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Measures ops which turn sequences into tensors.
+
+Usage:
+
+$ ./scripts/bench_sequence.py
+$ ./scripts/bench_sequence.py --num_sequences 2048 --max_length 50
+
+This script generates models under out/ which split a padded batch
+into variable-length sequences with ChainerSequenceUnpad and runs
+them with run_onnx. The baseline model only splits the batch. The
+other models also pad the sequences back to a tensor with
+ChainerSequencePad, or concatenate them with ChainerSequenceConcat.
+The difference from the baseline is the time of the op.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import numpy as np
+import onnx
+from onnx import numpy_helper
+
+
+def make_model(args, op):
+    lengths = np.random.randint(1, args.max_length + 1,
+                                size=args.num_sequences)
+    x = np.random.normal(
+        size=(args.num_sequences, args.max_length, args.units))
+    params = [
+        ('x', x.astype(np.float32)),
+        ('lengths', lengths.astype(np.int64)),
+    ]
+    initializers = [numpy_helper.from_array(v, n) for n, v in params]
+
+    def chainer_node(op_type, inputs, outputs, **attrs):
+        return onnx.helper.make_node(op_type, inputs, outputs,
+                                     domain='org.chainer', **attrs)
+
+    nodes = [
+        chainer_node('ChainerSequenceSeparate', ['lengths'], ['lengths_seq']),
+        chainer_node('ChainerSequenceUnpad', ['x', 'lengths_seq'], ['seq']),
+    ]
+    if op == 'baseline':
+        nodes.append(chainer_node('ChainerSequenceSize', ['seq'], ['y']))
+        y = onnx.helper.make_tensor_value_info(
+            'y', onnx.TensorProto.INT64, ())
+    elif op == 'pad':
+        nodes.append(chainer_node('ChainerSequencePad', ['seq'], ['y']))
+        y = onnx.helper.make_tensor_value_info(
+            'y', onnx.TensorProto.FLOAT, None)
+    elif op == 'concat':
+        nodes.append(chainer_node('ChainerSequenceConcat', ['seq'], ['y'],
+                                  axis=0))
+        y = onnx.helper.make_tensor_value_info(
+            'y', onnx.TensorProto.FLOAT, None)
+    else:
+        raise RuntimeError('Unknown op: %s' % op)
+
+    inputs = []
+    for t in initializers:
+        inputs.append(onnx.helper.make_tensor_value_info(
+            t.name, t.data_type, t.dims))
+    graph = onnx.helper.make_graph(nodes, 'bench', inputs, [y],
+                                   initializer=initializers)
+    return onnx.helper.make_model(
+        graph, producer_name='bench',
+        opset_imports=[onnx.helper.make_opsetid('', 9),
+                       onnx.helper.make_opsetid('org.chainer', 9)])
+
+
+def run(args, model_path):
+    cmd = [os.path.join(args.build_dir, 'tools/run_onnx'),
+           '--onnx', model_path,
+           '--iterations', str(args.iterations)]
+    if args.device:
+        cmd += ['--device', args.device]
+    output = subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+    m = re.search(r'Best elapsed: (\d+(\.\d+)?)', output.decode())
+    if not m:
+        sys.stderr.write(output.decode())
+        raise RuntimeError('Failed to parse the output of run_onnx')
+    return float(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--num_sequences', type=int, default=512)
+    parser.add_argument('--max_length', type=int, default=200)
+    parser.add_argument('--units', type=int, default=256)
+    parser.add_argument('--device', '-d', default='')
+    parser.add_argument('--iterations', '-I', type=int, default=10)
+    parser.add_argument('--build_dir', '-b', default='build')
+    args = parser.parse_args()
+
+    baseline = None
+    for op in ['baseline', 'pad', 'concat']:
+        np.random.seed(42)
+        model = make_model(args, op)
+        out_dir = os.path.join('out', 'bench_sequence_%s' % op)
+        os.makedirs(out_dir, exist_ok=True)
+        model_path = os.path.join(out_dir, 'model.onnx')
+        with open(model_path, 'wb') as f:
+            f.write(model.SerializeToString())
+        elapsed = run(args, model_path)
+        if baseline is None:
+            baseline = elapsed
+            print('%-8s %10.3f msec' % (op, elapsed))
+        else:
+            print('%-8s %10.3f msec (+%.3f msec)' %
+                  (op, elapsed, elapsed - baseline))
+
+
+if __name__ == '__main__':
+    main()
@@ -365,6 +365,153 @@ def gen_concat_backprop_test(test_name):
     gb.gen_test()
 
 
+def gen_micro_batch_backprop_test(test_name):
+    gb = onnx_script.GraphBuilder(test_name)
+    x = np.random.rand(6, 3).astype(np.float32)
+    w = np.random.rand(3, 2).astype(np.float32)
+
+    x_v = gb.input('x', x)
+    w_v = gb.param('w', w)
+
+    y_v = gb.MatMul([x_v, w_v])
+    y2_v = gb.Mul([y_v, y_v])
+    r_v = gb.ReduceMean([y2_v], keepdims=False)
+
+    # Expectations are computed for the whole batch.
+    y = np.dot(x, w)
+    gb.output(r_v, np.mean(y * y))
+    gb.gradient(w_v, np.dot(x.T, 2 * y) / y.size)
+    gb.gen_test()
+
+
+def gen_micro_batch_batched_output_backprop_test(test_name):
+    gb = onnx_script.GraphBuilder(test_name)
+    x = np.random.rand(6, 3).astype(np.float32)
+    w = np.random.rand(3, 2).astype(np.float32)
+
+    x_v = gb.input('x', x)
+    w_v = gb.param('w', w)
+
+    y_v = gb.MatMul([x_v, w_v])
+    y2_v = gb.Mul([y_v, y_v])
+
+    # The output keeps the batch dimension and its gradient is the
+    # one of its sum.
+    y = np.dot(x, w)
+    gb.output(y2_v, y * y)
+    gb.gradient(w_v, np.dot(x.T, 2 * y))
+    gb.gen_test()
+
+
+def gen_mixed_precision_backprop_test(test_name):
+    gb = onnx_script.GraphBuilder(test_name)
+    x = np.random.rand(4, 3).astype(np.float32)
+    w = np.random.rand(3, 2).astype(np.float32)
+
+    x_v = gb.input('x', x)
+    w_v = gb.param('w', w)
+
+    y_v = gb.Relu([gb.MatMul([x_v, w_v])])
+    r_v = gb.ReduceMean([gb.Mul([y_v, y_v])], keepdims=False)
+
+    y = np.dot(x, w)
+    gb.output(r_v, np.mean(y * y))
+    gb.gradient(w_v, np.dot(x.T, 2 * y) / y.size)
+    gb.gen_test()
+
+
+def gen_roi_backprop_test(op_type, fn, dtype=np.float32, **kwargs):
+    def gen(test_name):
+        gb = onnx_script.GraphBuilder(test_name)
+        x = np.random.rand(2, 3, 12, 12).astype(dtype)
+        # (y_min, x_min, y_max, x_max). The first two ROIs overlap.
+        rois = np.array([[1, 1, 6, 6], [2.5, 3, 9, 8.5], [0, 4, 11, 11]],
+                        dtype)
+        roi_indices = np.array([0, 0, 1], np.int32)
+        outsize = (3, 2)
+        spatial_scale = 0.8
+
+        x_v = gb.param('x', x)
+        rois_v = gb.const(rois)
+        roi_indices_v = gb.const(roi_indices)
+        attrs = {'output_shape': outsize, 'spatial_scale': spatial_scale}
+        if 'sampling_ratio' in kwargs:
+            attrs['sampling_ratio_list'] = kwargs['sampling_ratio']
+        y_v = gb.make_node(op_type, inputs=[x_v, rois_v, roi_indices_v],
+                           **attrs)
+
+        xv = chainer.Variable(x)
+        y = fn(xv, rois, roi_indices, outsize, spatial_scale, **kwargs)
+        F.sum(y).backward()
+        gb.output(y_v, y)
+        gb.gradient(x_v, xv.grad)
+        gb.gen_test()
+
+    return gen
+
+
+def _lstm_with_peepholes(x, w, r, b, p):
+    def sigmoid(v):
+        return 1 / (1 + np.exp(-v))
+
+    hidden_size = r.shape[2]
+    h = np.zeros((x.shape[1], hidden_size), x.dtype)
+    c = np.zeros((x.shape[1], hidden_size), x.dtype)
+    pi, po, pf = np.split(p[0], 3)
+    ys = []
+    for xt in x:
+        gates = xt.dot(w[0].T) + h.dot(r[0].T) + b[0, :4 * hidden_size] + \
+            b[0, 4 * hidden_size:]
+        i, o, f, nc = np.split(gates, 4, axis=1)
+        i = sigmoid(i + pi * c)
+        f = sigmoid(f + pf * c)
+        c = f * c + i * np.tanh(nc)
+        o = sigmoid(o + po * c)
+        h = o * np.tanh(c)
+        ys.append(h)
+    return np.stack(ys)[:, np.newaxis]
+
+
+# Checks the gradients of LSTM with peepholes against numerical
+# gradients of the sum of its output.
+def gen_lstm_peepholes_backprop_test(test_name):
+    gb = onnx_script.GraphBuilder(test_name)
+    seq_length, batch_size, input_size, hidden_size = 3, 2, 4, 3
+    params = [
+        np.random.rand(seq_length, batch_size, input_size) - 0.5,
+        np.random.rand(1, 4 * hidden_size, input_size) - 0.5,
+        np.random.rand(1, 4 * hidden_size, hidden_size) - 0.5,
+        np.random.rand(1, 8 * hidden_size) - 0.5,
+        np.random.rand(1, 3 * hidden_size) - 0.5,
+    ]
+
+    grads = []
+    eps = 1e-4
+    for param in params:
+        grad = np.zeros_like(param)
+        for index in np.ndindex(param.shape):
+            orig = param[index]
+            param[index] = orig + eps
+            yp = np.sum(_lstm_with_peepholes(*params))
+            param[index] = orig - eps
+            ym = np.sum(_lstm_with_peepholes(*params))
+            param[index] = orig
+            grad[index] = (yp - ym) / (2 * eps)
+        grads.append(grad.astype(np.float32))
+
+    params = [param.astype(np.float32) for param in params]
+    names = ['x', 'w', 'r', 'b', 'p']
+    param_vs = [gb.param(name, param) for name, param in zip(names, params)]
+    x_v, w_v, r_v, b_v, p_v = param_vs
+    y_v, _, _ = gb.make_node(
+        'LSTM', inputs=[x_v, w_v, r_v, b_v, '', '', '', p_v],
+        outputs=['y', 'y_h', 'y_c'], hidden_size=hidden_size)
+    gb.output(y_v, _lstm_with_peepholes(*params))
+    for param_v, grad in zip(param_vs, grads):
+        gb.gradient(param_v, grad)
+    gb.gen_test()
+
+
 # Borrowed from: https://github.com/tensorflow/tensorflow/blob/master/tensorflow/cc/framework/while_gradients_test.cc
 def gen_loop_backprop_test(ii, ji, ki, gi, gj, gk):
     i, j, k = ii, ji, ki
@@ -1128,6 +1275,49 @@ def get_tests():
 
     test('extra_backprop_test_concat', gen_concat_backprop_test)
 
+    test('extra_backprop_test_micro_batch', gen_micro_batch_backprop_test,
+         num_micro_batches=3)
+
+    test('extra_backprop_test_micro_batch_batched_output',
+         gen_micro_batch_batched_output_backprop_test,
+         num_micro_batches=3)
+
+    test('extra_backprop_test_roi_max_pool_2d',
+         gen_roi_backprop_test('ChainerROIMaxPool2D',
+                               F.roi_max_pooling_2d))
+    test('extra_backprop_test_roi_average_pool_2d',
+         gen_roi_backprop_test('ChainerROIAveragePool2D',
+                               F.roi_average_pooling_2d))
+    test('extra_backprop_test_roi_max_align_2d',
+         gen_roi_backprop_test('ChainerROIMaxAlign2D',
+                               F.roi_max_align_2d,
+                               sampling_ratio=(2, 2)))
+    test('extra_backprop_test_roi_average_align_2d',
+         gen_roi_backprop_test('ChainerROIAverageAlign2D',
+                               F.roi_average_align_2d,
+                               sampling_ratio=(2, 2)))
+    test('extra_backprop_test_roi_max_pool_2d_float64',
+         gen_roi_backprop_test('ChainerROIMaxPool2D',
+                               F.roi_max_pooling_2d,
+                               dtype=np.float64))
+    test('extra_backprop_test_roi_average_align_2d_float64',
+         gen_roi_backprop_test('ChainerROIAverageAlign2D',
+                               F.roi_average_align_2d,
+                               dtype=np.float64,
+                               sampling_ratio=(2, 2)))
+    test('extra_backprop_test_roi_average_pool_2d_float16',
+         gen_roi_backprop_test('ChainerROIAveragePool2D',
+                               F.roi_average_pooling_2d,
+                               dtype=np.float16),
+         rtol=1e-2)
+
+    test('extra_backprop_test_lstm_peepholes',
+         gen_lstm_peepholes_backprop_test, rtol=1e-3)
+
+    test('extra_backprop_test_mixed_precision',
+         gen_mixed_precision_backprop_test,
+         mixed_precision=True, rtol=1e-2)
+
     test('extra_backprop_test_loop_012',
          gen_loop_backprop_test(0, 1, 2, 1, 5, 1))
     test('extra_backprop_test_loop_000',
@@ -118,6 +118,10 @@ FLAGS = {
         'type': 'bool',
         'doc': 'Quantize ONNX model'
     },
+    'quantization_params': {
+        'type': 'std::string',
+        'doc': 'Static quantization parameters generated by calibration'
+    },
 
     'computation_order': {
         'type': 'std::string',
@@ -131,6 +135,30 @@ FLAGS = {
         'type': 'int',
         'doc': 'Memory budget of GT policy (in MB)'
     },
+    'mixed_precision': {
+        'type': 'bool',
+        'doc': 'Compute in float16 with float32 master weights and dynamic loss scaling'
+    },
+    'channels_last': {
+        'type': 'bool',
+        'doc': 'Run Conv, pooling and BatchNormalization in the NHWC layout on CPU (inference only)'
+    },
+    'unroll_loops_max_nodes': {
+        'type': 'int',
+        'doc': 'Fully unroll Loops with constant trip counts if the unrolled loop has at most this many nodes'
+    },
+    'if_to_where_max_flops': {
+        'type': 'int',
+        'doc': 'Evaluate both branches of Ifs and select the results by Where if the branches have at most this many FLOPs in total (inference only)'
+    },
+    'symbolic_dim_size': {
+        'type': 'int',
+        'doc': 'Assumed size of symbolic dimensions (e.g., batch) to estimate memory usage and to generate test inputs'
+    },
+    'num_micro_batches': {
+        'type': 'int',
+        'doc': 'Split the batch into the specified number of micro-batches and accumulate gradients (backprop only)'
+    },
 }
 
 
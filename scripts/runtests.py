@@ -237,12 +237,21 @@ TEST_CASES = [
     TestCase(NODE_TEST, 'test_globalaveragepool_precomputed'),
     TestCase(NODE_TEST, 'test_upsample_nearest'),
     TestCase(NODE_TEST, 'test_resize_upsample_nearest'),
-    # TestCase(NODE_TEST, 'test_resize_upsample_linear'),
-    # TestCase(NODE_TEST, 'test_resize_downsample_nearest'),
-    # TestCase(NODE_TEST, 'test_resize_downsample_linear'),
+    TestCase(NODE_TEST, 'test_resize_upsample_linear'),
+    TestCase(NODE_TEST, 'test_resize_downsample_nearest'),
+    TestCase(NODE_TEST, 'test_resize_downsample_linear'),
     # The second ROI values mismatch. Let the test pass with
     # ridiculously large tolerance.
     TestCase(NODE_TEST, 'test_roialign', rtol=0.5, atol=0.5),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_center_point_box_format'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_flipped_coordinates'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_identical_boxes'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_limit_output_size'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_single_box'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_suppress_by_IOU'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_suppress_by_IOU_and_scores'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_two_batches'),
+    TestCase(NODE_TEST, 'test_nonmaxsuppression_two_classes'),
 
     TestCase(NODE_TEST, 'test_shape'),
     TestCase(NODE_TEST, 'test_shape_example'),
@@ -310,7 +319,7 @@ TEST_CASES = [
     TestCase(NODE_TEST, 'test_gru_with_initial_bias'),
     TestCase(NODE_TEST, 'test_lstm_defaults'),
     TestCase(NODE_TEST, 'test_lstm_with_initial_bias'),
-    TestCase(NODE_TEST, 'test_lstm_with_peepholes', rtol=5e-2),
+    TestCase(NODE_TEST, 'test_lstm_with_peepholes'),
 
     TestCase(NODE_TEST, 'test_softmax_axis_0'),
     TestCase(NODE_TEST, 'test_softmax_axis_1'),
@@ -633,8 +642,29 @@ TEST_CASES.extend(onnx_real_tests.get())
 
 TEST_CASES.extend(gen_chainercv_model_tests.get_tests())
 
+# Tests which also run with the NHWC layout. See compiler/layout.h.
+CHANNELS_LAST_TESTS = [
+    'test_basic_conv_with_padding',
+    'test_basic_conv_without_padding',
+    'test_conv_with_strides_padding',
+    'test_conv_with_strides_no_padding',
+    'test_maxpool_2d_pads',
+    'test_maxpool_2d_strides',
+    'test_averagepool_2d_pads',
+    'test_averagepool_2d_pads_count_include_pad',
+    'test_averagepool_2d_strides',
+    'test_batchnorm_example',
+    'test_batchnorm_epsilon',
+]
+
 new_tests = []
 for test in TEST_CASES:
+    if test.name in CHANNELS_LAST_TESTS:
+        new_test = copy.copy(test)
+        new_test.name = test.name + '_channels_last'
+        new_test.channels_last = True
+        new_tests.append(new_test)
+
     if not test.is_backprop:
         continue
 
@@ -840,6 +870,9 @@ def main():
         'test_onehot_without_axis',
         'test_upsample_nearest',
         'test_resize_upsample_nearest',
+        'test_resize_upsample_linear',
+        'test_resize_downsample_nearest',
+        'test_resize_downsample_linear',
         'test_reshape_extended_dims',
         'test_reshape_negative_dim',
         'test_reshape_one_dim',
@@ -867,6 +900,15 @@ def main():
         'test_matmulinteger',
         'test_bitshift_left_uint8',
         'test_qlinearconv',
+        'test_nonmaxsuppression_center_point_box_format',
+        'test_nonmaxsuppression_flipped_coordinates',
+        'test_nonmaxsuppression_identical_boxes',
+        'test_nonmaxsuppression_limit_output_size',
+        'test_nonmaxsuppression_single_box',
+        'test_nonmaxsuppression_suppress_by_IOU',
+        'test_nonmaxsuppression_suppress_by_IOU_and_scores',
+        'test_nonmaxsuppression_two_batches',
+        'test_nonmaxsuppression_two_classes',
     ]
 
     tested = []
@@ -915,6 +957,16 @@ def main():
             test_case.args.append(
                 '--computation_order=' + args.computation_order)
 
+        if test_case.num_micro_batches is not None:
+            test_case.args.append(
+                '--num_micro_batches=%d' % test_case.num_micro_batches)
+
+        if test_case.mixed_precision:
+            test_case.args.append('--mixed_precision')
+
+        if test_case.channels_last:
+            test_case.args.append('--channels_last')
+
         if test_case.backend is not None:
             test_case.args.append('--backend')
             test_case.args.append(test_case.backend)
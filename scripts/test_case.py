@@ -14,7 +14,10 @@ class TestCase(object):
                  skip_runtime_type_check=False,
                  want_gpu=False,
                  prepare_func=None,
-                 backend=None):
+                 backend=None,
+                 num_micro_batches=None,
+                 mixed_precision=False,
+                 channels_last=False):
         assert name is not None
         self.name = name
         if basedir is None:
@@ -37,6 +40,9 @@ class TestCase(object):
         self.want_gpu = want_gpu
         self.prepare_func = prepare_func
         self.backend = backend
+        self.num_micro_batches = num_micro_batches
+        self.mixed_precision = mixed_precision
+        self.channels_last = channels_last
 
         self.log_dirname = self.test_dir
         if not (self.log_dirname.startswith('out') or
@@ -141,3 +141,58 @@ def test_custom_op():
 
     chainerx.testing.assert_allclose(9, outputs['y'].array())
     chainerx.testing.assert_allclose(42, outputs['z'].array())
+
+
+def test_program_cache():
+    graph = _chainer_compiler_core.load('out/ch2o_node_Linear/model.onnx')
+    params = graph.params()
+    input_names = graph.input_names()
+    output_names = graph.output_names()
+
+    cache = graph.program_cache(capacity=1, background=False)
+
+    for batch_size in [5, 5, 3]:
+        inputs = dict(params)
+        t1 = aranges(batch_size, 7)
+        inputs[input_names[0]] = _chainer_compiler_core.value(t1)
+        y1 = (chainerx.dot(t1, params['/l1/W'].array().T) +
+              params['/l1/b'].array())
+
+        outputs = cache.run(inputs)
+        chainerx.testing.assert_allclose(
+            y1, outputs[output_names[0]].array())
+
+    stats = cache.stats()
+    assert stats['hits'] == 1
+    assert stats['misses'] == 2
+    assert stats['evictions'] == 1
+    assert stats['num_compiled'] == 2
+
+
+def test_program_cache_background():
+    graph = _chainer_compiler_core.load('out/ch2o_node_Linear/model.onnx')
+    params = graph.params()
+    input_names = graph.input_names()
+    output_names = graph.output_names()
+
+    cache = graph.program_cache(capacity=2, background=True)
+
+    # The generic program cannot run the batch size 3, so the second
+    # run waits for its specialized program.
+    for batch_size in [5, 3, 3]:
+        inputs = dict(params)
+        t1 = aranges(batch_size, 7)
+        inputs[input_names[0]] = _chainer_compiler_core.value(t1)
+        y1 = (chainerx.dot(t1, params['/l1/W'].array().T) +
+              params['/l1/b'].array())
+
+        outputs = cache.run(inputs)
+        chainerx.testing.assert_allclose(
+            y1, outputs[output_names[0]].array())
+
+    cache.wait()
+    stats = cache.stats()
+    assert stats['hits'] == 1
+    assert stats['misses'] == 2
+    assert stats['evictions'] == 0
+    assert stats['num_compiled'] == 2
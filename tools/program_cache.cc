@@ -0,0 +1,200 @@
+#include "tools/program_cache.h"
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#include <chainerx/array.h>
+#include <chainerx/backprop_mode.h>
+
+#include <common/log.h>
+#include <compiler/chxvm/emitter.h>
+#include <compiler/flags.h>
+#include <compiler/graph.h>
+#include <compiler/passes.h>
+#include <compiler/type.h>
+#include <compiler/value.h>
+#include <runtime/chxvm.pb.h>
+#include <runtime/chxvm_var.h>
+
+namespace chainer_compiler {
+namespace runtime {
+
+ProgramCache::ProgramCache(const Graph& graph, int capacity, bool background)
+    : capacity_(capacity), background_(background), context_(&chainerx::GetDefaultContext()) {
+    CHECK_LT(0, capacity);
+    graph.ToONNX(&xgraph_);
+    for (const Value* value : graph.input_values()) {
+        if (value->initializer()) {
+            continue;
+        }
+        input_names_.push_back(value->name());
+        const Type& type = value->type();
+        // Inputs of unknown ranks are not checked.
+        if (type.kind() != Type::Kind::kTensor || (!type.HasKnownShape() && type.ndim() == 0)) {
+            continue;
+        }
+        ChxVMTypeProto& generic_type = generic_types_[value->name()];
+        for (size_t i = 0; i < type.ndim(); ++i) {
+            generic_type.add_shape(type.dims()[i]);
+            generic_type.add_dim_params(type.dim_param(i));
+        }
+    }
+    generic_ = Compile(nullptr);
+}
+
+ProgramCache::~ProgramCache() {
+    Wait();
+}
+
+std::string ProgramCache::GetShapeSignature(const InOuts& inputs) const {
+    std::ostringstream oss;
+    for (const std::string& name : input_names_) {
+        auto found = inputs.find(name);
+        if (found == inputs.end() || !found->second->IsArray()) {
+            continue;
+        }
+        const chainerx::Array& a = found->second->GetArray();
+        oss << name << ':' << a.dtype() << a.shape() << ';';
+    }
+    return oss.str();
+}
+
+bool ProgramCache::AcceptedByGeneric(const InOuts& inputs) const {
+    std::map<std::string, int64_t> bindings;
+    for (const auto& p : generic_types_) {
+        auto found = inputs.find(p.first);
+        if (found == inputs.end() || !found->second->IsArray()) {
+            continue;
+        }
+        if (!MatchesShape(p.second, found->second->GetArray().shape(), &bindings)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<ChxVM> ProgramCache::WaitEntry(const std::shared_ptr<Entry>& entry) {
+    std::unique_lock<std::mutex> lock(mu_);
+    compiled_.wait(lock, [&entry]() { return entry->chxvm != nullptr; });
+    return entry->chxvm;
+}
+
+std::shared_ptr<ChxVM> ProgramCache::GetProgram(const InOuts& inputs) {
+    const std::string signature = GetShapeSignature(inputs);
+    std::shared_ptr<Entry> entry;
+    bool is_new = false;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto found = entries_.find(signature);
+        if (found != entries_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second);
+            entry = *found->second;
+            if (entry->chxvm) {
+                ++stats_.hits;
+                return entry->chxvm;
+            }
+            // Still being compiled.
+            ++stats_.misses;
+        } else {
+            ++stats_.misses;
+            entry = std::make_shared<Entry>();
+            entry->signature = signature;
+            lru_.push_front(entry);
+            entries_.emplace(signature, lru_.begin());
+            EvictLocked();
+            ++num_compiling_;
+            is_new = true;
+        }
+    }
+
+    if (is_new) {
+        InputShapes input_shapes;
+        for (const std::string& name : input_names_) {
+            auto found = inputs.find(name);
+            if (found != inputs.end() && found->second->IsArray()) {
+                input_shapes.emplace(name, found->second->GetArray().shape());
+            }
+        }
+
+        if (!background_) {
+            CompileEntry(entry, std::move(input_shapes));
+            return WaitEntry(entry);
+        }
+        std::thread(&ProgramCache::CompileEntry, this, entry, std::move(input_shapes)).detach();
+    }
+    // The generic program cannot run inputs whose shapes are
+    // incompatible with the types of the graph inputs.
+    return AcceptedByGeneric(inputs) ? generic_ : WaitEntry(entry);
+}
+
+InOuts ProgramCache::Run(const InOuts& inputs, const ChxVMOptions& options) {
+    return GetProgram(inputs)->Run(inputs, options);
+}
+
+void ProgramCache::Wait() {
+    std::unique_lock<std::mutex> lock(mu_);
+    compiled_.wait(lock, [this]() { return num_compiling_ == 0; });
+}
+
+ProgramCacheStats ProgramCache::stats() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return stats_;
+}
+
+std::shared_ptr<ChxVM> ProgramCache::Compile(const InputShapes* input_shapes) const {
+    chainerx::ContextScope context_scope(*context_);
+    chainerx::NoBackpropModeScope no_backprop_scope;
+
+    Graph graph(xgraph_);
+    if (input_shapes) {
+        for (Value* value : graph.input_values()) {
+            auto found = input_shapes->find(value->name());
+            if (found == input_shapes->end() || value->type().kind() != Type::Kind::kTensor) {
+                continue;
+            }
+            const chainerx::Shape& shape = found->second;
+            value->set_type(new Type(value->type().dtype(), std::vector<int64_t>(shape.begin(), shape.end())));
+        }
+        // Let the shape inference propagate the new input shapes.
+        if (!g_skip_inference) {
+            for (const std::unique_ptr<Value>& value : graph.all_values()) {
+                if (!value->IsInput()) {
+                    value->set_type(new Type());
+                }
+            }
+        }
+    }
+
+    constexpr bool kBackprop = false;
+    RunDefaultPasses(&graph, kBackprop);
+    ChxVMProgramProto chxvm_prog;
+    constexpr bool kDumpValueNames = false;
+    chxvm::Emit(graph, &chxvm_prog, kDumpValueNames);
+    return std::make_shared<ChxVM>(chxvm_prog);
+}
+
+void ProgramCache::CompileEntry(std::shared_ptr<Entry> entry, InputShapes input_shapes) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::shared_ptr<ChxVM> chxvm = Compile(&input_shapes);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mu_);
+    entry->chxvm = chxvm;
+    ++stats_.num_compiled;
+    stats_.compile_seconds += std::chrono::duration<double>(end - start).count();
+    --num_compiling_;
+    compiled_.notify_all();
+}
+
+void ProgramCache::EvictLocked() {
+    while (static_cast<int>(lru_.size()) > capacity_) {
+        entries_.erase(lru_.back()->signature);
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+}  // namespace runtime
+}  // namespace chainer_compiler
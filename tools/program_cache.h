@@ -0,0 +1,104 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <compiler/onnx.h>
+
+#include <chainerx/context.h>
+#include <chainerx/shape.h>
+
+#include <runtime/chxvm.h>
+
+namespace chainer_compiler {
+
+class Graph;
+
+namespace runtime {
+
+struct ProgramCacheStats {
+    int64_t hits{0};
+    int64_t misses{0};
+    int64_t evictions{0};
+    int64_t num_compiled{0};
+    // Total seconds spent for compiling specialized programs.
+    double compile_seconds{0};
+};
+
+// Keeps the source graph of a model and compiles a program
+// specialized for each distinct set of input shapes on demand. The
+// specialized programs are kept in an LRU cache. While a program for
+// new shapes is being compiled in the background, the generic
+// program, which was compiled from the graph as is, is used instead
+// if it accepts the shapes. Otherwise, the caller waits for the
+// compilation.
+class ProgramCache {
+public:
+    // `capacity` is the maximum number of specialized programs. The
+    // compilation for new shapes is done synchronously if
+    // `background` is false.
+    ProgramCache(const Graph& graph, int capacity, bool background = true);
+    ~ProgramCache();
+
+    ProgramCache(const ProgramCache&) = delete;
+    ProgramCache& operator=(const ProgramCache&) = delete;
+
+    // Returns the best program available now for `inputs`.
+    std::shared_ptr<ChxVM> GetProgram(const InOuts& inputs);
+
+    InOuts Run(const InOuts& inputs, const ChxVMOptions& options);
+
+    // Waits for all background compilations.
+    void Wait();
+
+    ProgramCacheStats stats() const;
+
+    // Returns a string which identifies the dtypes and shapes of the
+    // non-parameter inputs in `inputs`.
+    std::string GetShapeSignature(const InOuts& inputs) const;
+
+private:
+    struct Entry {
+        std::string signature;
+        std::shared_ptr<ChxVM> chxvm;
+    };
+
+    typedef std::map<std::string, chainerx::Shape> InputShapes;
+
+    // Compiles the source graph. The types of inputs are replaced by
+    // `input_shapes` if specified.
+    std::shared_ptr<ChxVM> Compile(const InputShapes* input_shapes) const;
+    void CompileEntry(std::shared_ptr<Entry> entry, InputShapes input_shapes);
+    void EvictLocked();
+    // Returns true if the shapes of `inputs` match the types of the
+    // graph inputs, which the generic program checks.
+    bool AcceptedByGeneric(const InOuts& inputs) const;
+    // Waits until the program of `entry` is compiled.
+    std::shared_ptr<ChxVM> WaitEntry(const std::shared_ptr<Entry>& entry);
+
+    onnx::GraphProto xgraph_;
+    std::vector<std::string> input_names_;
+    const int capacity_;
+    const bool background_;
+    chainerx::Context* context_;
+    std::shared_ptr<ChxVM> generic_;
+    // The types of non-parameter inputs of the generic program.
+    std::map<std::string, ChxVMTypeProto> generic_types_;
+
+    mutable std::mutex mu_;
+    std::condition_variable compiled_;
+    // The most recently used entry comes first.
+    std::list<std::shared_ptr<Entry>> lru_;
+    std::map<std::string, std::list<std::shared_ptr<Entry>>::iterator> entries_;
+    int num_compiling_{0};
+    ProgramCacheStats stats_;
+};
+
+}  // namespace runtime
+}  // namespace chainer_compiler
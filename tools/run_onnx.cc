@@ -2,6 +2,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <queue>
 #include <set>
@@ -29,6 +30,7 @@
 #include <compiler/model.h>
 #include <compiler/onnx.h>
 #include <compiler/passes.h>
+#include <compiler/quantize.h>
 #include <compiler/tensor.h>
 #include <compiler/util.h>
 #include <compiler/value.h>
@@ -36,12 +38,15 @@
 #include <runtime/chrome_tracing.h>
 #include <runtime/chxvm.h>
 #include <runtime/chxvm.pb.h>
+#include <runtime/chxvm_op.h>
+#include <runtime/chxvm_state.h>
 #include <runtime/chxvm_var.h>
 #include <runtime/meminfo.h>
 #include <tools/cmdline.h>
 #include <tools/compiler_flags.h>
 #include <tools/log.h>
 #include <tools/run_onnx_util.h>
+#include <tools/serving_simulator.h>
 #include <tools/util.h>
 
 namespace chainer_compiler {
@@ -54,8 +59,9 @@ chainerx::Shape ChainerXShapeFromONNX(const onnx::TensorShapeProto& xshape) {
         if (dim.has_dim_value()) {
             shape.push_back(dim.dim_value());
         } else {
-            LOG() << "Dimension " << dim.dim_param() << " was replaced by 1" << std::endl;
-            shape.push_back(1);
+            const int64_t size = g_symbolic_dim_size > 0 ? g_symbolic_dim_size : 1;
+            LOG() << "Dimension " << dim.dim_param() << " was replaced by " << size << std::endl;
+            shape.push_back(size);
         }
     }
     return shape;
@@ -101,6 +107,65 @@ ChxVMVar* StageVar(ChxVMVar* var) {
     CHECK(false);
 }
 
+// Collects ranges of float values over test cases to calculate
+// static quantization parameters.
+class QuantizationCalibrator {
+public:
+    explicit QuantizationCalibrator(const Graph& graph) {
+        // ChxVM instructions have cleansed names.
+        for (const std::unique_ptr<Value>& value : graph.all_values()) {
+            names_.emplace(CleanseIdent(value->name()), value->name());
+        }
+    }
+
+    void Observe(const std::string& name, const chainerx::Array& a) {
+        if (chainerx::GetKind(a.dtype()) != chainerx::DtypeKind::kFloat || a.GetTotalSize() == 0) {
+            return;
+        }
+        float rmin = static_cast<float>(chainerx::AsScalar(a.Min()));
+        float rmax = static_cast<float>(chainerx::AsScalar(a.Max()));
+        auto p = ranges_.emplace(name, std::make_pair(rmin, rmax));
+        if (!p.second) {
+            p.first->second.first = std::min(p.first->second.first, rmin);
+            p.first->second.second = std::max(p.first->second.second, rmax);
+        }
+    }
+
+    void ObserveOutputs(ChxVMState* st, const ChxVMOp& op) {
+        const ChxVMInstructionProto& inst = op.instruction();
+        for (int i = 0; i < inst.outputs().size(); ++i) {
+            int id = inst.outputs(i);
+            if (id <= 0 || i >= inst.output_names().size()) {
+                continue;
+            }
+            auto found = names_.find(inst.output_names(i));
+            if (found == names_.end()) {
+                continue;
+            }
+            ChxVMVar* var = st->GetVar(id);
+            if (var->IsArray()) {
+                Observe(found->second, var->GetArray());
+            }
+        }
+    }
+
+    void Save(const std::string& filename) const {
+        std::map<std::string, QuantizationParams> params_map;
+        for (const auto& p : ranges_) {
+            const QuantizationParams params = CalculateQuantizationParams(p.second.first, p.second.second);
+            params_map.emplace(p.first, params);
+            LOG() << p.first << ": min=" << p.second.first << " max=" << p.second.second << " zero_point=" << params.zero_point
+                  << " scale=" << params.scale << std::endl;
+        }
+        SaveQuantizationParams(filename, params_map);
+        LOG() << "Wrote quantization params of " << ranges_.size() << " values to " << filename << std::endl;
+    }
+
+private:
+    std::map<std::string, std::string> names_;
+    std::map<std::string, std::pair<float, float>> ranges_;
+};
+
 class ModelRunner {
 public:
     ModelRunner(const cmdline::parser& args, int64_t initial_used_bytes, Model* model)
@@ -131,10 +196,19 @@ public:
             for (Value* value : backprop_model.graph().input_values()) {
                 backprop_ins_.push_back(value->name());
             }
+        } else if (!args.get<std::string>("calibrate_quantization").empty()) {
+            // Ranges are observed on values `Quantize` will see, not
+            // on the merged and fused graph.
+            LOG() << "Constructing model for calibration..." << std::endl;
+            RunCalibrationPasses(model->mutable_graph());
+            CompileModel(model, &chxvm_);
         } else {
             LOG() << "Constructing model..." << std::endl;
             RunDefaultPasses(model->mutable_graph(), args_.exist("backprop"));
-            CompileModel(model, &chxvm_);
+            params_ = LoadParams(model->graph());
+            // Parameters are never updated without backprop so they
+            // can be prepacked by ChxVM.
+            CompileModel(model, &chxvm_, nullptr, false, args_.exist("backprop") ? InOuts() : params_);
         }
 
         for (const std::string& op_name : SplitString(args_.get<std::string>("verbose_ops"), ",")) {
@@ -155,11 +229,13 @@ public:
             chxvm_opts_.chrome_tracing = new ChromeTracingEmitter();
         }
 
-        params_ = LoadParams(model->graph());
+        if (params_.empty()) {
+            params_ = LoadParams(model->graph());
+        }
         param_bytes_ = GetUsedMemory() - initial_used_bytes;
     }
 
-    void CompileModel(Model* model, std::unique_ptr<ChxVM>* chxvm, const char* name = nullptr, bool gen_backprop = false) {
+    void CompileModel(Model* model, std::unique_ptr<ChxVM>* chxvm, const char* name = nullptr, bool gen_backprop = false, const InOuts& params = InOuts()) {
         if (args_.exist("dump_onnx")) {
             onnx::ModelProto xmodel;
             model->ToONNX(&xmodel);
@@ -201,7 +277,7 @@ public:
             CHECK(chxvm_prog.SerializeToOstream(&ofs));
         }
 
-        chxvm->reset(new ChxVM(chxvm_prog));
+        chxvm->reset(new ChxVM(chxvm_prog, params));
     }
 
     ~ModelRunner() {
@@ -249,6 +325,10 @@ public:
         return params_;
     }
 
+    void set_after_op_hook(const std::function<void(ChxVMState*, const ChxVMOp&)>& hook) {
+        chxvm_opts_.after_op_hook = hook;
+    }
+
 private:
     int trace_level() const {
         return args_.exist("verbose") ? 2 : args_.exist("trace") ? 1 : 0;
@@ -285,7 +365,15 @@ void RunMain(const std::vector<std::string>& argv) {
     args.add<std::string>("out_chxvm", '\0', "Output ChxVM program", false);
     args.add<std::string>("dump_outputs_dir", '\0', "Dump each output of ChxVM ops to this directory", false);
     args.add<std::string>("report_json", '\0', "Dump report in a JSON", false);
+    args.add<std::string>(
+            "calibrate_quantization", '\0', "Output static quantization parameters calculated from ranges of values in test cases", false);
     args.add<int>("iterations", 'I', "The number of iteartions", false, 1);
+    args.add("serve", '\0', "Simulate a server which batches requests dynamically");
+    args.add<int>("serve_requests", '\0', "The number of requests for --serve", false, 1000);
+    args.add<double>("serve_qps", '\0', "The average number of requests per second for --serve", false, 100);
+    args.add<int>("serve_max_batch", '\0', "The maximum batch size for --serve", false, 8);
+    args.add<double>("serve_max_delay_ms", '\0', "The maximum time to wait for a batch to be filled for --serve", false, 5);
+    args.add<int>("serve_workers", '\0', "The number of simulated workers for --serve", false, 1);
     args.add<double>("rtol", '\0', "rtol of AllClose", false, 1e-4);
     args.add<double>("atol", '\0', "atol of AllClose", false, 1e-6);
     args.add("equal_nan", '\0', "Treats NaN equal");
@@ -391,6 +479,11 @@ void RunMain(const std::vector<std::string>& argv) {
         LOG() << "Found " << test_cases.size() << " test cases" << std::endl;
     }
 
+    if (args.exist("serve")) {
+        SimulateServing(model.graph(), test_cases, args);
+        return;
+    }
+
     int iterations = args.get<int>("iterations");
     CHECK_LT(0, iterations);
     if (iterations > 1) {
@@ -408,6 +501,15 @@ void RunMain(const std::vector<std::string>& argv) {
 
     if (args.exist("compile_only")) return;
 
+    std::unique_ptr<QuantizationCalibrator> calibrator;
+    const std::string& calibration_out = args.get<std::string>("calibrate_quantization");
+    if (!calibration_out.empty()) {
+        CHECK(!g_quantize) << "Calibration must run with the float model";
+        calibrator.reset(new QuantizationCalibrator(model.graph()));
+        QuantizationCalibrator* c = calibrator.get();
+        model_runner.set_after_op_hook([c](ChxVMState* st, const ChxVMOp& op) { c->ObserveOutputs(st, op); });
+    }
+
     std::vector<double> elapsed_times;
     double total_elapsed = 0;
     double best_elapsed = 0;
@@ -418,6 +520,9 @@ void RunMain(const std::vector<std::string>& argv) {
         for (const auto& p : test_case->inputs) {
             ChxVMVar* v = StageVar(p.second.get());
             CHECK(inputs.emplace(p.first, std::shared_ptr<ChxVMVar>(v)).second) << "Duplicated input parameter: " << p.first;
+            if (calibrator && v->IsArray()) {
+                calibrator->Observe(p.first, v->GetArray());
+            }
         }
 
         std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
@@ -480,6 +585,10 @@ void RunMain(const std::vector<std::string>& argv) {
         }
     }
 
+    if (calibrator) {
+        calibrator->Save(calibration_out);
+    }
+
     const std::string& report_json = args.get<std::string>("report_json");
     if (!report_json.empty()) {
         std::ofstream ofs(report_json);
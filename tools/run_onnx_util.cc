@@ -148,8 +148,9 @@ chainerx::Shape ChainerXShapeFromONNX(const onnx::TensorShapeProto& xshape) {
         if (dim.has_dim_value()) {
             shape.push_back(dim.dim_value());
         } else {
-            LOG() << "Dimension " << dim.dim_param() << " was replaced by 1" << std::endl;
-            shape.push_back(1);
+            const int64_t size = g_symbolic_dim_size > 0 ? g_symbolic_dim_size : 1;
+            LOG() << "Dimension " << dim.dim_param() << " was replaced by " << size << std::endl;
+            shape.push_back(size);
         }
     }
     return shape;
@@ -0,0 +1,209 @@
+#include "tools/serving_simulator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <chainerx/array.h>
+#include <chainerx/routines/creation.h>
+#include <chainerx/routines/manipulation.h>
+
+#include <common/log.h>
+#include <compiler/graph.h>
+#include <compiler/value.h>
+#include <runtime/chxvm.h>
+#include <runtime/chxvm_var.h>
+#include <tools/program_cache.h>
+#include <tools/util.h>
+
+namespace chainer_compiler {
+namespace runtime {
+namespace {
+
+struct Request {
+    const TestCase* test_case;
+    int64_t batch_size;
+    double arrival_ms;
+    double finish_ms;
+};
+
+int64_t GetBatchSize(const TestCase& test_case, const std::vector<std::string>& input_names) {
+    int64_t batch_size = -1;
+    for (const std::string& name : input_names) {
+        auto found = test_case.inputs.find(name);
+        CHECK(found != test_case.inputs.end()) << "Input '" << name << "' not found in " << test_case.name;
+        CHECK(found->second->IsArray()) << "Only arrays can be batched: " << name;
+        const chainerx::Array& a = found->second->GetArray();
+        CHECK_LT(0, a.ndim()) << "Scalar input cannot be batched: " << name;
+        if (batch_size < 0) {
+            batch_size = a.shape()[0];
+        }
+        CHECK_EQ(batch_size, a.shape()[0]) << "Inconsistent batch size in " << test_case.name;
+    }
+    CHECK_LT(0, batch_size);
+    return batch_size;
+}
+
+// Returns the smallest power of two which is not less than
+// `batch_size`, capped by `max_batch`.
+int64_t GetBucketSize(int64_t batch_size, int64_t max_batch) {
+    int64_t bucket = 1;
+    while (bucket < batch_size) {
+        bucket *= 2;
+    }
+    return std::min(bucket, std::max(max_batch, batch_size));
+}
+
+// Concatenates the inputs of `requests` along the batch axis and pads
+// them with zeros to `bucket_size`, like ChainerPadBatchSize.
+InOuts MakeBatch(
+        const std::vector<const Request*>& requests, int64_t bucket_size, const std::vector<std::string>& input_names, const InOuts& params) {
+    InOuts inputs(params);
+    for (const std::string& name : input_names) {
+        std::vector<chainerx::Array> xs;
+        int64_t batch_size = 0;
+        for (const Request* request : requests) {
+            xs.push_back(request->test_case->inputs.find(name)->second->GetArray());
+            batch_size += request->batch_size;
+        }
+        if (batch_size < bucket_size) {
+            chainerx::Shape pad_shape = xs[0].shape();
+            pad_shape[0] = bucket_size - batch_size;
+            xs.push_back(chainerx::Zeros(pad_shape, xs[0].dtype(), xs[0].device()));
+        }
+        chainerx::Array batched = xs.size() == 1 ? xs[0] : chainerx::Concatenate(xs, 0);
+        CHECK(inputs.emplace(name, std::make_shared<ChxVMVar>(StageArray(batched))).second) << "Duplicated input: " << name;
+    }
+    return inputs;
+}
+
+double RunBatch(ProgramCache* cache, const InOuts& inputs, const ChxVMOptions& chxvm_opts) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    InOuts outputs(cache->Run(inputs, chxvm_opts));
+    chainerx::GetDefaultDevice().Synchronize();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() * 0.001;
+}
+
+double Percentile(const std::vector<double>& sorted, double p) {
+    CHECK(!sorted.empty());
+    size_t index = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted[std::min(sorted.size(), std::max<size_t>(index, 1)) - 1];
+}
+
+}  // namespace
+
+void SimulateServing(const Graph& graph, const std::vector<std::unique_ptr<TestCase>>& test_cases, const cmdline::parser& args) {
+    const int num_requests = args.get<int>("serve_requests");
+    const double qps = args.get<double>("serve_qps");
+    const int64_t max_batch = args.get<int>("serve_max_batch");
+    const double max_delay_ms = args.get<double>("serve_max_delay_ms");
+    const int num_workers = args.get<int>("serve_workers");
+    CHECK_LT(0, num_requests);
+    CHECK_LT(0, qps);
+    CHECK_LT(0, max_batch);
+    CHECK_LE(0, max_delay_ms);
+    CHECK_LT(0, num_workers);
+    CHECK(!test_cases.empty());
+
+    std::vector<std::string> input_names;
+    for (const Value* value : graph.input_values()) {
+        if (!value->initializer()) {
+            input_names.push_back(value->name());
+        }
+    }
+
+    // Requests arrive in a Poisson process.
+    std::mt19937 rng(0);
+    std::exponential_distribution<double> interval_dist(qps / 1000);
+    std::vector<Request> requests;
+    double now_ms = 0;
+    for (int i = 0; i < num_requests; ++i) {
+        const TestCase& test_case = *test_cases[i % test_cases.size()];
+        now_ms += interval_dist(rng);
+        requests.push_back(Request{&test_case, GetBatchSize(test_case, input_names), now_ms, 0});
+    }
+
+    LOG() << "Constructing programs for serving..." << std::endl;
+    constexpr bool kBackground = false;
+    ProgramCache cache(graph, 64, kBackground);
+    const InOuts params(LoadParams(graph));
+    ChxVMOptions chxvm_opts;
+    chxvm_opts.check_types = !args.exist("skip_runtime_type_check");
+
+    // Compile and warm up all buckets which batches can use, i.e.,
+    // from the one of the smallest request.
+    const Request* smallest = &*std::min_element(
+            requests.begin(), requests.end(), [](const Request& a, const Request& b) { return a.batch_size < b.batch_size; });
+    for (int64_t bucket = GetBucketSize(smallest->batch_size, max_batch);;) {
+        RunBatch(&cache, MakeBatch({smallest}, bucket, input_names, params), chxvm_opts);
+        if (bucket >= max_batch) break;
+        bucket = GetBucketSize(bucket + 1, max_batch);
+    }
+
+    // The time when each worker becomes idle.
+    std::vector<double> idle_ms(num_workers, 0);
+    int64_t num_batches = 0;
+    int64_t num_padded = 0;
+    int64_t num_served = 0;
+    for (size_t next = 0; next < requests.size();) {
+        auto worker = std::min_element(idle_ms.begin(), idle_ms.end());
+
+        // A batch is sent when it is full or its first request has
+        // waited for `max_delay_ms`.
+        double full_ms = std::numeric_limits<double>::infinity();
+        int64_t total = 0;
+        for (size_t i = next; i < requests.size(); ++i) {
+            total += requests[i].batch_size;
+            if (total >= max_batch) {
+                full_ms = requests[i].arrival_ms;
+                break;
+            }
+        }
+        const double ready_ms = std::min(full_ms, requests[next].arrival_ms + max_delay_ms);
+        const double start_ms = std::max(*worker, ready_ms);
+
+        const size_t first = next;
+        std::vector<const Request*> batch;
+        int64_t batch_size = 0;
+        for (; next < requests.size() && requests[next].arrival_ms <= start_ms; ++next) {
+            if (!batch.empty() && batch_size + requests[next].batch_size > max_batch) break;
+            batch.push_back(&requests[next]);
+            batch_size += requests[next].batch_size;
+        }
+        const int64_t bucket = GetBucketSize(batch_size, max_batch);
+
+        const double elapsed_ms = RunBatch(&cache, MakeBatch(batch, bucket, input_names, params), chxvm_opts);
+        *worker = start_ms + elapsed_ms;
+        for (size_t i = first; i < next; ++i) {
+            requests[i].finish_ms = *worker;
+        }
+        ++num_batches;
+        num_padded += bucket - batch_size;
+        num_served += batch_size;
+    }
+
+    std::vector<double> latencies;
+    double last_finish_ms = 0;
+    for (const Request& request : requests) {
+        latencies.push_back(request.finish_ms - request.arrival_ms);
+        last_finish_ms = std::max(last_finish_ms, request.finish_ms);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const double duration_ms = last_finish_ms - requests[0].arrival_ms;
+
+    std::cerr << "Served " << requests.size() << " requests in " << num_batches << " batches (average batch size "
+              << static_cast<double>(num_served) / num_batches << ", " << num_padded << " padded)" << std::endl;
+    std::cerr << "Latency: p50=" << Percentile(latencies, 0.5) << " msec p99=" << Percentile(latencies, 0.99)
+              << " msec max=" << latencies.back() << " msec" << std::endl;
+    std::cerr << "Throughput: " << requests.size() * 1000 / duration_ms << " requests/sec (offered " << qps << ")" << std::endl;
+    const ProgramCacheStats stats = cache.stats();
+    std::cerr << "Programs: " << stats.num_compiled << " compiled in " << stats.compile_seconds << " sec" << std::endl;
+}
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <tools/cmdline.h>
+#include <tools/run_onnx_util.h>
+
+namespace chainer_compiler {
+
+class Graph;
+
+namespace runtime {
+
+// Simulates a server which receives the inputs of `test_cases` as a
+// stream of requests in a Poisson process, batches them dynamically
+// up to --serve_max_batch or --serve_max_delay_ms, pads each batch
+// to a power-of-two bucket, and runs it on one of --serve_workers
+// workers. Batches are actually executed one by one and the measured
+// times are replayed on the simulated workers. Reports percentiles
+// of the latency and the throughput.
+void SimulateServing(const Graph& graph, const std::vector<std::unique_ptr<TestCase>>& test_cases, const cmdline::parser& args);
+
+}  // namespace runtime
+}  // namespace chainer_compiler
@@ -205,6 +205,13 @@ void RunMain(const std::vector<std::string>& argv) {
         {
             ChromeTracingEmitter::ScopedEvent se(chxvm_opts.chrome_tracing, "Trainer", "Update");
             for (auto&& p : outputs) {
+                if (HasPrefix(p.first, "state_out@")) {
+                    // States such as the loss scale of mixed precision training.
+                    auto found = inputs.find(p.first.substr(10));
+                    CHECK(found != inputs.end()) << p.first;
+                    *found->second = *p.second;
+                    continue;
+                }
                 if (!HasPrefix(p.first, "grad_out@")) continue;
                 const std::string& param_name = p.first.substr(9);
                 auto found = inputs.find(param_name);
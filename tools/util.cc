@@ -136,6 +136,7 @@ void StripChxVMProgram(ChxVMProgramProto* program) {
         ChxVMTypeProto* input_type = program->mutable_input_types(i);
         input_type->set_dtype(0);
         input_type->clear_shape();
+        input_type->clear_dim_params();
     }
 }
 